@@ -32,6 +32,7 @@
 #define INC_SIMD_ARITHMETIC_H_
 
 #include <assert.h>
+#include <math.h>
 #include <stdint.h>
 #include <simd/attributes.h>
 #include <simd/instruction_set.h>
@@ -47,6 +48,14 @@ INLINE NOTNULL(1, 3) void int16_to_float_na(
   }
 }
 
+INLINE NOTNULL(1, 3, 4) void int16_to_float_window_na(
+    const int16_t *data, size_t length, const float *window,
+    float *__restrict res) {
+  for (size_t i = 0; i < length; i++) {
+    res[i] = (float)data[i] * window[i];
+  }
+}
+
 INLINE NOTNULL(1, 3) void float_to_int16_na(const float *data,
                                             size_t length, int16_t *res) {
   for (size_t i = 0; i < length; i++) {
@@ -126,6 +135,41 @@ INLINE NOTNULL(1, 3) void float16_to_float_na(
   }
 }
 
+INLINE NOTNULL(1, 3) void float_to_float16_na(
+    const float *data, size_t length, uint16_t *__restrict res) {
+  for (size_t i = 0; i < length; i++) {
+    FloatUint32 bp;
+    bp.f = data[i];
+    uint32_t x = bp.i;
+    uint16_t sign = (uint16_t)((x >> 16) & 0x8000);
+    x &= 0x7fffffff;
+    uint16_t half;
+    if (x >= 0x7f800000) {
+      // inf and nan; the nan payload is truncated but kept quiet
+      half = 0x7c00;
+      if (x > 0x7f800000) {
+        half |= 0x0200 | (uint16_t)((x >> 13) & 0x03ff);
+      }
+    } else if (x >= 0x38800000) {
+      // rounds to a normal or overflows to inf; the round-to-nearest-even
+      // increment may carry into the exponent, which is what we want
+      uint32_t r = x + 0x00000fff + ((x >> 13) & 1);
+      half = (r >= 0x47800000)? 0x7c00 : (uint16_t)((r - 0x38000000) >> 13);
+    } else {
+      // rounds to a subnormal or to zero
+      int shift = 126 - (int)(x >> 23);
+      if (shift > 24) {
+        half = 0;
+      } else {
+        uint32_t mant = (x & 0x007fffff) | 0x00800000;
+        uint32_t lsb = (mant >> shift) & 1;
+        half = (uint16_t)((mant + (1u << (shift - 1)) - 1 + lsb) >> shift);
+      }
+    }
+    res[i] = sign | half;
+  }
+}
+
 INLINE NOTNULL(1, 2, 3) void real_multiply_na(
     const float *a, const float *b, float *res) {
   *res = *a * *b;
@@ -139,6 +183,14 @@ INLINE NOTNULL(1, 2, 4) void real_multiply_array_na(
   }
 }
 
+INLINE NOTNULL(1, 3, 6) void real_multiply_strided_na(
+    const float *a, int a_stride, const float *b, int b_stride,
+    size_t length, float *res, int res_stride) {
+  for (int j = 0; j < (int)length; j++) {
+    res[j * res_stride] = a[j * a_stride] * b[j * b_stride];
+  }
+}
+
 INLINE NOTNULL(1, 2, 3) void complex_multiply_na(
     const float *a, const float *b, float *res) {
   float re1 = (a)[0];
@@ -159,6 +211,16 @@ INLINE NOTNULL(1, 2, 3) void complex_multiply_conjugate_na(
   res[1] = re1 * im2 + re2 * im1;
 }
 
+INLINE NOTNULL(1, 2, 3) void complex_multiply_scaled_na(
+    const float *a, const float *b, float *res, float scale) {
+  float re1 = (a)[0];
+  float im1 = a[1];
+  float re2 = b[0];
+  float im2 = b[1];
+  res[0] = (re1 * re2 - im1 * im2) * scale;
+  res[1] = (re1 * im2 + re2 * im1) * scale;
+}
+
 INLINE NOTNULL(1, 3) void complex_conjugate_na(
     const float *array, size_t length, float *res) {
   for (size_t i = 1; i < length; i += 2) {
@@ -167,6 +229,41 @@ INLINE NOTNULL(1, 3) void complex_conjugate_na(
   }
 }
 
+INLINE NOTNULL(1, 2, 3, 4, 6, 7) void complex_multiply_split_na(
+    const float *a_re, const float *a_im,
+    const float *b_re, const float *b_im, size_t length,
+    float *res_re, float *res_im) {
+  for (int j = 0; j < (int)length; j++) {
+    float re = a_re[j] * b_re[j] - a_im[j] * b_im[j];
+    float im = a_re[j] * b_im[j] + a_im[j] * b_re[j];
+    res_re[j] = re;
+    res_im[j] = im;
+  }
+}
+
+INLINE NOTNULL(1, 3) void complex_conjugate_split_na(
+    const float *im, size_t length, float *res_im) {
+  for (size_t i = 0; i < length; i++) {
+    res_im[i] = -im[i];
+  }
+}
+
+INLINE NOTNULL(1, 3, 4) void complex_deinterleave_na(
+    const float *array, size_t length, float *re, float *im) {
+  for (size_t i = 0; i < length / 2; i++) {
+    re[i] = array[i * 2];
+    im[i] = array[i * 2 + 1];
+  }
+}
+
+INLINE NOTNULL(1, 2, 4) void complex_interleave_na(
+    const float *re, const float *im, size_t length, float *res) {
+  for (size_t i = 0; i < length / 2; i++) {
+    res[i * 2] = re[i];
+    res[i * 2 + 1] = im[i];
+  }
+}
+
 INLINE NOTNULL(1, 4) void real_multiply_scalar_na(const float *array,
                                                   size_t length,
                                                   float value, float *res) {
@@ -183,6 +280,18 @@ INLINE NOTNULL(1) float sum_elements_na(const float *input, size_t length) {
   return res;
 }
 
+INLINE NOTNULL(1) float sum_elements_kahan_na(const float *input,
+                                              size_t length) {
+  float res = 0.f, comp = 0.f;
+  for (int j = 0; j < (int)length; j++) {
+    float y = input[j] - comp;
+    float t = res + y;
+    comp = (t - res) - y;
+    res = t;
+  }
+  return res;
+}
+
 INLINE NOTNULL(1,4) void add_to_all_na(float *input, size_t length,
                                        float value, float *output) {
   for (int j = 0; j < (int)length; j++) {
@@ -190,12 +299,70 @@ INLINE NOTNULL(1,4) void add_to_all_na(float *input, size_t length,
   }
 }
 
+INLINE NOTNULL(1, 2, 3, 5) void real_multiply_add_na(
+    const float *a, const float *b, const float *c, size_t length,
+    float *res) {
+  for (int j = 0; j < (int)length; j++) {
+    res[j] = a[j] * b[j] + c[j];
+  }
+}
+
+INLINE NOTNULL(1, 2) float dot_product_na(const float *a, const float *b,
+                                          size_t length) {
+  float res = 0.f;
+  for (int j = 0; j < (int)length; j++) {
+    res += a[j] * b[j];
+  }
+  return res;
+}
+
+INLINE int16_t int16_saturate(int32_t value) {
+  if (value > 32767) {
+    return 32767;
+  }
+  if (value < -32768) {
+    return -32768;
+  }
+  return (int16_t)value;
+}
+
+INLINE NOTNULL(1, 2, 4) void int16_add_saturated_na(
+    const int16_t *a, const int16_t *b, size_t length, int16_t *res) {
+  for (size_t i = 0; i < length; i++) {
+    res[i] = int16_saturate((int32_t)a[i] + b[i]);
+  }
+}
+
+INLINE NOTNULL(1, 2, 4) void int16_sub_saturated_na(
+    const int16_t *a, const int16_t *b, size_t length, int16_t *res) {
+  for (size_t i = 0; i < length; i++) {
+    res[i] = int16_saturate((int32_t)a[i] - b[i]);
+  }
+}
+
+INLINE NOTNULL(1, 4) void int16_multiply_scalar_na(
+    const int16_t *array, size_t length, int16_t value, int16_t *res) {
+  for (size_t i = 0; i < length; i++) {
+    res[i] = int16_saturate((int32_t)array[i] * value);
+  }
+}
+
 #ifdef __AVX__
 
 #define SIMD
 #define FLOAT_STEP 8
 #define FLOAT_STEP_LOG2 3
 
+/// @brief Builds the lane mask for _mm256_maskload_ps/_mm256_maskstore_ps
+/// which covers the first count lanes (0 < count <= 8), so array kernels
+/// can process their remainders vectorized instead of element by element.
+INLINE __m256i _mm256_tail_mask(int count) {
+  const __m256 laneVec = _mm256_set_ps(7.f, 6.f, 5.f, 4.f,
+                                       3.f, 2.f, 1.f, 0.f);
+  return _mm256_castps_si256(
+      _mm256_cmp_ps(laneVec, _mm256_set1_ps((float)count), _CMP_LT_OQ));
+}
+
 #ifdef __AVX2__
 
 #define INT16MUL_STEP 16
@@ -220,6 +387,74 @@ INLINE NOTNULL(1, 2, 3) void int16_multiply(
   _mm256_store_si256((__m256i *)(res + 8), resVecHi);
 }
 
+/// @brief Adds the contents of two int16 vectors with signed saturation,
+/// using AVX2 SIMD.
+/// @details res[i] = saturate(a[i] + b[i]); sums outside
+/// [-32768, 32767] clip to the rails instead of wrapping around.
+/// @param a First vector.
+/// @param b Second vector.
+/// @param length The length of the arrays (in int16_t-s, not in bytes).
+/// @param res Result vector.
+INLINE NOTNULL(1, 2, 4) void int16_add_saturated(
+    const int16_t *a, const int16_t *b, size_t length, int16_t *res) {
+  int ilength = (int)length;
+  for (int i = 0; i < ilength - 15; i += 16) {
+    __m256i aVec = _mm256_loadu_si256((const __m256i*)(a + i));
+    __m256i bVec = _mm256_loadu_si256((const __m256i*)(b + i));
+    _mm256_storeu_si256((__m256i*)(res + i), _mm256_adds_epi16(aVec, bVec));
+  }
+  for (int i = (ilength & ~0xF); i < ilength; i++) {
+    res[i] = int16_saturate((int32_t)a[i] + b[i]);
+  }
+}
+
+/// @brief Subtracts the contents of two int16 vectors with signed
+/// saturation, using AVX2 SIMD.
+/// @details res[i] = saturate(a[i] - b[i]); differences outside
+/// [-32768, 32767] clip to the rails instead of wrapping around.
+/// @param a First vector.
+/// @param b Second vector.
+/// @param length The length of the arrays (in int16_t-s, not in bytes).
+/// @param res Result vector.
+INLINE NOTNULL(1, 2, 4) void int16_sub_saturated(
+    const int16_t *a, const int16_t *b, size_t length, int16_t *res) {
+  int ilength = (int)length;
+  for (int i = 0; i < ilength - 15; i += 16) {
+    __m256i aVec = _mm256_loadu_si256((const __m256i*)(a + i));
+    __m256i bVec = _mm256_loadu_si256((const __m256i*)(b + i));
+    _mm256_storeu_si256((__m256i*)(res + i), _mm256_subs_epi16(aVec, bVec));
+  }
+  for (int i = (ilength & ~0xF); i < ilength; i++) {
+    res[i] = int16_saturate((int32_t)a[i] - b[i]);
+  }
+}
+
+/// @brief Multiplies each int16 in the specified array by the specified
+/// value with signed saturation, using AVX2 SIMD.
+/// @details The products are formed in 32 bits and packed back with
+/// signed saturation, so e.g. a gain of 2 clips instead of wrapping.
+/// @param array The array of int16 numbers.
+/// @param length The length of the array (in int16_t-s, not in bytes).
+/// @param value The value to multiply each number in array.
+/// @param res The array to write the results to.
+INLINE NOTNULL(1, 4) void int16_multiply_scalar(
+    const int16_t *array, size_t length, int16_t value, int16_t *res) {
+  int ilength = (int)length;
+  const __m256i valVec = _mm256_set1_epi16(value);
+  for (int i = 0; i < ilength - 15; i += 16) {
+    __m256i aVec = _mm256_loadu_si256((const __m256i*)(array + i));
+    __m256i loP = _mm256_mullo_epi16(aVec, valVec);
+    __m256i hiP = _mm256_mulhi_epi16(aVec, valVec);
+    __m256i prodLo = _mm256_unpacklo_epi16(loP, hiP);
+    __m256i prodHi = _mm256_unpackhi_epi16(loP, hiP);
+    _mm256_storeu_si256((__m256i*)(res + i),
+                        _mm256_packs_epi32(prodLo, prodHi));
+  }
+  for (int i = (ilength & ~0xF); i < ilength; i++) {
+    res[i] = int16_saturate((int32_t)array[i] * value);
+  }
+}
+
 /// @brief Converts an array of short integers to floating point numbers,
 /// using AVX2 SIMD.
 /// @param data The array of short integers.
@@ -231,6 +466,22 @@ INLINE NOTNULL(1, 2, 3) void int16_multiply(
 INLINE NOTNULL(1, 3) void int16_to_float(const int16_t *data,
                                          size_t length, float *res) {
   int ilength = (int)length;
+#ifdef __AVX512F__
+  if (simd_avx512_available()) {
+    assert(align_complement_i16(data) % 8 == align_complement_f32(res) % 8);
+    // Masked int16 loads need AVX-512BW, so the tail stays scalar
+    int i;
+    for (i = 0; i < ilength - 15; i += 16) {
+      __m256i intVec = _mm256_loadu_si256((const __m256i*)(data + i));
+      __m512i wideVec = _mm512_cvtepi16_epi32(intVec);
+      _mm512_storeu_ps(res + i, _mm512_cvtepi32_ps(wideVec));
+    }
+    for (; i < ilength; i++) {
+      res[i] = (float)data[i];
+    }
+    return;
+  }
+#endif
   int startIndex = align_complement_i16(data);
   assert(startIndex % 8 == align_complement_f32(res) % 8);
   for (int i = 0; i < startIndex; i++) {
@@ -238,11 +489,13 @@ INLINE NOTNULL(1, 3) void int16_to_float(const int16_t *data,
   }
 
   for (int i = startIndex; i < ilength - 15; i += 16) {
-    __m256i intVec = _mm256_load_si256((const __m256i*)(data + i));
-    __m256i intlo = _mm256_unpacklo_epi16(intVec, _mm256_set1_epi16(0));
-    __m256i inthi = _mm256_unpackhi_epi16(intVec, _mm256_set1_epi16(0));
-    __m256 flo = _mm256_cvtepi32_ps(intlo);
-    __m256 fhi = _mm256_cvtepi32_ps(inthi);
+    // vpmovsxwd sign-extends and keeps the element order, which the
+    // unpacklo/unpackhi pair did not (they zero-extend and interleave
+    // per 128-bit lane)
+    __m128i intlo = _mm_load_si128((const __m128i*)(data + i));
+    __m128i inthi = _mm_load_si128((const __m128i*)(data + i + 8));
+    __m256 flo = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(intlo));
+    __m256 fhi = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(inthi));
     _mm256_store_ps(res + i, flo);
     _mm256_store_ps(res + i + 8, fhi);
   }
@@ -253,9 +506,56 @@ INLINE NOTNULL(1, 3) void int16_to_float(const int16_t *data,
   }
 }
 
+/// @brief Converts an array of short integers to floating point numbers
+/// and multiplies them by a window in the same pass, using AVX2 SIMD.
+/// @details Fuses the int16_to_float() + real_multiply_array() framing
+/// sequence, so every frame is swept once instead of twice. The window is
+/// typically precomputed with hann_window().
+/// @param data The array of short integers.
+/// @param length The length of the array (in int16_t-s, not in bytes).
+/// @param window The window coefficients (length float-s).
+/// @param res The windowed floating point results.
+INLINE NOTNULL(1, 3, 4) void int16_to_float_window(
+    const int16_t *data, size_t length, const float *window,
+    float *__restrict res) {
+  int ilength = (int)length;
+  int i;
+  for (i = 0; i < ilength - 15; i += 16) {
+    __m128i intlo = _mm_loadu_si128((const __m128i*)(data + i));
+    __m128i inthi = _mm_loadu_si128((const __m128i*)(data + i + 8));
+    __m256 flo = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(intlo));
+    __m256 fhi = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(inthi));
+    flo = _mm256_mul_ps(flo, _mm256_loadu_ps(window + i));
+    fhi = _mm256_mul_ps(fhi, _mm256_loadu_ps(window + i + 8));
+    _mm256_storeu_ps(res + i, flo);
+    _mm256_storeu_ps(res + i + 8, fhi);
+  }
+  for (; i < ilength; i++) {
+    res[i] = (float)data[i] * window[i];
+  }
+}
+
 INLINE NOTNULL(1, 3) void float_to_int16(const float *data,
                                          size_t length, int16_t *res) {
   int ilength = (int)length;
+#ifdef __AVX512F__
+  if (simd_avx512_available()) {
+    assert(align_complement_f32(data) % 16 ==
+           align_complement_i16(res) % 16);
+    // vpmovsdw narrows with saturation, matching _mm256_packs_epi32 below;
+    // masked int16 stores need AVX-512BW, so the tail stays scalar
+    int i;
+    for (i = 0; i < ilength - 15; i += 16) {
+      __m512i intVec = _mm512_cvttps_epi32(_mm512_loadu_ps(data + i));
+      _mm256_storeu_si256((__m256i *)(res + i),
+                          _mm512_cvtsepi32_epi16(intVec));
+    }
+    for (; i < ilength; i++) {
+      res[i] = (int16_t)data[i];
+    }
+    return;
+  }
+#endif
   int startIndex = align_complement_f32(data);
   assert(startIndex % 16 == align_complement_i16(res) % 16);
   for (int i = 0; i < startIndex; i++) {
@@ -268,6 +568,8 @@ INLINE NOTNULL(1, 3) void float_to_int16(const float *data,
     __m256i intVecHi = _mm256_cvttps_epi32(fVecHi);
     __m256i intVecLo = _mm256_cvttps_epi32(fVecLo);
     __m256i int16Vec = _mm256_packs_epi32(intVecHi, intVecLo);
+    // packs interleaves per 128-bit lane; restore the element order
+    int16Vec = _mm256_permute4x64_epi64(int16Vec, 0xD8);
     _mm256_store_si256((__m256i *)(res + i), int16Vec);
   }
 
@@ -280,6 +582,22 @@ INLINE NOTNULL(1, 3) void float_to_int16(const float *data,
 INLINE NOTNULL(1, 3) void int32_to_float(const int32_t *data,
                                          size_t length, float *res) {
   int ilength = (int)length;
+#ifdef __AVX512F__
+  if (simd_avx512_available()) {
+    assert(align_complement_i32(data) == align_complement_f32(res));
+    int i;
+    for (i = 0; i < ilength - 15; i += 16) {
+      __m512i intVec = _mm512_loadu_si512((const void *)(data + i));
+      _mm512_storeu_ps(res + i, _mm512_cvtepi32_ps(intVec));
+    }
+    if (i < ilength) {
+      __mmask16 mask = (__mmask16)((1u << (ilength - i)) - 1);
+      __m512i intVec = _mm512_maskz_loadu_epi32(mask, data + i);
+      _mm512_mask_storeu_ps(res + i, mask, _mm512_cvtepi32_ps(intVec));
+    }
+    return;
+  }
+#endif
   int startIndex = align_complement_i32(data);
   assert(startIndex == align_complement_f32(res));
   for (int i = 0; i < startIndex; i++) {
@@ -301,6 +619,22 @@ INLINE NOTNULL(1, 3) void int32_to_float(const int32_t *data,
 INLINE NOTNULL(1, 3) void float_to_int32(const float *data,
                                          size_t length, int32_t *res) {
   int ilength = (int)length;
+#ifdef __AVX512F__
+  if (simd_avx512_available()) {
+    assert(align_complement_f32(data) == align_complement_i32(res));
+    int i;
+    for (i = 0; i < ilength - 15; i += 16) {
+      __m512 fVec = _mm512_loadu_ps(data + i);
+      _mm512_storeu_si512((void *)(res + i), _mm512_cvttps_epi32(fVec));
+    }
+    if (i < ilength) {
+      __mmask16 mask = (__mmask16)((1u << (ilength - i)) - 1);
+      __m512 fVec = _mm512_maskz_loadu_ps(mask, data + i);
+      _mm512_mask_storeu_epi32(res + i, mask, _mm512_cvttps_epi32(fVec));
+    }
+    return;
+  }
+#endif
   int startIndex = align_complement_f32(data);
   assert(startIndex == align_complement_i32(res));
   for (int i = 0; i < startIndex; i++) {
@@ -329,11 +663,13 @@ INLINE NOTNULL(1, 3) void int16_to_int32(const int16_t *data,
   }
 
   for (int i = startIndex; i < ilength - 15; i += 16) {
-    __m256i intVec = _mm256_load_si256((const __m256i*)(data + i));
-    __m256i intlo = _mm256_unpacklo_epi16(intVec, _mm256_set1_epi16(0));
-    __m256i inthi = _mm256_unpackhi_epi16(intVec, _mm256_set1_epi16(0));
-    _mm256_store_si256((__m256i *)(res + i), intlo);
-    _mm256_store_si256((__m256i *)(res + i + 8), inthi);
+    // See int16_to_float() - vpmovsxwd instead of the zero-extending,
+    // lane-interleaving unpacks
+    __m128i intlo = _mm_load_si128((const __m128i*)(data + i));
+    __m128i inthi = _mm_load_si128((const __m128i*)(data + i + 8));
+    _mm256_store_si256((__m256i *)(res + i), _mm256_cvtepi16_epi32(intlo));
+    _mm256_store_si256((__m256i *)(res + i + 8),
+                       _mm256_cvtepi16_epi32(inthi));
   }
 
   for (int i = startIndex + (((ilength - startIndex) >> 4) << 4);
@@ -353,8 +689,10 @@ INLINE NOTNULL(1, 3) void int32_to_int16(const int32_t *data,
 
   for (int i = startIndex; i < ilength - 15; i += 16) {
     __m256i intVecHi = _mm256_load_si256((const __m256i*)(data + i));
-    __m256i intVecLo = _mm256_load_si256((const __m256i*)(data + i + 4));
+    __m256i intVecLo = _mm256_load_si256((const __m256i*)(data + i + 8));
     __m256i int16Vec = _mm256_packs_epi32(intVecHi, intVecLo);
+    // packs interleaves per 128-bit lane; restore the element order
+    int16Vec = _mm256_permute4x64_epi64(int16Vec, 0xD8);
     _mm256_store_si256((__m256i *)(res + i), int16Vec);
   }
 
@@ -388,6 +726,73 @@ INLINE NOTNULL(1, 2, 3) void int16_multiply(
   _mm_store_si128((__m128i *)(res + 4), resVecHi);
 }
 
+/// @brief Adds the contents of two int16 vectors with signed saturation,
+/// using SSE2 SIMD.
+/// @details res[i] = saturate(a[i] + b[i]); sums outside
+/// [-32768, 32767] clip to the rails instead of wrapping around.
+/// @param a First vector.
+/// @param b Second vector.
+/// @param length The length of the arrays (in int16_t-s, not in bytes).
+/// @param res Result vector.
+INLINE NOTNULL(1, 2, 4) void int16_add_saturated(
+    const int16_t *a, const int16_t *b, size_t length, int16_t *res) {
+  int ilength = (int)length;
+  for (int i = 0; i < ilength - 7; i += 8) {
+    __m128i aVec = _mm_loadu_si128((const __m128i*)(a + i));
+    __m128i bVec = _mm_loadu_si128((const __m128i*)(b + i));
+    _mm_storeu_si128((__m128i*)(res + i), _mm_adds_epi16(aVec, bVec));
+  }
+  for (int i = (ilength & ~0x7); i < ilength; i++) {
+    res[i] = int16_saturate((int32_t)a[i] + b[i]);
+  }
+}
+
+/// @brief Subtracts the contents of two int16 vectors with signed
+/// saturation, using SSE2 SIMD.
+/// @details res[i] = saturate(a[i] - b[i]); differences outside
+/// [-32768, 32767] clip to the rails instead of wrapping around.
+/// @param a First vector.
+/// @param b Second vector.
+/// @param length The length of the arrays (in int16_t-s, not in bytes).
+/// @param res Result vector.
+INLINE NOTNULL(1, 2, 4) void int16_sub_saturated(
+    const int16_t *a, const int16_t *b, size_t length, int16_t *res) {
+  int ilength = (int)length;
+  for (int i = 0; i < ilength - 7; i += 8) {
+    __m128i aVec = _mm_loadu_si128((const __m128i*)(a + i));
+    __m128i bVec = _mm_loadu_si128((const __m128i*)(b + i));
+    _mm_storeu_si128((__m128i*)(res + i), _mm_subs_epi16(aVec, bVec));
+  }
+  for (int i = (ilength & ~0x7); i < ilength; i++) {
+    res[i] = int16_saturate((int32_t)a[i] - b[i]);
+  }
+}
+
+/// @brief Multiplies each int16 in the specified array by the specified
+/// value with signed saturation, using SSE2 SIMD.
+/// @details The products are formed in 32 bits and packed back with
+/// signed saturation, so e.g. a gain of 2 clips instead of wrapping.
+/// @param array The array of int16 numbers.
+/// @param length The length of the array (in int16_t-s, not in bytes).
+/// @param value The value to multiply each number in array.
+/// @param res The array to write the results to.
+INLINE NOTNULL(1, 4) void int16_multiply_scalar(
+    const int16_t *array, size_t length, int16_t value, int16_t *res) {
+  int ilength = (int)length;
+  const __m128i valVec = _mm_set1_epi16(value);
+  for (int i = 0; i < ilength - 7; i += 8) {
+    __m128i aVec = _mm_loadu_si128((const __m128i*)(array + i));
+    __m128i loP = _mm_mullo_epi16(aVec, valVec);
+    __m128i hiP = _mm_mulhi_epi16(aVec, valVec);
+    __m128i prodLo = _mm_unpacklo_epi16(loP, hiP);
+    __m128i prodHi = _mm_unpackhi_epi16(loP, hiP);
+    _mm_storeu_si128((__m128i*)(res + i), _mm_packs_epi32(prodLo, prodHi));
+  }
+  for (int i = (ilength & ~0x7); i < ilength; i++) {
+    res[i] = int16_saturate((int32_t)array[i] * value);
+  }
+}
+
 /// @brief Converts an array of short integers to floating point numbers,
 /// using SSE2 SIMD.
 /// @param data The array of short integers.
@@ -410,8 +815,8 @@ INLINE NOTNULL(1, 3) void int16_to_float(const int16_t *data,
     // Be careful with the sign bit as it should remain on the leftmost place
     __m128i intlo = _mm_unpacklo_epi16(_mm_set1_epi16(0), intVec);
     __m128i inthi = _mm_unpackhi_epi16(_mm_set1_epi16(0), intVec);
-   intlo = _mm_sra_epi32(intlo, _mm_set1_epi32(16));
-   inthi = _mm_sra_epi32(inthi, _mm_set1_epi32(16));
+    intlo = _mm_srai_epi32(intlo, 16);
+    inthi = _mm_srai_epi32(inthi, 16);
     __m128 flo = _mm_cvtepi32_ps(intlo);
     __m128 fhi = _mm_cvtepi32_ps(inthi);
     _mm_store_ps(res + i, flo);
@@ -424,6 +829,39 @@ INLINE NOTNULL(1, 3) void int16_to_float(const int16_t *data,
   }
 }
 
+/// @brief Converts an array of short integers to floating point numbers
+/// and multiplies them by a window in the same pass, using SSE SIMD.
+/// @details Fuses the int16_to_float() + real_multiply_array() framing
+/// sequence, so every frame is swept once instead of twice. The window is
+/// typically precomputed with hann_window().
+/// @param data The array of short integers.
+/// @param length The length of the array (in int16_t-s, not in bytes).
+/// @param window The window coefficients (length float-s).
+/// @param res The windowed floating point results.
+INLINE NOTNULL(1, 3, 4) void int16_to_float_window(
+    const int16_t *data, size_t length, const float *window,
+    float *__restrict res) {
+  int ilength = (int)length;
+  int i;
+  for (i = 0; i < ilength - 7; i += 8) {
+    __m128i intVec = _mm_loadu_si128((const __m128i*)(data + i));
+    // Be careful with the sign bit as it should remain on the leftmost place
+    __m128i intlo = _mm_unpacklo_epi16(_mm_set1_epi16(0), intVec);
+    __m128i inthi = _mm_unpackhi_epi16(_mm_set1_epi16(0), intVec);
+    intlo = _mm_srai_epi32(intlo, 16);
+    inthi = _mm_srai_epi32(inthi, 16);
+    __m128 flo = _mm_mul_ps(_mm_cvtepi32_ps(intlo),
+                            _mm_loadu_ps(window + i));
+    __m128 fhi = _mm_mul_ps(_mm_cvtepi32_ps(inthi),
+                            _mm_loadu_ps(window + i + 4));
+    _mm_storeu_ps(res + i, flo);
+    _mm_storeu_ps(res + i + 4, fhi);
+  }
+  for (; i < ilength; i++) {
+    res[i] = (float)data[i] * window[i];
+  }
+}
+
 INLINE NOTNULL(1, 3) void float_to_int16(const float *data,
                                          size_t length, int16_t *res) {
   int ilength = (int)length;
@@ -504,8 +942,8 @@ INLINE NOTNULL(1, 3) void int16_to_int32(const int16_t *data,
     // Be careful with the sign bit as it should remain on the leftmost place
     __m128i intlo = _mm_unpacklo_epi16(_mm_set1_epi16(0), intVec);
     __m128i inthi = _mm_unpackhi_epi16(_mm_set1_epi16(0), intVec);
-   intlo = _mm_sra_epi32(intlo, _mm_set1_epi32(16));
-   inthi = _mm_sra_epi32(inthi, _mm_set1_epi32(16));
+    intlo = _mm_srai_epi32(intlo, 16);
+    inthi = _mm_srai_epi32(inthi, 16);
     _mm_store_si128((__m128i *)(res + i), intlo);
     _mm_store_si128((__m128i *)(res + i + 4), inthi);
   }
@@ -614,6 +1052,33 @@ INLINE NOTNULL(1, 3) void float16_to_float(
 
 #endif
 
+#ifdef __F16C__
+
+/// @brief Converts an array of 32-bit floating point numbers to 16-bit
+/// floats, using F16C SIMD.
+/// @details Rounds to nearest even, matching float_to_float16_na().
+/// @param data The array of floating point numbers.
+/// @param length The length of the array (in float-s, not in bytes).
+/// @param res The float16 (uint16_t) array to write the results to.
+/// @note res must have at least the same length as data.
+INLINE NOTNULL(1, 3) void float_to_float16(
+    const float *data, size_t length, uint16_t *__restrict res) {
+  int ilength = (int)length;
+  int i;
+  for (i = 0; i < ilength - 7; i += 8) {
+    __m256 vec = _mm256_loadu_ps(data + i);
+    __m128i halfVec = _mm256_cvtps_ph(vec, _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128((__m128i*)(res + i), halfVec);
+  }
+  float_to_float16_na(data + i, ilength - i, res + i);
+}
+
+#else
+
+#define float_to_float16 float_to_float16_na
+
+#endif
+
 /// @brief Multiplies the contents of two vectors, saving the result to the
 /// third vector, using AVX SIMD (float version).
 /// @details res[i] = a[i] * b[i], i = 0..7.
@@ -639,15 +1104,78 @@ INLINE NOTNULL(1, 2, 3) void real_multiply(
 INLINE NOTNULL(1, 2, 4) void real_multiply_array(
     const float *a, const float *b, size_t length, float *res) {
   int j, ilength = length;
+#ifdef __AVX512F__
+  if (simd_avx512_available()) {
+    for (j = 0; j < ilength - 15; j += 16) {
+      __m512 aVec512 = _mm512_loadu_ps(a + j);
+      __m512 bVec512 = _mm512_loadu_ps(b + j);
+      _mm512_storeu_ps(res + j, _mm512_mul_ps(aVec512, bVec512));
+    }
+    if (j < ilength) {
+      __mmask16 mask = (__mmask16)((1u << (ilength - j)) - 1);
+      __m512 aVec512 = _mm512_maskz_loadu_ps(mask, a + j);
+      __m512 bVec512 = _mm512_maskz_loadu_ps(mask, b + j);
+      _mm512_mask_storeu_ps(res + j, mask, _mm512_mul_ps(aVec512, bVec512));
+    }
+    return;
+  }
+#endif
   for (j = 0; j < ilength - FLOAT_STEP + 1; j += FLOAT_STEP) {
     __m256 aVec = _mm256_loadu_ps(a + j);
     __m256 bVec = _mm256_loadu_ps(b + j);
     __m256 resVec = _mm256_mul_ps(aVec, bVec);
     _mm256_storeu_ps(res + j, resVec);
   }
+  if (j < ilength) {
+    __m256i mask = _mm256_tail_mask(ilength - j);
+    __m256 aVec = _mm256_maskload_ps(a + j, mask);
+    __m256 bVec = _mm256_maskload_ps(b + j, mask);
+    _mm256_maskstore_ps(res + j, mask, _mm256_mul_ps(aVec, bVec));
+  }
+}
+
+/// @brief Multiplies the contents of two strided vectors, saving the result
+/// to the third strided vector.
+/// @details res[i * res_stride] = a[i * a_stride] * b[i * b_stride]. With
+/// AVX2 the loads go through vector gathers; elsewhere the loop is scalar.
+/// @param a First vector.
+/// @param a_stride The distance between consecutive elements of a
+/// (in float-s, not in bytes).
+/// @param b Second vector.
+/// @param b_stride The distance between consecutive elements of b.
+/// @param length The number of elements to process.
+/// @param res Resulting array.
+/// @param res_stride The distance between consecutive elements of res.
+INLINE NOTNULL(1, 3, 6) void real_multiply_strided(
+    const float *a, int a_stride, const float *b, int b_stride,
+    size_t length, float *res, int res_stride) {
+#ifdef __AVX2__
+  int j, ilength = (int)length;
+  const __m256i laneVec = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+  const __m256i aIdx = _mm256_mullo_epi32(laneVec, _mm256_set1_epi32(a_stride));
+  const __m256i bIdx = _mm256_mullo_epi32(laneVec, _mm256_set1_epi32(b_stride));
+  float lanes[FLOAT_STEP] __attribute__ ((aligned (32)));
+  for (j = 0; j < ilength - FLOAT_STEP + 1; j += FLOAT_STEP) {
+    __m256 aVec = _mm256_i32gather_ps(a + j * a_stride, aIdx, 4);
+    __m256 bVec = _mm256_i32gather_ps(b + j * b_stride, bIdx, 4);
+    __m256 resVec = _mm256_mul_ps(aVec, bVec);
+    if (res_stride == 1) {
+      _mm256_storeu_ps(res + j, resVec);
+    } else {
+      // there is no scatter before AVX-512, so spill and store one by one
+      _mm256_store_ps(lanes, resVec);
+      for (int k = 0; k < FLOAT_STEP; k++) {
+        res[(j + k) * res_stride] = lanes[k];
+      }
+    }
+  }
   for (; j < ilength; j++) {
-    res[j] = a[j] * b[j];
+    res[j * res_stride] = a[j * a_stride] * b[j * b_stride];
   }
+#else
+  real_multiply_strided_na(a, a_stride, b, b_stride, length,
+                           res, res_stride);
+#endif
 }
 
 /// @brief Performs complex multiplication of the contents of two complex
@@ -671,6 +1199,55 @@ INLINE NOTNULL(1, 2, 3) void complex_multiply(
   _mm256_store_ps(res, resVec);
 }
 
+#ifdef __AVX512F__
+/// @brief Performs complex multiplication of the contents of two complex
+/// vectors, saving the result to the third vector, using AVX-512 SIMD
+/// (16 float-s, that is, 8 complex numbers at once).
+/// @details Call it only when simd_avx512_available() says so; otherwise
+/// loop over complex_multiply().
+/// @param a First vector.
+/// @param b Second vector.
+/// @param res Result vector.
+INLINE NOTNULL(1, 2, 3) void complex_multiply_avx512(
+    const float *a, const float *b, float *res) {
+  __m512 Xvec = _mm512_loadu_ps(a);
+  __m512 Hvec = _mm512_loadu_ps(b);
+  __m512 Xim = _mm512_movehdup_ps(Xvec);
+  __m512 Xre = _mm512_moveldup_ps(Xvec);
+  __m512 HvecExch = _mm512_shuffle_ps(Hvec, Hvec, 0xB1);
+  // fmaddsub subtracts in the even (real) lanes and adds in the odd
+  // (imaginary) ones, just like _mm256_addsub_ps
+  __m512 resVec = _mm512_fmaddsub_ps(Xre, Hvec,
+                                     _mm512_mul_ps(Xim, HvecExch));
+  _mm512_storeu_ps(res, resVec);
+}
+#endif
+
+/// @brief Performs complex multiplication of the contents of two complex
+/// vectors and multiplies the products by a real constant, saving the result
+/// to the third vector, using AVX SIMD.
+/// @details Doing the scaling here fuses what would otherwise be a separate
+/// real_multiply_scalar() pass over the same buffer (e.g. the 1/N FFT
+/// normalization).
+/// @param a First vector.
+/// @param b Second vector.
+/// @param res Result vector.
+/// @param scale The constant every product is multiplied by.
+/// @pre a, b and res must be aligned to 32 bytes.
+INLINE NOTNULL(1, 2, 3) void complex_multiply_scaled(
+    const float *a, const float *b, float *res, float scale) {
+  __m256 Xvec = _mm256_load_ps(a);
+  __m256 Hvec = _mm256_load_ps(b);
+  __m256 Xim = _mm256_movehdup_ps(Xvec);
+  __m256 Xre = _mm256_moveldup_ps(Xvec);
+  __m256 HvecExch = _mm256_shuffle_ps(Hvec, Hvec, 0xB1);
+  __m256 resHalf1 = _mm256_mul_ps(Xre, Hvec);
+  __m256 resHalf2 = _mm256_mul_ps(Xim, HvecExch);
+  __m256 resVec = _mm256_addsub_ps(resHalf1, resHalf2);
+  resVec = _mm256_mul_ps(resVec, _mm256_set1_ps(scale));
+  _mm256_store_ps(res, resVec);
+}
+
 /// @brief Performs complex multiplication of the contents of two complex
 /// vectors, saving the result to the third vector, using AVX SIMD (
 /// conjugate version).
@@ -739,6 +1316,127 @@ INLINE NOTNULL(1, 3) void complex_conjugate(
   }
 }
 
+/// @brief Performs complex multiplication of two complex vectors stored in
+/// split (planar) form, using AVX SIMD.
+/// @details res_re[i] = a_re[i] * b_re[i] - a_im[i] * b_im[i];
+/// res_im[i] = a_re[i] * b_im[i] + a_im[i] * b_re[i]. The planar layout
+/// needs none of the lane shuffles complex_multiply() spends on the
+/// interleaved pairs, so the whole loop is plain multiplies and adds
+/// (FMA-s when available).
+/// @param a_re The real plane of the first vector.
+/// @param a_im The imaginary plane of the first vector.
+/// @param b_re The real plane of the second vector.
+/// @param b_im The imaginary plane of the second vector.
+/// @param length The length of each plane (in float-s, that is, in complex
+/// numbers).
+/// @param res_re The real plane of the result. May be a_re or b_re.
+/// @param res_im The imaginary plane of the result. May be a_im or b_im.
+INLINE NOTNULL(1, 2, 3, 4, 6, 7) void complex_multiply_split(
+    const float *a_re, const float *a_im,
+    const float *b_re, const float *b_im, size_t length,
+    float *res_re, float *res_im) {
+  int ilength = (int)length;
+  int j;
+  for (j = 0; j < ilength - 7; j += 8) {
+    __m256 are = _mm256_loadu_ps(a_re + j);
+    __m256 aim = _mm256_loadu_ps(a_im + j);
+    __m256 bre = _mm256_loadu_ps(b_re + j);
+    __m256 bim = _mm256_loadu_ps(b_im + j);
+#ifdef __FMA__
+    __m256 re = _mm256_fmsub_ps(are, bre, _mm256_mul_ps(aim, bim));
+    __m256 im = _mm256_fmadd_ps(are, bim, _mm256_mul_ps(aim, bre));
+#else
+    __m256 re = _mm256_sub_ps(_mm256_mul_ps(are, bre),
+                              _mm256_mul_ps(aim, bim));
+    __m256 im = _mm256_add_ps(_mm256_mul_ps(are, bim),
+                              _mm256_mul_ps(aim, bre));
+#endif
+    _mm256_storeu_ps(res_re + j, re);
+    _mm256_storeu_ps(res_im + j, im);
+  }
+  for (; j < ilength; j++) {
+    float re = a_re[j] * b_re[j] - a_im[j] * b_im[j];
+    float im = a_re[j] * b_im[j] + a_im[j] * b_re[j];
+    res_re[j] = re;
+    res_im[j] = im;
+  }
+}
+
+/// @brief Calculates complex conjugates of a vector stored in split
+/// (planar) form, using AVX SIMD.
+/// @details Only the imaginary plane is touched; the real plane of the
+/// conjugate is the original one.
+/// @param im The imaginary plane.
+/// @param length The length of the plane (in float-s, that is, in complex
+/// numbers).
+/// @param res_im The negated imaginary plane. May be im itself.
+INLINE NOTNULL(1, 3) void complex_conjugate_split(
+    const float *im, size_t length, float *res_im) {
+  int ilength = (int)length;
+  int j;
+  const __m256 signVec = _mm256_set1_ps(-0.f);
+  for (j = 0; j < ilength - 7; j += 8) {
+    __m256 vec = _mm256_loadu_ps(im + j);
+    _mm256_storeu_ps(res_im + j, _mm256_xor_ps(vec, signVec));
+  }
+  for (; j < ilength; j++) {
+    res_im[j] = -im[j];
+  }
+}
+
+/// @brief Unpacks an interleaved complex vector into the split (planar)
+/// re/im form, using AVX SIMD.
+/// @details This shuffle is paid once per conversion; afterwards the
+/// _split kernels run shuffle-free.
+/// @param array The array of complex numbers (interleaved).
+/// @param length The length of the array (in float-s, not in bytes; even).
+/// @param re The real plane of length / 2 float-s.
+/// @param im The imaginary plane of length / 2 float-s.
+INLINE NOTNULL(1, 3, 4) void complex_deinterleave(
+    const float *array, size_t length, float *re, float *im) {
+  int icount = (int)(length / 2);
+  int j;
+  for (j = 0; j < icount - 7; j += 8) {
+    __m256 v0 = _mm256_loadu_ps(array + j * 2);
+    __m256 v1 = _mm256_loadu_ps(array + j * 2 + 8);
+    __m256 lo = _mm256_permute2f128_ps(v0, v1, 0x20);
+    __m256 hi = _mm256_permute2f128_ps(v0, v1, 0x31);
+    _mm256_storeu_ps(re + j, _mm256_shuffle_ps(lo, hi,
+                                               _MM_SHUFFLE(2, 0, 2, 0)));
+    _mm256_storeu_ps(im + j, _mm256_shuffle_ps(lo, hi,
+                                               _MM_SHUFFLE(3, 1, 3, 1)));
+  }
+  for (; j < icount; j++) {
+    re[j] = array[j * 2];
+    im[j] = array[j * 2 + 1];
+  }
+}
+
+/// @brief Packs the split (planar) re/im planes back into an interleaved
+/// complex vector, using AVX SIMD.
+/// @param re The real plane of length / 2 float-s.
+/// @param im The imaginary plane of length / 2 float-s.
+/// @param length The length of the resulting array (in float-s, not in
+/// bytes; even).
+/// @param res The array of complex numbers (interleaved).
+INLINE NOTNULL(1, 2, 4) void complex_interleave(
+    const float *re, const float *im, size_t length, float *res) {
+  int icount = (int)(length / 2);
+  int j;
+  for (j = 0; j < icount - 7; j += 8) {
+    __m256 reVec = _mm256_loadu_ps(re + j);
+    __m256 imVec = _mm256_loadu_ps(im + j);
+    __m256 lo = _mm256_unpacklo_ps(reVec, imVec);
+    __m256 hi = _mm256_unpackhi_ps(reVec, imVec);
+    _mm256_storeu_ps(res + j * 2, _mm256_permute2f128_ps(lo, hi, 0x20));
+    _mm256_storeu_ps(res + j * 2 + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+  }
+  for (; j < icount; j++) {
+    res[j * 2] = re[j];
+    res[j * 2 + 1] = im[j];
+  }
+}
+
 /// @brief Multiplies each floating point number in the specified array
 /// by the specified value, using AVX SIMD.
 /// @details This functions does the same thing as real_multiply_scalar_na, but
@@ -766,9 +1464,11 @@ INLINE NOTNULL(1, 4) void real_multiply_scalar(const float *array,
       _mm256_store_ps(res + i, vec);
     }
 
-    for (int i = startIndex + ((ilength - startIndex) & ~0x7);
-         i < ilength; i++) {
-      res[i] = array[i] * value;
+    int tail = startIndex + ((ilength - startIndex) & ~0x7);
+    if (tail < ilength) {
+      __m256i mask = _mm256_tail_mask(ilength - tail);
+      __m256 vec = _mm256_maskload_ps(array + tail, mask);
+      _mm256_maskstore_ps(res + tail, mask, _mm256_mul_ps(vec, mulVec));
     }
   } else {
     for (int i = 0; i < ilength - 7; i += 8) {
@@ -777,36 +1477,84 @@ INLINE NOTNULL(1, 4) void real_multiply_scalar(const float *array,
       _mm256_storeu_ps(res + i, vec);
     }
 
-    for (int i = ((ilength - startIndex) & ~0x7);
-         i < ilength; i++) {
-      res[i] = array[i] * value;
+    int tail = (ilength & ~0x7);
+    if (tail < ilength) {
+      __m256i mask = _mm256_tail_mask(ilength - tail);
+      __m256 vec = _mm256_maskload_ps(array + tail, mask);
+      _mm256_maskstore_ps(res + tail, mask, _mm256_mul_ps(vec, mulVec));
     }
   }
 }
 
 /// @brief Sums all the elements of the array.
+/// @details Four independent accumulators hide the latency of the
+/// vector addition chain; the pairwise final reduction also keeps the
+/// rounding error growth at O(log length) instead of O(length).
 /// @param input The array which will be summed.
 /// @param length The size of the array (in float-s, not in bytes).
 /// @return The sum of all the elements in the array.
 INLINE NOTNULL(1) float sum_elements(const float *input, size_t length) {
   assert(align_complement_f32(input) == 0);
   int ilength = (int)length;
-  __m256 accum = _mm256_setzero_ps();
-  for (int j = 0; j < ilength - 15; j += 16) {
-    __m256 vec1 = _mm256_load_ps(input + j);
-    __m256 vec2 = _mm256_load_ps(input + j + 8);
-    accum = _mm256_add_ps(accum, vec1);
-    accum = _mm256_add_ps(accum, vec2);
-  }
+  __m256 accum1 = _mm256_setzero_ps();
+  __m256 accum2 = _mm256_setzero_ps();
+  __m256 accum3 = _mm256_setzero_ps();
+  __m256 accum4 = _mm256_setzero_ps();
+  for (int j = 0; j < ilength - 31; j += 32) {
+    accum1 = _mm256_add_ps(accum1, _mm256_load_ps(input + j));
+    accum2 = _mm256_add_ps(accum2, _mm256_load_ps(input + j + 8));
+    accum3 = _mm256_add_ps(accum3, _mm256_load_ps(input + j + 16));
+    accum4 = _mm256_add_ps(accum4, _mm256_load_ps(input + j + 24));
+  }
+  __m256 accum = _mm256_add_ps(_mm256_add_ps(accum1, accum2),
+                               _mm256_add_ps(accum3, accum4));
   accum = _mm256_hadd_ps(accum, accum);
   accum = _mm256_hadd_ps(accum, accum);
   float res = _mm256_get_ps(accum, 0) + _mm256_get_ps(accum, 4);
-  for (int j = (ilength & ~0xF); j < ilength; j++) {
+  for (int j = (ilength & ~0x1F); j < ilength; j++) {
     res += input[j];
   }
   return res;
 }
 
+/// @brief Sums all the elements of the array with Kahan compensation,
+/// using AVX SIMD.
+/// @details Each of the eight lanes carries its own compensation term,
+/// so the result is accurate to a few ulps regardless of the array
+/// length, at the cost of four times the arithmetic of sum_elements().
+/// @param input The array which will be summed.
+/// @param length The size of the array (in float-s, not in bytes).
+/// @return The sum of all the elements in the array.
+INLINE NOTNULL(1) float sum_elements_kahan(const float *input,
+                                           size_t length) {
+  assert(align_complement_f32(input) == 0);
+  int ilength = (int)length;
+  __m256 accum = _mm256_setzero_ps();
+  __m256 comp = _mm256_setzero_ps();
+  for (int j = 0; j < ilength - 7; j += 8) {
+    __m256 y = _mm256_sub_ps(_mm256_load_ps(input + j), comp);
+    __m256 t = _mm256_add_ps(accum, y);
+    comp = _mm256_sub_ps(_mm256_sub_ps(t, accum), y);
+    accum = t;
+  }
+  float lanes[8] __attribute__ ((aligned (32)));
+  _mm256_store_ps(lanes, accum);
+  float res = 0.f, scomp = 0.f;
+  for (int j = 0; j < 8; j++) {
+    float y = lanes[j] - scomp;
+    float t = res + y;
+    scomp = (t - res) - y;
+    res = t;
+  }
+  for (int j = (ilength & ~0x7); j < ilength; j++) {
+    float y = input[j] - scomp;
+    float t = res + y;
+    scomp = (t - res) - y;
+    res = t;
+  }
+  return res;
+}
+
 /// @brief Adds the same value to all elements in the array.
 /// @param input The array to sum with the specified value.
 /// @param length The size of the arrays (in float-s, not in bytes).
@@ -824,11 +1572,105 @@ INLINE NOTNULL(1,4) void add_to_all(float *input, size_t length,
     _mm256_store_ps(output + j, vec1);
     _mm256_store_ps(output + j + 8, vec2);
   }
-  for (int j = (ilength & ~0xF); j < ilength; j++) {
-    output[j] = input[j] + value;
+  int j = (ilength & ~0xF);
+  if (j < ilength - 7) {
+    __m256 vec = _mm256_load_ps(input + j);
+    _mm256_store_ps(output + j, _mm256_add_ps(add_vec, vec));
+    j += 8;
+  }
+  if (j < ilength) {
+    __m256i mask = _mm256_tail_mask(ilength - j);
+    __m256 vec = _mm256_maskload_ps(input + j, mask);
+    _mm256_maskstore_ps(output + j, mask, _mm256_add_ps(add_vec, vec));
+  }
+}
+
+/// @brief Multiplies the contents of two vectors elementwise and adds the
+/// third vector, saving the result to the fourth vector, using AVX SIMD.
+/// @details res[i] = a[i] * b[i] + c[i]. Fuses what would otherwise be a
+/// real_multiply_array() pass followed by a separate addition pass over
+/// the same buffer.
+/// @param a First vector.
+/// @param b Second vector.
+/// @param c The vector to add to the products.
+/// @param length The size of the vectors (in float-s, not in bytes).
+/// @param res Resulting array.
+INLINE NOTNULL(1, 2, 3, 5) void real_multiply_add(
+    const float *a, const float *b, const float *c, size_t length,
+    float *res) {
+  int j, ilength = length;
+  for (j = 0; j < ilength - FLOAT_STEP + 1; j += FLOAT_STEP) {
+    __m256 aVec = _mm256_loadu_ps(a + j);
+    __m256 bVec = _mm256_loadu_ps(b + j);
+    __m256 cVec = _mm256_loadu_ps(c + j);
+#ifdef __FMA__
+    __m256 resVec = _mm256_fmadd_ps(aVec, bVec, cVec);
+#else
+    __m256 resVec = _mm256_add_ps(_mm256_mul_ps(aVec, bVec), cVec);
+#endif
+    _mm256_storeu_ps(res + j, resVec);
+  }
+  if (j < ilength) {
+    __m256i mask = _mm256_tail_mask(ilength - j);
+    __m256 aVec = _mm256_maskload_ps(a + j, mask);
+    __m256 bVec = _mm256_maskload_ps(b + j, mask);
+    __m256 cVec = _mm256_maskload_ps(c + j, mask);
+#ifdef __FMA__
+    __m256 resVec = _mm256_fmadd_ps(aVec, bVec, cVec);
+#else
+    __m256 resVec = _mm256_add_ps(_mm256_mul_ps(aVec, bVec), cVec);
+#endif
+    _mm256_maskstore_ps(res + j, mask, resVec);
   }
 }
 
+/// @brief Calculates the dot product of two vectors, using AVX SIMD.
+/// @details Four independent accumulators are used to hide the latency
+/// of the addition chain, so no temporary product buffer and no separate
+/// sum_elements() pass are needed.
+/// @param a First vector.
+/// @param b Second vector.
+/// @param length The size of the vectors (in float-s, not in bytes).
+/// @return The sum of a[i] * b[i] over the vectors.
+INLINE NOTNULL(1, 2) float dot_product(const float *a, const float *b,
+                                       size_t length) {
+  int ilength = (int)length;
+  __m256 accum1 = _mm256_setzero_ps();
+  __m256 accum2 = _mm256_setzero_ps();
+  __m256 accum3 = _mm256_setzero_ps();
+  __m256 accum4 = _mm256_setzero_ps();
+  for (int j = 0; j < ilength - 31; j += 32) {
+#ifdef __FMA__
+    accum1 = _mm256_fmadd_ps(_mm256_loadu_ps(a + j),
+                             _mm256_loadu_ps(b + j), accum1);
+    accum2 = _mm256_fmadd_ps(_mm256_loadu_ps(a + j + 8),
+                             _mm256_loadu_ps(b + j + 8), accum2);
+    accum3 = _mm256_fmadd_ps(_mm256_loadu_ps(a + j + 16),
+                             _mm256_loadu_ps(b + j + 16), accum3);
+    accum4 = _mm256_fmadd_ps(_mm256_loadu_ps(a + j + 24),
+                             _mm256_loadu_ps(b + j + 24), accum4);
+#else
+    accum1 = _mm256_add_ps(accum1, _mm256_mul_ps(
+        _mm256_loadu_ps(a + j), _mm256_loadu_ps(b + j)));
+    accum2 = _mm256_add_ps(accum2, _mm256_mul_ps(
+        _mm256_loadu_ps(a + j + 8), _mm256_loadu_ps(b + j + 8)));
+    accum3 = _mm256_add_ps(accum3, _mm256_mul_ps(
+        _mm256_loadu_ps(a + j + 16), _mm256_loadu_ps(b + j + 16)));
+    accum4 = _mm256_add_ps(accum4, _mm256_mul_ps(
+        _mm256_loadu_ps(a + j + 24), _mm256_loadu_ps(b + j + 24)));
+#endif
+  }
+  __m256 accum = _mm256_add_ps(_mm256_add_ps(accum1, accum2),
+                               _mm256_add_ps(accum3, accum4));
+  accum = _mm256_hadd_ps(accum, accum);
+  accum = _mm256_hadd_ps(accum, accum);
+  float res = _mm256_get_ps(accum, 0) + _mm256_get_ps(accum, 4);
+  for (int j = (ilength & ~0x1F); j < ilength; j++) {
+    res += a[j] * b[j];
+  }
+  return res;
+}
+
 #elif defined(__ARM_NEON__)
 
 #define SIMD
@@ -851,6 +1693,71 @@ INLINE NOTNULL(1, 2, 3) void int16_multiply(
   vst1q_s32(res, resVec);
 }
 
+/// @brief Adds the contents of two int16 vectors with signed saturation,
+/// using NEON SIMD.
+/// @details res[i] = saturate(a[i] + b[i]); sums outside
+/// [-32768, 32767] clip to the rails instead of wrapping around.
+/// @param a First vector.
+/// @param b Second vector.
+/// @param length The length of the arrays (in int16_t-s, not in bytes).
+/// @param res Result vector.
+INLINE NOTNULL(1, 2, 4) void int16_add_saturated(
+    const int16_t *a, const int16_t *b, size_t length, int16_t *res) {
+  int ilength = (int)length;
+  for (int i = 0; i < ilength - 7; i += 8) {
+    int16x8_t aVec = vld1q_s16(a + i);
+    int16x8_t bVec = vld1q_s16(b + i);
+    vst1q_s16(res + i, vqaddq_s16(aVec, bVec));
+  }
+  for (int i = (ilength & ~0x7); i < ilength; i++) {
+    res[i] = int16_saturate((int32_t)a[i] + b[i]);
+  }
+}
+
+/// @brief Subtracts the contents of two int16 vectors with signed
+/// saturation, using NEON SIMD.
+/// @details res[i] = saturate(a[i] - b[i]); differences outside
+/// [-32768, 32767] clip to the rails instead of wrapping around.
+/// @param a First vector.
+/// @param b Second vector.
+/// @param length The length of the arrays (in int16_t-s, not in bytes).
+/// @param res Result vector.
+INLINE NOTNULL(1, 2, 4) void int16_sub_saturated(
+    const int16_t *a, const int16_t *b, size_t length, int16_t *res) {
+  int ilength = (int)length;
+  for (int i = 0; i < ilength - 7; i += 8) {
+    int16x8_t aVec = vld1q_s16(a + i);
+    int16x8_t bVec = vld1q_s16(b + i);
+    vst1q_s16(res + i, vqsubq_s16(aVec, bVec));
+  }
+  for (int i = (ilength & ~0x7); i < ilength; i++) {
+    res[i] = int16_saturate((int32_t)a[i] - b[i]);
+  }
+}
+
+/// @brief Multiplies each int16 in the specified array by the specified
+/// value with signed saturation, using NEON SIMD.
+/// @details The products are formed in 32 bits and narrowed back with
+/// signed saturation, so e.g. a gain of 2 clips instead of wrapping.
+/// @param array The array of int16 numbers.
+/// @param length The length of the array (in int16_t-s, not in bytes).
+/// @param value The value to multiply each number in array.
+/// @param res The array to write the results to.
+INLINE NOTNULL(1, 4) void int16_multiply_scalar(
+    const int16_t *array, size_t length, int16_t value, int16_t *res) {
+  int ilength = (int)length;
+  for (int i = 0; i < ilength - 7; i += 8) {
+    int16x8_t aVec = vld1q_s16(array + i);
+    int32x4_t prodLo = vmull_n_s16(vget_low_s16(aVec), value);
+    int32x4_t prodHi = vmull_n_s16(vget_high_s16(aVec), value);
+    int16x8_t resVec = vcombine_s16(vqmovn_s32(prodLo), vqmovn_s32(prodHi));
+    vst1q_s16(res + i, resVec);
+  }
+  for (int i = (ilength & ~0x7); i < ilength; i++) {
+    res[i] = int16_saturate((int32_t)array[i] * value);
+  }
+}
+
 INLINE NOTNULL(1, 3) void int16_to_float(const int16_t *data,
                                          size_t length, float *res) {
   int ilength = (int)length;
@@ -865,6 +1772,29 @@ INLINE NOTNULL(1, 3) void int16_to_float(const int16_t *data,
   }
 }
 
+/// @brief Converts an array of short integers to floating point numbers
+/// and multiplies them by a window in the same pass, using NEON SIMD.
+/// @details Fuses the int16_to_float() + real_multiply_array() framing
+/// sequence, so every frame is swept once instead of twice. The window is
+/// typically precomputed with hann_window().
+/// @param data The array of short integers.
+/// @param length The length of the array (in int16_t-s, not in bytes).
+/// @param window The window coefficients (length float-s).
+/// @param res The windowed floating point results.
+INLINE NOTNULL(1, 3, 4) void int16_to_float_window(
+    const int16_t *data, size_t length, const float *window,
+    float *__restrict res) {
+  int ilength = (int)length;
+  for (int i = 0; i < ilength - 3; i += 4) {
+    int16x4_t intVec = vld1_s16(data + i);
+    float32x4_t floatVec = vcvtq_f32_s32(vmovl_s16(intVec));
+    vst1q_f32(res + i, vmulq_f32(floatVec, vld1q_f32(window + i)));
+  }
+  for (int i = (ilength & ~0x3); i < ilength; i++) {
+    res[i] = (float)data[i] * window[i];
+  }
+}
+
 INLINE NOTNULL(1, 3) void float_to_int16(const float *data,
                                          size_t length, int16_t *res) {
   int ilength = (int)length;
@@ -1037,6 +1967,33 @@ INLINE NOTNULL(1, 3) void float16_to_float(
   float16_to_float_na(data + offset, ilength - offset, res + offset);
 }
 
+#ifdef __ARM_FP16_FORMAT_IEEE
+
+/// @brief Converts an array of 32-bit floating point numbers to 16-bit
+/// floats, using NEON SIMD.
+/// @details Rounds to nearest even, matching float_to_float16_na().
+/// @param data The array of floating point numbers.
+/// @param length The length of the array (in float-s, not in bytes).
+/// @param res The float16 (uint16_t) array to write the results to.
+/// @note res must have at least the same length as data.
+INLINE NOTNULL(1, 3) void float_to_float16(
+    const float *data, size_t length, uint16_t *__restrict res) {
+  int ilength = (int)length;
+  int i;
+  for (i = 0; i < ilength - 3; i += 4) {
+    float32x4_t vec = vld1q_f32(data + i);
+    float16x4_t halfVec = vcvt_f16_f32(vec);
+    vst1_u16(res + i, vreinterpret_u16_f16(halfVec));
+  }
+  float_to_float16_na(data + i, ilength - i, res + i);
+}
+
+#else
+
+#define float_to_float16 float_to_float16_na
+
+#endif
+
 /// @brief Multiplies the contents of two vectors, saving the result to the
 /// third vector, using NEON SIMD (float version).
 /// @details res[i] = a[i] * b[i], i = 0..3.
@@ -1069,6 +2026,9 @@ INLINE NOTNULL(1, 2, 4) void real_multiply_array(
   }
 }
 
+// NEON has no gathers or masked stores, so the strided loop stays scalar.
+#define real_multiply_strided real_multiply_strided_na
+
 /// @brief Performs complex multiplication of the contents of two complex
 /// vectors, saving the result to the third vector, using NEON SIMD.
 /// @details res[i] = a[i] * b[i] - a[i + 1] * b[i + 1], i = 0, 2;
@@ -1090,6 +2050,31 @@ INLINE NOTNULL(1, 2, 3) void complex_multiply(
   vst1q_f32(res, resVec);
 }
 
+/// @brief Performs complex multiplication of the contents of two complex
+/// vectors and multiplies the products by a real constant, saving the result
+/// to the third vector, using NEON SIMD.
+/// @details Doing the scaling here fuses what would otherwise be a separate
+/// real_multiply_scalar() pass over the same buffer (e.g. the 1/N FFT
+/// normalization).
+/// @param a First vector.
+/// @param b Second vector.
+/// @param res Result vector.
+/// @param scale The constant every product is multiplied by.
+INLINE NOTNULL(1, 2, 3) void complex_multiply_scaled(
+    const float *a, const float *b, float *res, float scale) {
+  const float32x4_t negVec = { 1.0f, -1.0f, 1.0f, -1.0f };
+  float32x4_t Xvec = vld1q_f32(a);
+  float32x4_t Hvec = vld1q_f32(b);
+  float32x4_t Xrev = vrev64q_f32(Xvec);
+  float32x4_t fwdMul = vmulq_f32(Xvec, Hvec);
+  float32x4_t resIm = vmulq_f32(Hvec, Xrev);
+  float32x4_t negMul = vmulq_f32(fwdMul, negVec);
+  float32x4x2_t resPair = vtrnq_f32(negMul, resIm);
+  float32x4_t resVec = vaddq_f32(resPair.val[0], resPair.val[1]);
+  resVec = vmulq_n_f32(resVec, scale);
+  vst1q_f32(res, resVec);
+}
+
 /// @brief Performs complex multiplication of the contents of two complex
 /// vectors, saving the result to the third vector, using NEON SIMD (
 /// conjugate version).
@@ -1133,6 +2118,108 @@ INLINE NOTNULL(1, 3) void complex_conjugate(const float *array,
   }
 }
 
+/// @brief Performs complex multiplication of two complex vectors stored in
+/// split (planar) form, using NEON SIMD.
+/// @details res_re[i] = a_re[i] * b_re[i] - a_im[i] * b_im[i];
+/// res_im[i] = a_re[i] * b_im[i] + a_im[i] * b_re[i]. The planar layout
+/// needs none of the lane shuffles complex_multiply() spends on the
+/// interleaved pairs, so the whole loop is fused multiply-accumulates.
+/// @param a_re The real plane of the first vector.
+/// @param a_im The imaginary plane of the first vector.
+/// @param b_re The real plane of the second vector.
+/// @param b_im The imaginary plane of the second vector.
+/// @param length The length of each plane (in float-s, that is, in complex
+/// numbers).
+/// @param res_re The real plane of the result. May be a_re or b_re.
+/// @param res_im The imaginary plane of the result. May be a_im or b_im.
+INLINE NOTNULL(1, 2, 3, 4, 6, 7) void complex_multiply_split(
+    const float *a_re, const float *a_im,
+    const float *b_re, const float *b_im, size_t length,
+    float *res_re, float *res_im) {
+  int ilength = (int)length;
+  int j;
+  for (j = 0; j < ilength - 3; j += 4) {
+    float32x4_t are = vld1q_f32(a_re + j);
+    float32x4_t aim = vld1q_f32(a_im + j);
+    float32x4_t bre = vld1q_f32(b_re + j);
+    float32x4_t bim = vld1q_f32(b_im + j);
+    float32x4_t re = vmlsq_f32(vmulq_f32(are, bre), aim, bim);
+    float32x4_t im = vmlaq_f32(vmulq_f32(are, bim), aim, bre);
+    vst1q_f32(res_re + j, re);
+    vst1q_f32(res_im + j, im);
+  }
+  for (; j < ilength; j++) {
+    float re = a_re[j] * b_re[j] - a_im[j] * b_im[j];
+    float im = a_re[j] * b_im[j] + a_im[j] * b_re[j];
+    res_re[j] = re;
+    res_im[j] = im;
+  }
+}
+
+/// @brief Calculates complex conjugates of a vector stored in split
+/// (planar) form, using NEON SIMD.
+/// @details Only the imaginary plane is touched; the real plane of the
+/// conjugate is the original one.
+/// @param im The imaginary plane.
+/// @param length The length of the plane (in float-s, that is, in complex
+/// numbers).
+/// @param res_im The negated imaginary plane. May be im itself.
+INLINE NOTNULL(1, 3) void complex_conjugate_split(
+    const float *im, size_t length, float *res_im) {
+  int ilength = (int)length;
+  int j;
+  for (j = 0; j < ilength - 3; j += 4) {
+    vst1q_f32(res_im + j, vnegq_f32(vld1q_f32(im + j)));
+  }
+  for (; j < ilength; j++) {
+    res_im[j] = -im[j];
+  }
+}
+
+/// @brief Unpacks an interleaved complex vector into the split (planar)
+/// re/im form, using NEON SIMD.
+/// @param array The array of complex numbers (interleaved).
+/// @param length The length of the array (in float-s, not in bytes; even).
+/// @param re The real plane of length / 2 float-s.
+/// @param im The imaginary plane of length / 2 float-s.
+INLINE NOTNULL(1, 3, 4) void complex_deinterleave(
+    const float *array, size_t length, float *re, float *im) {
+  int icount = (int)(length / 2);
+  int j;
+  for (j = 0; j < icount - 3; j += 4) {
+    float32x4x2_t pair = vld2q_f32(array + j * 2);
+    vst1q_f32(re + j, pair.val[0]);
+    vst1q_f32(im + j, pair.val[1]);
+  }
+  for (; j < icount; j++) {
+    re[j] = array[j * 2];
+    im[j] = array[j * 2 + 1];
+  }
+}
+
+/// @brief Packs the split (planar) re/im planes back into an interleaved
+/// complex vector, using NEON SIMD.
+/// @param re The real plane of length / 2 float-s.
+/// @param im The imaginary plane of length / 2 float-s.
+/// @param length The length of the resulting array (in float-s, not in
+/// bytes; even).
+/// @param res The array of complex numbers (interleaved).
+INLINE NOTNULL(1, 2, 4) void complex_interleave(
+    const float *re, const float *im, size_t length, float *res) {
+  int icount = (int)(length / 2);
+  int j;
+  for (j = 0; j < icount - 3; j += 4) {
+    float32x4x2_t pair;
+    pair.val[0] = vld1q_f32(re + j);
+    pair.val[1] = vld1q_f32(im + j);
+    vst2q_f32(res + j * 2, pair);
+  }
+  for (; j < icount; j++) {
+    res[j * 2] = re[j];
+    res[j * 2 + 1] = im[j];
+  }
+}
+
 /// @brief Multiplies each floating point number in the specified array
 /// by the specified value, using NEON SIMD.
 /// @details This functions does the same thing as real_multiply_scalar_na, but
@@ -1157,27 +2244,72 @@ INLINE NOTNULL(1, 4) void real_multiply_scalar(const float *array,
 }
 
 /// @brief Sums all the elements of the array.
+/// @details Four independent accumulators hide the latency of the
+/// vector addition chain; the pairwise final reduction also keeps the
+/// rounding error growth at O(log length) instead of O(length).
 /// @param input The array which will be summed.
 /// @param length The size of the array (in float-s, not in bytes).
 /// @return The sum of all the elements in the array.
 INLINE NOTNULL(1) float sum_elements(const float *input, size_t length) {
   int ilength = (int)length;
-  float32x4_t accum = vdupq_n_f32(0.f);
-  for (int j = 0; j < ilength - 7; j += 8) {
-    float32x4_t vec1 = vld1q_f32(input + j);
-    float32x4_t vec2 = vld1q_f32(input + j + 4);
-    accum = vaddq_f32(accum, vec1);
-    accum = vaddq_f32(accum, vec2);
-  }
-  float32x2_t accum2 = vpadd_f32(vget_high_f32(accum),
-                                 vget_low_f32(accum));
-  float res = vget_lane_f32(accum2, 0) + vget_lane_f32(accum2, 1);
-  for (int j = (ilength & ~0x7); j < ilength; j++) {
+  float32x4_t accum1 = vdupq_n_f32(0.f);
+  float32x4_t accum2 = vdupq_n_f32(0.f);
+  float32x4_t accum3 = vdupq_n_f32(0.f);
+  float32x4_t accum4 = vdupq_n_f32(0.f);
+  for (int j = 0; j < ilength - 15; j += 16) {
+    accum1 = vaddq_f32(accum1, vld1q_f32(input + j));
+    accum2 = vaddq_f32(accum2, vld1q_f32(input + j + 4));
+    accum3 = vaddq_f32(accum3, vld1q_f32(input + j + 8));
+    accum4 = vaddq_f32(accum4, vld1q_f32(input + j + 12));
+  }
+  float32x4_t accum = vaddq_f32(vaddq_f32(accum1, accum2),
+                                vaddq_f32(accum3, accum4));
+  float32x2_t accum_2 = vpadd_f32(vget_high_f32(accum),
+                                  vget_low_f32(accum));
+  float res = vget_lane_f32(accum_2, 0) + vget_lane_f32(accum_2, 1);
+  for (int j = (ilength & ~0xF); j < ilength; j++) {
     res += input[j];
   }
   return res;
 }
 
+/// @brief Sums all the elements of the array with Kahan compensation,
+/// using NEON SIMD.
+/// @details Each of the four lanes carries its own compensation term,
+/// so the result is accurate to a few ulps regardless of the array
+/// length, at the cost of four times the arithmetic of sum_elements().
+/// @param input The array which will be summed.
+/// @param length The size of the array (in float-s, not in bytes).
+/// @return The sum of all the elements in the array.
+INLINE NOTNULL(1) float sum_elements_kahan(const float *input,
+                                           size_t length) {
+  int ilength = (int)length;
+  float32x4_t accum = vdupq_n_f32(0.f);
+  float32x4_t comp = vdupq_n_f32(0.f);
+  for (int j = 0; j < ilength - 3; j += 4) {
+    float32x4_t y = vsubq_f32(vld1q_f32(input + j), comp);
+    float32x4_t t = vaddq_f32(accum, y);
+    comp = vsubq_f32(vsubq_f32(t, accum), y);
+    accum = t;
+  }
+  float lanes[4];
+  vst1q_f32(lanes, accum);
+  float res = 0.f, scomp = 0.f;
+  for (int j = 0; j < 4; j++) {
+    float y = lanes[j] - scomp;
+    float t = res + y;
+    scomp = (t - res) - y;
+    res = t;
+  }
+  for (int j = (ilength & ~0x3); j < ilength; j++) {
+    float y = input[j] - scomp;
+    float t = res + y;
+    scomp = (t - res) - y;
+    res = t;
+  }
+  return res;
+}
+
 /// @brief Adds the same value to all elements in the array.
 /// @param input The array to sum with the specified value.
 /// @param length The size of the arrays (in float-s, not in bytes).
@@ -1200,23 +2332,90 @@ INLINE NOTNULL(1,4) void add_to_all(float *input, size_t length,
   }
 }
 
+/// @brief Multiplies the contents of two vectors elementwise and adds the
+/// third vector, saving the result to the fourth vector, using NEON SIMD.
+/// @details res[i] = a[i] * b[i] + c[i]. Fuses what would otherwise be a
+/// real_multiply_array() pass followed by a separate addition pass over
+/// the same buffer.
+/// @param a First vector.
+/// @param b Second vector.
+/// @param c The vector to add to the products.
+/// @param length The size of the vectors (in float-s, not in bytes).
+/// @param res Resulting array.
+INLINE NOTNULL(1, 2, 3, 5) void real_multiply_add(
+    const float *a, const float *b, const float *c, size_t length,
+    float *res) {
+  int j, ilength = length;
+  for (j = 0; j < ilength - 3; j += 4) {
+    float32x4_t aVec = vld1q_f32(a + j);
+    float32x4_t bVec = vld1q_f32(b + j);
+    float32x4_t cVec = vld1q_f32(c + j);
+    float32x4_t resVec = vmlaq_f32(cVec, aVec, bVec);
+    vst1q_f32(res + j, resVec);
+  }
+  for (; j < ilength; j++) {
+    res[j] = a[j] * b[j] + c[j];
+  }
+}
+
+/// @brief Calculates the dot product of two vectors, using NEON SIMD.
+/// @details Two independent accumulators are used to hide the latency
+/// of the multiply-accumulate chain, so no temporary product buffer and
+/// no separate sum_elements() pass are needed.
+/// @param a First vector.
+/// @param b Second vector.
+/// @param length The size of the vectors (in float-s, not in bytes).
+/// @return The sum of a[i] * b[i] over the vectors.
+INLINE NOTNULL(1, 2) float dot_product(const float *a, const float *b,
+                                       size_t length) {
+  int ilength = (int)length;
+  float32x4_t accum1 = vdupq_n_f32(0.f);
+  float32x4_t accum2 = vdupq_n_f32(0.f);
+  for (int j = 0; j < ilength - 7; j += 8) {
+    accum1 = vmlaq_f32(accum1, vld1q_f32(a + j), vld1q_f32(b + j));
+    accum2 = vmlaq_f32(accum2, vld1q_f32(a + j + 4), vld1q_f32(b + j + 4));
+  }
+  float32x4_t accum = vaddq_f32(accum1, accum2);
+  float32x2_t accum_2 = vpadd_f32(vget_high_f32(accum),
+                                  vget_low_f32(accum));
+  float res = vget_lane_f32(accum_2, 0) + vget_lane_f32(accum_2, 1);
+  for (int j = (ilength & ~0x7); j < ilength; j++) {
+    res += a[j] * b[j];
+  }
+  return res;
+}
+
 #else
 
 #define int16_to_float int16_to_float_na
+#define int16_to_float_window int16_to_float_window_na
 #define int32_to_float int32_to_float_na
 #define float_to_int16 float_to_int16_na
 #define float_to_int32 float_to_int32_na
 #define int32_to_int16 int32_to_int16_na
 #define int16_to_int32 int16_to_int32_na
+#define int16_add_saturated int16_add_saturated_na
+#define int16_sub_saturated int16_sub_saturated_na
+#define int16_multiply_scalar int16_multiply_scalar_na
 #define float16_to_float float16_to_float_na
+#define float_to_float16 float_to_float16_na
 #define real_multiply real_multiply_na
 #define real_multiply_array real_multiply_array_na
+#define real_multiply_strided real_multiply_strided_na
 #define complex_multiply complex_multiply_na
+#define complex_multiply_scaled complex_multiply_scaled_na
 #define complex_multiply_conjugate complex_multiply_conjugate_na
 #define complex_conjugate complex_conjugate_na
+#define complex_multiply_split complex_multiply_split_na
+#define complex_conjugate_split complex_conjugate_split_na
+#define complex_deinterleave complex_deinterleave_na
+#define complex_interleave complex_interleave_na
 #define real_multiply_scalar real_multiply_scalar_na
 #define sum_elements sum_elements_na
+#define sum_elements_kahan sum_elements_kahan_na
 #define add_to_all add_to_all_na
+#define real_multiply_add real_multiply_add_na
+#define dot_product dot_product_na
 
 #endif
 
@@ -1224,6 +2423,63 @@ INLINE NOTNULL(1,4) void add_to_all(float *input, size_t length,
  * Below are the functions without SIMD instructions.
  */
 
+INLINE NOTNULL(1) float sum_squares_na(const float *input, size_t length) {
+  float res = 0.f;
+  for (size_t j = 0; j < length; j++) {
+    res += input[j] * input[j];
+  }
+  return res;
+}
+
+/// @brief Sums the squares of all the elements of the array (the signal
+/// energy), without any temporary buffer.
+/// @details Fuses the real_multiply_array() + sum_elements() sequence into
+/// the single square-accumulate sweep of dot_product() with both operands
+/// pointing at the input.
+/// @param input The array which will be squared and summed.
+/// @param length The size of the array (in float-s, not in bytes).
+/// @return The sum of the squares of all the elements in the array.
+INLINE NOTNULL(1) float sum_squares(const float *input, size_t length) {
+  return dot_product(input, input, length);
+}
+
+/// @brief Rescales the signal to the requested root mean square amplitude
+/// in two sweeps and with no allocation.
+/// @details The first sweep measures the energy with sum_squares(), the
+/// second multiplies by the single correction factor; the squared temp and
+/// the third pass of the naive sum - square - rescale chain are gone. A
+/// signal of all zeros has no defined RMS and is copied through unchanged.
+/// @param simd Value indicating whether to use SIMD acceleration or not.
+/// @param input The signal.
+/// @param length The length of the signal (in float-s, not in bytes).
+/// @param target_rms The root mean square amplitude to rescale to (> 0).
+/// @param res The rescaled signal. May be input itself.
+INLINE NOTNULL(2, 5) void normalize_rms(int simd, const float *input,
+                                        size_t length, float target_rms,
+                                        float *res) {
+  assert(length > 0);
+  assert(target_rms > 0.f);
+  float energy = simd ? sum_squares(input, length)
+                      : sum_squares_na(input, length);
+  if (energy == 0.f) {
+    if (res != input) {
+      for (size_t i = 0; i < length; i++) {
+        res[i] = input[i];
+      }
+    }
+    return;
+  }
+  float scale = target_rms / sqrtf(energy / length);
+#ifdef SIMD
+  if (simd) {
+    real_multiply_scalar(input, length, scale, res);
+  } else
+#endif
+  {
+    real_multiply_scalar_na(input, length, scale, res);
+  }
+}
+
 INLINE int next_highest_power_of_2(int value) {
   value--;
   value |= value >> 1;
@@ -1234,6 +2490,20 @@ INLINE int next_highest_power_of_2(int value) {
   return ++value;
 }
 
+/// @brief Precomputes the symmetric Hann window for
+/// int16_to_float_window() and friends.
+/// @details Meant to be called once per frame size and cached by the
+/// caller, so it is deliberately scalar.
+/// @param length The length of the window (in float-s, not in bytes),
+/// >= 2.
+/// @param window The array the length coefficients are written to.
+INLINE NOTNULL(2) void hann_window(size_t length, float *window) {
+  const float pi = 3.14159265358979323846f;
+  for (size_t i = 0; i < length; i++) {
+    window[i] = 0.5f - 0.5f * cosf(2.0f * pi * i / (length - 1));
+  }
+}
+
 #pragma GCC diagnostic pop
 
 #endif  // INC_SIMD_ARITHMETIC_H_
@@ -0,0 +1,248 @@
+/*! @file arithmetic.hpp
+ *  @brief C++ wrappers specializing the arithmetic kernels on a
+ *  compile-time length.
+ *  @author Markovtsev Vadim <v.markovtsev@samsung.com>
+ *  @version 1.0
+ *
+ *  @section Notes
+ *  This code partially conforms to <a href="http://google-styleguide.googlecode.com/svn/trunk/cppguide.xml">Google C++ Style Guide</a>.
+ *
+ *  @section Copyright
+ *  Copyright © 2013 Samsung R&D Institute Russia
+ *
+ *  @section License
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#ifndef INC_SIMD_ARITHMETIC_HPP_
+#define INC_SIMD_ARITHMETIC_HPP_
+
+#ifndef __cplusplus
+#error This header requires a C++11 compiler; use simd/arithmetic.h from C.
+#endif
+
+#include <simd/arithmetic.h>
+#include <cstddef>
+#include <type_traits>
+
+/// @brief C++ twins of the arithmetic kernels taking the length as a
+/// template argument instead of a runtime size_t, e.g.
+/// simd::real_multiply<512>(a, b, res).
+/// @details When the length is a multiple of the SIMD width the emitted
+/// loop has a compile-time trip count and no tail handling at all, which
+/// lets the compiler unroll it fully for short fixed-size frames; other
+/// lengths fall back to the C kernels with the length constant-folded.
+namespace simd {
+
+/// @brief The number of float-s processed per SIMD step on this build.
+#ifdef __AVX__
+const size_t kVectorSize = 8;
+#elif defined(__ARM_NEON__)
+const size_t kVectorSize = 4;
+#else
+const size_t kVectorSize = 1;
+#endif
+
+/// @brief Multiplies two arrays of kLength float-s element-wise
+/// (see real_multiply_array()).
+template <size_t kLength>
+inline typename std::enable_if<kLength % kVectorSize == 0>::type
+real_multiply(const float *a, const float *b, float *res) {
+#ifdef __AVX__
+  for (size_t j = 0; j < kLength; j += 8) {
+    _mm256_storeu_ps(res + j, _mm256_mul_ps(_mm256_loadu_ps(a + j),
+                                            _mm256_loadu_ps(b + j)));
+  }
+#elif defined(__ARM_NEON__)
+  for (size_t j = 0; j < kLength; j += 4) {
+    vst1q_f32(res + j, vmulq_f32(vld1q_f32(a + j), vld1q_f32(b + j)));
+  }
+#else
+  for (size_t j = 0; j < kLength; j++) {
+    res[j] = a[j] * b[j];
+  }
+#endif
+}
+
+template <size_t kLength>
+inline typename std::enable_if<kLength % kVectorSize != 0>::type
+real_multiply(const float *a, const float *b, float *res) {
+  ::real_multiply_array(a, b, kLength, res);
+}
+
+/// @brief Multiplies an array of kLength float-s by a scalar
+/// (see real_multiply_scalar()).
+template <size_t kLength>
+inline typename std::enable_if<kLength % kVectorSize == 0>::type
+real_multiply_scalar(const float *array, float value, float *res) {
+#ifdef __AVX__
+  const __m256 mulVec = _mm256_set1_ps(value);
+  for (size_t j = 0; j < kLength; j += 8) {
+    _mm256_storeu_ps(res + j, _mm256_mul_ps(_mm256_loadu_ps(array + j),
+                                            mulVec));
+  }
+#elif defined(__ARM_NEON__)
+  for (size_t j = 0; j < kLength; j += 4) {
+    vst1q_f32(res + j, vmulq_n_f32(vld1q_f32(array + j), value));
+  }
+#else
+  for (size_t j = 0; j < kLength; j++) {
+    res[j] = array[j] * value;
+  }
+#endif
+}
+
+template <size_t kLength>
+inline typename std::enable_if<kLength % kVectorSize != 0>::type
+real_multiply_scalar(const float *array, float value, float *res) {
+  ::real_multiply_scalar(array, kLength, value, res);
+}
+
+/// @brief Calculates the dot product of two arrays of kLength float-s
+/// (see dot_product()). Four independent accumulators hide the add
+/// latency, exactly like the C kernel, but without the tail loop.
+template <size_t kLength>
+inline typename std::enable_if<kLength % (kVectorSize * 4) == 0,
+                               float>::type
+dot_product(const float *a, const float *b) {
+#ifdef __AVX__
+  __m256 accum1 = _mm256_setzero_ps();
+  __m256 accum2 = _mm256_setzero_ps();
+  __m256 accum3 = _mm256_setzero_ps();
+  __m256 accum4 = _mm256_setzero_ps();
+  for (size_t j = 0; j < kLength; j += 32) {
+    accum1 = _mm256_add_ps(accum1, _mm256_mul_ps(
+        _mm256_loadu_ps(a + j), _mm256_loadu_ps(b + j)));
+    accum2 = _mm256_add_ps(accum2, _mm256_mul_ps(
+        _mm256_loadu_ps(a + j + 8), _mm256_loadu_ps(b + j + 8)));
+    accum3 = _mm256_add_ps(accum3, _mm256_mul_ps(
+        _mm256_loadu_ps(a + j + 16), _mm256_loadu_ps(b + j + 16)));
+    accum4 = _mm256_add_ps(accum4, _mm256_mul_ps(
+        _mm256_loadu_ps(a + j + 24), _mm256_loadu_ps(b + j + 24)));
+  }
+  __m256 accum = _mm256_add_ps(_mm256_add_ps(accum1, accum2),
+                               _mm256_add_ps(accum3, accum4));
+  accum = _mm256_hadd_ps(accum, accum);
+  accum = _mm256_hadd_ps(accum, accum);
+  return _mm256_get_ps(accum, 0) + _mm256_get_ps(accum, 4);
+#elif defined(__ARM_NEON__)
+  float32x4_t accum1 = vdupq_n_f32(0.f);
+  float32x4_t accum2 = vdupq_n_f32(0.f);
+  float32x4_t accum3 = vdupq_n_f32(0.f);
+  float32x4_t accum4 = vdupq_n_f32(0.f);
+  for (size_t j = 0; j < kLength; j += 16) {
+    accum1 = vmlaq_f32(accum1, vld1q_f32(a + j), vld1q_f32(b + j));
+    accum2 = vmlaq_f32(accum2, vld1q_f32(a + j + 4), vld1q_f32(b + j + 4));
+    accum3 = vmlaq_f32(accum3, vld1q_f32(a + j + 8), vld1q_f32(b + j + 8));
+    accum4 = vmlaq_f32(accum4, vld1q_f32(a + j + 12),
+                       vld1q_f32(b + j + 12));
+  }
+  float32x4_t accum = vaddq_f32(vaddq_f32(accum1, accum2),
+                                vaddq_f32(accum3, accum4));
+  float32x2_t accum_2 = vpadd_f32(vget_high_f32(accum),
+                                  vget_low_f32(accum));
+  return vget_lane_f32(accum_2, 0) + vget_lane_f32(accum_2, 1);
+#else
+  float res = 0.f;
+  for (size_t j = 0; j < kLength; j++) {
+    res += a[j] * b[j];
+  }
+  return res;
+#endif
+}
+
+template <size_t kLength>
+inline typename std::enable_if<kLength % (kVectorSize * 4) != 0,
+                               float>::type
+dot_product(const float *a, const float *b) {
+  return ::dot_product(a, b, kLength);
+}
+
+/// @brief Sums the elements of an array of kLength float-s
+/// (see sum_elements()).
+template <size_t kLength>
+inline typename std::enable_if<kLength % (kVectorSize * 4) == 0,
+                               float>::type
+sum_elements(const float *input) {
+#ifdef __AVX__
+  __m256 accum1 = _mm256_setzero_ps();
+  __m256 accum2 = _mm256_setzero_ps();
+  __m256 accum3 = _mm256_setzero_ps();
+  __m256 accum4 = _mm256_setzero_ps();
+  for (size_t j = 0; j < kLength; j += 32) {
+    accum1 = _mm256_add_ps(accum1, _mm256_loadu_ps(input + j));
+    accum2 = _mm256_add_ps(accum2, _mm256_loadu_ps(input + j + 8));
+    accum3 = _mm256_add_ps(accum3, _mm256_loadu_ps(input + j + 16));
+    accum4 = _mm256_add_ps(accum4, _mm256_loadu_ps(input + j + 24));
+  }
+  __m256 accum = _mm256_add_ps(_mm256_add_ps(accum1, accum2),
+                               _mm256_add_ps(accum3, accum4));
+  accum = _mm256_hadd_ps(accum, accum);
+  accum = _mm256_hadd_ps(accum, accum);
+  return _mm256_get_ps(accum, 0) + _mm256_get_ps(accum, 4);
+#elif defined(__ARM_NEON__)
+  float32x4_t accum1 = vdupq_n_f32(0.f);
+  float32x4_t accum2 = vdupq_n_f32(0.f);
+  float32x4_t accum3 = vdupq_n_f32(0.f);
+  float32x4_t accum4 = vdupq_n_f32(0.f);
+  for (size_t j = 0; j < kLength; j += 16) {
+    accum1 = vaddq_f32(accum1, vld1q_f32(input + j));
+    accum2 = vaddq_f32(accum2, vld1q_f32(input + j + 4));
+    accum3 = vaddq_f32(accum3, vld1q_f32(input + j + 8));
+    accum4 = vaddq_f32(accum4, vld1q_f32(input + j + 12));
+  }
+  float32x4_t accum = vaddq_f32(vaddq_f32(accum1, accum2),
+                                vaddq_f32(accum3, accum4));
+  float32x2_t accum_2 = vpadd_f32(vget_high_f32(accum),
+                                  vget_low_f32(accum));
+  return vget_lane_f32(accum_2, 0) + vget_lane_f32(accum_2, 1);
+#else
+  float res = 0.f;
+  for (size_t j = 0; j < kLength; j++) {
+    res += input[j];
+  }
+  return res;
+#endif
+}
+
+template <size_t kLength>
+inline typename std::enable_if<kLength % (kVectorSize * 4) != 0,
+                               float>::type
+sum_elements(const float *input) {
+  return ::sum_elements(input, kLength);
+}
+
+/// @brief Converts kLength int16_t-s to float-s (see int16_to_float()).
+/// The conversion kernels only forward to the C ones: the constant length
+/// still folds the trip count, and the alignment handling stays in one
+/// place.
+template <size_t kLength>
+inline void int16_to_float(const int16_t *data, float *res) {
+  ::int16_to_float_na(data, kLength, res);
+}
+
+/// @brief Converts kLength float-s to int16_t-s with saturation
+/// (see float_to_int16()).
+template <size_t kLength>
+inline void float_to_int16(const float *data, int16_t *res) {
+  ::float_to_int16_na(data, kLength, res);
+}
+
+}  // namespace simd
+
+#endif  // INC_SIMD_ARITHMETIC_HPP_
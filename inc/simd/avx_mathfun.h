@@ -152,6 +152,14 @@ AVX2_INTOP_USING_SSE2(cmpeq_epi32)
 AVX2_INTOP_USING_SSE2(sub_epi32)
 AVX2_INTOP_USING_SSE2(add_epi32)
 
+#else
+
+/* With real AVX2 the si128-suffixed names used below map straight onto the
+   native 256-bit integer intrinsics, so no lane splitting is involved.
+   The shift and epi32 operations already carry their native names. */
+#define _mm256_and_si128 _mm256_and_si256
+#define _mm256_andnot_si128 _mm256_andnot_si256
+
 #endif /* __AVX2__ */
 
 
@@ -724,6 +732,68 @@ static inline v8sf pow256_ps(v8sf y, v8sf x) {
   return ret;
 }
 
+_PS256_CONST(atan_p0, 0.99997726f);
+_PS256_CONST(atan_p1, -0.33262347f);
+_PS256_CONST(atan_p2, 0.19354346f);
+_PS256_CONST(atan_p3, -0.11643287f);
+_PS256_CONST(atan_p4, 0.05265332f);
+_PS256_CONST(atan_p5, -0.01172120f);
+_PS256_CONST(pi, 3.14159265358979f);
+_PS256_CONST(pi_over_2, 1.57079632679490f);
+
+/// @brief Calculates atan2(y, x) for 8 simultaneous floats.
+/// @details The octant is reduced with min/max so the polynomial argument
+/// stays in [0, 1]; accurate to about 1e-6 radian. atan2(0, -0.f) returns
+/// 0 instead of pi.
+static inline v8sf atan2_256_ps(v8sf y, v8sf x) {
+  v8sf sign_mask = *(v8sf*)_ps256_sign_mask;
+  v8sf abs_y = _mm256_andnot_ps(sign_mask, y);
+  v8sf abs_x = _mm256_andnot_ps(sign_mask, x);
+  v8sf mx = _mm256_max_ps(abs_x, abs_y);
+  v8sf mn = _mm256_min_ps(abs_x, abs_y);
+  v8sf t = _mm256_div_ps(mn, mx);
+  /* zero the 0/0 lanes so atan2(0, 0) comes out as 0 */
+  t = _mm256_and_ps(t, _mm256_cmp_ps(mx, _mm256_setzero_ps(), _CMP_NEQ_OQ));
+  v8sf q = _mm256_mul_ps(t, t);
+  v8sf a = *(v8sf*)_ps256_atan_p5;
+  a = _mm256_add_ps(_mm256_mul_ps(a, q), *(v8sf*)_ps256_atan_p4);
+  a = _mm256_add_ps(_mm256_mul_ps(a, q), *(v8sf*)_ps256_atan_p3);
+  a = _mm256_add_ps(_mm256_mul_ps(a, q), *(v8sf*)_ps256_atan_p2);
+  a = _mm256_add_ps(_mm256_mul_ps(a, q), *(v8sf*)_ps256_atan_p1);
+  a = _mm256_add_ps(_mm256_mul_ps(a, q), *(v8sf*)_ps256_atan_p0);
+  a = _mm256_mul_ps(a, t);
+  /* undo the reduction: mirror across pi/4 and across the y axis */
+  v8sf mask = _mm256_cmp_ps(abs_y, abs_x, _CMP_GT_OQ);
+  a = _mm256_blendv_ps(a, _mm256_sub_ps(*(v8sf*)_ps256_pi_over_2, a), mask);
+  mask = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ);
+  a = _mm256_blendv_ps(a, _mm256_sub_ps(*(v8sf*)_ps256_pi, a), mask);
+  /* the result lies in [0, pi]; transfer the sign of y */
+  return _mm256_or_ps(a, _mm256_and_ps(sign_mask, y));
+}
+
+/// @brief Calculates sqrt(x^2 + y^2) for 8 simultaneous floats.
+/// @details No overflow protection: the squares must stay finite.
+static inline v8sf hypot256_ps(v8sf x, v8sf y) {
+  return _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(x, x),
+                                      _mm256_mul_ps(y, y)));
+}
+
+/// @brief Calculates the hyperbolic tangent as
+/// (e^2x - 1) / (e^2x + 1); exp256_ps saturates its argument, so large
+/// inputs come out as exactly +-1 instead of nan.
+static inline v8sf tanh256_ps(v8sf x) {
+  v8sf one = *(v8sf*)_ps256_1;
+  v8sf e = exp256_ps(_mm256_add_ps(x, x));
+  return _mm256_div_ps(_mm256_sub_ps(e, one), _mm256_add_ps(e, one));
+}
+
+/// @brief Calculates the logistic function 1 / (1 + e^-x).
+static inline v8sf sigmoid256_ps(v8sf x) {
+  v8sf one = *(v8sf*)_ps256_1;
+  v8sf e = exp256_ps(_mm256_sub_ps(_mm256_setzero_ps(), x));
+  return _mm256_div_ps(one, _mm256_add_ps(e, one));
+}
+
 #pragma GCC diagnostic pop
 
 #endif // INC_SIMD_AVX_MATHFUN_H_
@@ -32,14 +32,40 @@
 #define INC_SIMD_CONVOLVE_H_
 
 #include <stddef.h>
+#include <stdint.h>
 #include <simd/common.h>
 #include <simd/attributes.h>
 #include <simd/convolve_structs.h>
+#include <simd/detect_peaks.h>
 
 SIMD_API_BEGIN
 
 typedef struct ConvolutionFFTHandle ConvolutionFFTHandle;
 
+/// @brief Sets the FFT backend and planning effort every following FFT
+/// based initializer in convolve.h and correlate.h uses. The initial
+/// value ({ -1, CONVOLUTION_FFT_PLANNING_DEFAULT }) keeps the historic
+/// behavior: the active backend plans its default way.
+void convolve_fft_set_options(ConvolutionFFTOptions options);
+
+/// @brief Returns the options set with convolve_fft_set_options().
+ConvolutionFFTOptions convolve_fft_get_options(void);
+
+/// @brief Saves the accumulated plan wisdom to a file, so a later run can
+/// convolve_wisdom_load() it and initialize in milliseconds instead of
+/// re-planning. Pays off most after initializing the production handle
+/// sizes with CONVOLUTION_FFT_PLANNING_EXHAUSTIVE once offline.
+/// @return Nonzero on success, zero when the active backend keeps no
+/// wisdom (only FFTW does) or the file could not be written.
+int convolve_wisdom_save(const char *path) NOTNULL(1);
+
+/// @brief Loads plan wisdom previously saved with convolve_wisdom_save();
+/// the following initializers then reuse the recorded plans instead of
+/// searching again.
+/// @return Nonzero on success, zero when the active backend keeps no
+/// wisdom or the file could not be read.
+int convolve_wisdom_load(const char *path) NOTNULL(1);
+
 /// @brief Prepares for the calculation of linear convolution of two signals
 /// using the FFT method.
 /// @param xLength The length of the first array in float-s.
@@ -47,6 +73,11 @@ typedef struct ConvolutionFFTHandle ConvolutionFFTHandle;
 /// @return The handle for convolve_fft().
 ConvolutionFFTHandle convolve_fft_initialize(size_t xLength, size_t hLength);
 
+/// @brief The same as convolve_fft_initialize(), planning with the given
+/// options instead of the process-wide ones.
+ConvolutionFFTHandle convolve_fft_initialize_options(
+    size_t xLength, size_t hLength, ConvolutionFFTOptions options);
+
 /// @brief Calculates the linear convolution of two signals using
 /// the FFT method.
 /// @param handle The structure obtained from convolve_fft_initialize().
@@ -62,6 +93,36 @@ void convolve_fft(ConvolutionFFTHandle handle,
 /// @param handle The structure obtained from convolve_fft_initialize().
 void convolve_fft_finalize(ConvolutionFFTHandle handle);
 
+/// @brief Prepares for the calculation of linear convolution of two signals
+/// using the FFT method, working in-place on the caller's buffers and thus
+/// avoiding the staging memcpy() done by convolve_fft().
+/// @param xLength The length of the first signal in float-s.
+/// @param hLength The length of the second signal in float-s.
+/// @param x The buffer holding the first signal. It must be allocated with
+/// mallocf()/zeropadding() and hold at least M + 2 float-s, where M is the
+/// power of 2 which is greater than or equal to xLength + hLength - 1;
+/// everything beyond xLength must be set to zero. zeropaddingex(x, xLength,
+/// &newLength, 2) satisfies this contract since hLength <= xLength.
+/// @param h The buffer holding the second signal, with the same allocation
+/// and padding contract (beyond hLength).
+/// @return The handle for convolve_fft_inplace().
+ConvolutionFFTHandle convolve_fft_inplace_initialize(
+    size_t xLength, size_t hLength, float *x, float *h) NOTNULL(3, 4);
+
+/// @brief Calculates the linear convolution of the two signals bound by
+/// convolve_fft_inplace_initialize(), transforming them in-place.
+/// @param handle The structure obtained from convolve_fft_inplace_initialize().
+/// @param result The resulting signal of length xLength + hLength - 1.
+/// @note The contents of both bound buffers are destroyed; refill x and h
+/// (including the zero padding) before calling this function again.
+void convolve_fft_inplace(ConvolutionFFTHandle handle,
+                          float *result) NOTNULL(2);
+
+/// @brief Frees any resources allocated by convolve_fft_inplace_initialize().
+/// The bound buffers stay owned by the caller and are left intact.
+/// @param handle The structure obtained from convolve_fft_inplace_initialize().
+void convolve_fft_inplace_finalize(ConvolutionFFTHandle handle);
+
 typedef struct ConvolutionOverlapSaveHandle ConvolutionOverlapSaveHandle;
 
 /// @brief Prepares for the calculation of linear convolution of two signals
@@ -72,6 +133,17 @@ typedef struct ConvolutionOverlapSaveHandle ConvolutionOverlapSaveHandle;
 ConvolutionOverlapSaveHandle convolve_overlap_save_initialize(
     size_t xLength, size_t hLength);
 
+/// @brief Acts like convolve_overlap_save_initialize(), but additionally
+/// prepares for processing the FFT blocks with the specified number of
+/// threads, each owning its own scratch buffer and FFT plans.
+/// @param xLength The length of the first array in float-s.
+/// @param hLength The length of the second array in float-s.
+/// @param threads The number of worker threads convolve_overlap_save()
+/// fans the blocks out to; values <= 1 keep the sequential behavior.
+/// @return The handle for convolve_overlap_save().
+ConvolutionOverlapSaveHandle convolve_overlap_save_initialize_threads(
+    size_t xLength, size_t hLength, int threads);
+
 /// @brief Calculates the linear convolution of two signals using
 /// the overlap-save method.
 /// @param handle The structure obtained from convolve_overlap_save_initialize().
@@ -88,6 +160,39 @@ void convolve_overlap_save(ConvolutionOverlapSaveHandle handle,
 /// @param handle The structure obtained from convolve_overlap_save_initialize().
 void convolve_overlap_save_finalize(ConvolutionOverlapSaveHandle handle);
 
+/// @brief Calculates the position and the value of the maximum of the linear
+/// convolution of two signals, without materializing the convolution itself.
+/// @details Each overlap-save block is scanned right after it is produced,
+/// while it is still in cache, so no xLength + hLength - 1 result array is
+/// written and re-read.
+/// @param handle The structure obtained from convolve_overlap_save_initialize().
+/// @param x The first signal (long one).
+/// @param h The second signal (short one).
+/// @param position The index of the maximum in the virtual result.
+/// @param value The value of the maximum.
+void convolve_overlap_save_argmax(ConvolutionOverlapSaveHandle handle,
+                                  const float *x, const float *h,
+                                  int *position,
+                                  float *value) NOTNULL(2, 3, 4, 5);
+
+/// @brief Extracts the extrema of the linear convolution of two signals,
+/// without materializing the convolution itself.
+/// @details Works like detect_peaks() run over the convolution result, but
+/// scans each overlap-save block while it is still in cache.
+/// @param handle The structure obtained from convolve_overlap_save_initialize().
+/// @param x The first signal (long one).
+/// @param h The second signal (short one).
+/// @param type The type of the extracted extrema.
+/// @param results The pointer to the array of ExtremumPoint-s. That array
+/// will be allocated with malloc(), so it should be disposed with free()
+/// after it's been used. If no points are found, it is set to NULL.
+/// @param resultsLength The number of found extremum points.
+void convolve_overlap_save_peaks(ConvolutionOverlapSaveHandle handle,
+                                 const float *x, const float *h,
+                                 ExtremumType type,
+                                 ExtremumPoint **results,
+                                 size_t *resultsLength) NOTNULL(2, 3, 5, 6);
+
 /// @brief Calculates the linear convolution of two signals using
 /// the "brute force" method.
 /// @param simd Value indicating whether to use SIMD acceleration or not.
@@ -101,6 +206,147 @@ void convolve_simd(int simd,
                    const float *__restrict h, size_t hLength,
                    float *__restrict result) NOTNULL(2, 4, 6);
 
+/// @brief Calculates the linear convolution of a signal with a symmetric
+/// (linear phase) filter using the "brute force" method.
+/// @details Exploits h[m] == h[hLength - 1 - m]: wherever every tap is
+/// inside x, the two samples sharing a coefficient are added before the
+/// multiply, halving the multiplies and reading only the first half of h.
+/// The result is identical to convolve_simd() up to the usual float
+/// reassociation noise.
+/// @param simd Value indicating whether to use SIMD acceleration or not.
+/// @param x The first signal (long one).
+/// @param xLength The length of the first array in float-s.
+/// @param h The second signal (short one). Must be symmetric.
+/// @param hLength The length of the second array in float-s.
+/// @param result The resulting signal of length xLength.
+void convolve_simd_symmetric(int simd,
+                             const float *__restrict x, size_t xLength,
+                             const float *__restrict h, size_t hLength,
+                             float *__restrict result) NOTNULL(2, 4, 6);
+
+/// @brief Extracts the sparse representation (tap index + value lists) of
+/// a mostly zero filter, such as a comb or multi-echo impulse response.
+/// @param h The dense filter of length hLength.
+/// @param hLength The length of the filter in float-s.
+/// @param indices Receives the ascending positions of the nonzero taps.
+/// Must have room for hLength entries in the worst (fully dense) case.
+/// @param values Receives the coefficients of the nonzero taps. Must have
+/// room for hLength entries in the worst (fully dense) case.
+/// @return The number of nonzero taps written to indices and values.
+size_t convolve_sparse_extract(const float *h, size_t hLength,
+                               size_t *indices, float *values)
+    NOTNULL(1, 3, 4);
+
+/// @brief Calculates the linear convolution of a signal with a sparse
+/// filter given as tap index + value lists (see convolve_sparse_extract()).
+/// @details Every live tap adds one scaled copy of x shifted by its index,
+/// so the arithmetic scales with the number of nonzero taps instead of the
+/// filter span - for a 4000-sample comb with 40 taps that is a 100x
+/// reduction over convolve_simd(), and below roughly 1/64 density it beats
+/// the FFT path too.
+/// @param simd Value indicating whether to use SIMD acceleration or not.
+/// @param x The first signal (long one).
+/// @param xLength The length of the first array in float-s.
+/// @param indices The ascending positions of the nonzero taps, all less
+/// than hLength.
+/// @param values The coefficients of the nonzero taps.
+/// @param taps The number of entries in indices and values.
+/// @param hLength The dense span of the filter in float-s (the largest
+/// tap index plus one, or more).
+/// @param result The resulting signal of length xLength + hLength - 1.
+void convolve_sparse(int simd,
+                     const float *__restrict x, size_t xLength,
+                     const size_t *__restrict indices,
+                     const float *__restrict values, size_t taps,
+                     size_t hLength,
+                     float *__restrict result) NOTNULL(2, 4, 5, 8);
+
+typedef struct ConvolutionStreamHandle ConvolutionStreamHandle;
+
+/// @brief Prepares for the streaming calculation of the linear convolution
+/// of an unbounded signal fed in fixed size blocks, using the overlap-save
+/// method with the carry state kept inside the handle.
+/// @param h The filter of length hLength. It is transformed once here.
+/// @param hLength The length of the filter in float-s.
+/// @param blockSize The length of every block passed to
+/// convolve_stream_feed(), in float-s.
+/// @return The handle for convolve_stream_feed().
+ConvolutionStreamHandle convolve_stream_initialize(
+    const float *h, size_t hLength, size_t blockSize) NOTNULL(1);
+
+/// @brief Convolves the next blockSize samples of the streamed signal,
+/// continuing from the state left by the previous call.
+/// @param handle The structure obtained from convolve_stream_initialize().
+/// @param block The next blockSize samples of the signal.
+/// @param result The next blockSize samples of the convolution.
+/// @note To drain the last hLength - 1 samples of the convolution tail,
+/// feed blocks of zeros after the signal has ended.
+void convolve_stream_feed(ConvolutionStreamHandle handle,
+                          const float *block,
+                          float *result) NOTNULL(2, 3);
+
+/// @brief Frees any resources allocated by convolve_stream_initialize().
+/// @param handle The structure obtained from convolve_stream_initialize().
+void convolve_stream_finalize(ConvolutionStreamHandle handle);
+
+typedef struct ConvolutionBatchHandle ConvolutionBatchHandle;
+
+/// @brief Prepares for the calculation of linear convolutions of many signals
+/// with the same filter using the FFT method and batched transforms.
+/// @param xLength The length of each signal in float-s.
+/// @param hLength The length of the filter in float-s.
+/// @param batchSize The number of signals convolved per convolve_batch() call.
+/// @return The handle for convolve_batch().
+ConvolutionBatchHandle convolve_batch_initialize(size_t xLength,
+                                                 size_t hLength,
+                                                 size_t batchSize);
+
+/// @brief Calculates the linear convolutions of batchSize signals with
+/// the same filter, sharing one plan and transforming the filter only once.
+/// @param handle The structure obtained from convolve_batch_initialize().
+/// @param x The signals, stored contiguously (batchSize blocks of
+/// xLength float-s each).
+/// @param h The filter of length hLength.
+/// @param result The resulting signals, stored contiguously (batchSize
+/// blocks of (xLength + hLength - 1) float-s each).
+void convolve_batch(ConvolutionBatchHandle handle,
+                    const float *x, const float *h,
+                    float *result) NOTNULL(2, 3, 4);
+
+/// @brief Frees any resources allocated by convolve_batch_initialize().
+/// @param handle The structure obtained from convolve_batch_initialize().
+void convolve_batch_finalize(ConvolutionBatchHandle handle);
+
+/// @brief Calculates the linear convolution of two int16_t signals using
+/// the "brute force" method with int32_t accumulation, so raw fixed-point
+/// data (e.g. from an ADC) needs no int16_to_float() conversion.
+/// @param simd Value indicating whether to use SIMD acceleration or not.
+/// @param x The first signal (long one).
+/// @param xLength The length of the first array in int16_t-s.
+/// @param h The second signal (short one).
+/// @param hLength The length of the second array in int16_t-s.
+/// @param result The resulting signal of length xLength + hLength - 1.
+void convolve_simd_i16(int simd,
+                       const int16_t *__restrict x, size_t xLength,
+                       const int16_t *__restrict h, size_t hLength,
+                       int32_t *__restrict result) NOTNULL(2, 4, 6);
+
+/// @brief Calculates the linear convolution of two double precision signals
+/// using the "brute force" method.
+/// @details The underlying FFT library works in single precision only, so
+/// this is the variant to use when float accumulation is not enough (very
+/// long signals); it keeps four SIMD lanes instead of dropping to scalar.
+/// @param simd Value indicating whether to use SIMD acceleration or not.
+/// @param x The first signal (long one).
+/// @param xLength The length of the first array in double-s.
+/// @param h The second signal (short one).
+/// @param hLength The length of the second array in double-s.
+/// @param result The resulting signal of length xLength + hLength - 1.
+void convolve_simd_f64(int simd,
+                       const double *__restrict x, size_t xLength,
+                       const double *__restrict h, size_t hLength,
+                       double *__restrict result) NOTNULL(2, 4, 6);
+
 typedef struct ConvolutionHandle ConvolutionHandle;
 
 /// @brief Prepares for the calculation of linear convolution of two signals
@@ -110,6 +356,17 @@ typedef struct ConvolutionHandle ConvolutionHandle;
 /// @return The handle for convolve().
 ConvolutionHandle convolve_initialize(size_t xLength, size_t hLength);
 
+/// @brief The same as convolve_initialize(), declaring that h will be
+/// symmetric (linear phase).
+/// @details When the brute force method is chosen, convolve() then folds
+/// the mirrored taps with convolve_simd_symmetric(); the FFT based methods
+/// gain nothing from symmetry and behave as usual.
+/// @param xLength The length of the first array in float-s.
+/// @param hLength The length of the second array in float-s.
+/// @return The handle for convolve().
+ConvolutionHandle convolve_initialize_symmetric(size_t xLength,
+                                                size_t hLength);
+
 /// @brief Calculates the linear convolution of two signals using
 /// the best method.
 /// @param handle The structure obtained from convolve_initialize().
@@ -124,6 +381,41 @@ void convolve(ConvolutionHandle handle,
 /// @param handle The structure obtained from convolve_overlap_initialize().
 void convolve_finalize(ConvolutionHandle handle);
 
+/// @brief Activates or deactivates the plan cache used by
+/// convolve_initialize().
+/// @param value Value indicating whether the cache is active.
+/// @details When the cache is active, convolve_initialize() returns a
+/// reference counted handle shared between all the callers which request
+/// the same (xLength, hLength) pair, so FFT planning and scratch allocation
+/// happen only on the first call. convolve_finalize() then only decrements
+/// the reference count; the actual resources are freed by
+/// convolve_cache_clear(). The cache itself is thread-safe, but a shared
+/// handle must not be used from several threads at the same time since
+/// the underlying scratch buffers are shared too. Toggling the flag only
+/// affects handles created afterwards: every handle records its cache
+/// membership at initialize time and convolve_finalize() honors that
+/// record, not the current flag.
+void convolve_cache_enable(int value);
+
+/// @brief Destroys all the handles accumulated by the plan cache.
+void convolve_cache_clear(void);
+
+/// @brief Measures the brute force / FFT / overlap-save crossover points on
+/// the running host and installs them for convolve_initialize().
+/// @details This runs a one-time microbenchmark taking a fraction of a
+/// second. To avoid paying that on every startup, fetch the resulting
+/// table with convolve_tuning_get(), persist it, and restore it with
+/// convolve_tuning_set() instead.
+void convolve_tune(void);
+
+/// @brief Returns the algorithm crossover table currently consulted by
+/// convolve_initialize().
+ConvolutionTuning convolve_tuning_get(void);
+
+/// @brief Installs an algorithm crossover table, e.g. one previously
+/// measured with convolve_tune() and persisted by the caller.
+void convolve_tuning_set(ConvolutionTuning tuning);
+
 SIMD_API_END
 
 #endif  // INC_SIMD_CONVOLVE_H_
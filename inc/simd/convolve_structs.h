@@ -33,9 +33,42 @@
 
 #include <stddef.h>
 #include <simd/common.h>
+#include <simd/memory.h>
 
 SIMD_API_BEGIN
 
+/// @brief How much effort the FFT backend spends searching for a fast
+/// plan when an FFT based handle is initialized. Only backends which
+/// time candidate plans (FFTW) distinguish the levels; the others create
+/// the same plan regardless.
+typedef enum {
+  /// Whatever the active backend does by default.
+  CONVOLUTION_FFT_PLANNING_DEFAULT = 0,
+  /// The cheapest plan creation: pick a plan heuristically without
+  /// running anything. Best when the handle lives for a few calls only.
+  CONVOLUTION_FFT_PLANNING_ESTIMATE,
+  /// Time a number of candidate plans and keep the fastest.
+  CONVOLUTION_FFT_PLANNING_MEASURE,
+  /// Try every known algorithm. Takes seconds to minutes; meant for
+  /// offline planning together with convolve_wisdom_save().
+  CONVOLUTION_FFT_PLANNING_EXHAUSTIVE
+} ConvolutionFFTPlanning;
+
+/// @brief The FFT planning options consulted by every FFT based
+/// initializer in convolve.h and correlate.h.
+typedef struct {
+  /// The FFTF backend to activate before planning (an FFTFBackendId
+  /// value from <fftf/api.h>), or -1 to keep the current one.
+  int backend;
+  /// The planning effort to spend.
+  ConvolutionFFTPlanning planning;
+} ConvolutionFFTOptions;
+
+/// @brief Internal: applies the backend selection of the current options
+/// and returns the options word to pass to fftf_init(). The initializers
+/// in convolve.c and correlate.c call this; it is not meant for users.
+int convolve_fft_plan_options(void);
+
 struct ConvolutionOverlapSaveHandle {
   void *fft_plan;
   void *fft_inverse_plan;
@@ -45,6 +78,10 @@ struct ConvolutionOverlapSaveHandle {
   size_t h_length;
   int *L;
   int reverse;
+  int threads;
+  float **thread_scratches;
+  void **thread_fft_plans;
+  void **thread_fft_inverse_plans;
 };
 
 struct ConvolutionFFTHandle {
@@ -55,6 +92,44 @@ struct ConvolutionFFTHandle {
   int h_length;
   float **inputs;
   int reverse;
+  SimdArena arena;
+};
+
+struct ConvolutionStreamHandle {
+  void *fft_plan;
+  void *fft_inverse_plan;
+  float *fft_boiler_plate;
+  float *H;
+  float *carry;
+  size_t h_length;
+  size_t block_size;
+  int *L;
+};
+
+struct ConvolutionBatchHandle {
+  void *fft_plan;
+  void *fft_inverse_plan;
+  void *fft_filter_plan;
+  int *M;
+  int x_length;
+  int h_length;
+  int batch_size;
+  float **inputs;
+  float *H;
+  int reverse;
+};
+
+struct CrossCorrelationFFTMultiHandle {
+  void *fft_plan;
+  void *fft_inverse_plan;
+  float *X;
+  float *work;
+  float *H;
+  int *M;
+  int x_length;
+  int h_length;
+  int template_count;
+  SimdArena arena;
 };
 
 typedef enum {
@@ -63,10 +138,29 @@ typedef enum {
   kConvolutionAlgorithmOverlapSave
 } ConvolutionAlgorithm;
 
+/// @brief Algorithm crossover points consulted by convolve_initialize().
+/// The values can be measured on the running host with convolve_tune() and
+/// persisted by the caller (the struct is plain data) to keep startup fast.
+typedef struct {
+  /// Minimal xLength for overlap-save when xLength > 2 * hLength.
+  int overlap_save_threshold;
+  /// Minimal xLength for the plain FFT method otherwise.
+  int fft_threshold;
+} ConvolutionTuning;
+
 struct ConvolutionHandle {
   ConvolutionAlgorithm algorithm;
   int x_length;
   int h_length;
+  /// Non-zero when h is symmetric (linear phase); the brute force path
+  /// then folds the mirrored taps (see convolve_initialize_symmetric()).
+  int symmetric;
+  /// Non-zero when the handle is owned by the plan cache (see
+  /// convolve_cache_enable()); convolve_finalize() then only drops the
+  /// entry's reference instead of destroying the shared plans. Recorded
+  /// at initialize time, so the pairing survives toggling the cache
+  /// while handles are live.
+  int cached;
   union {
     struct ConvolutionFFTHandle fft;
     struct ConvolutionOverlapSaveHandle os;
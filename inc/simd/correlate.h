@@ -35,6 +35,7 @@
 #include <simd/common.h>
 #include <simd/attributes.h>
 #include <simd/convolve_structs.h>
+#include <simd/detect_peaks.h>
 
 SIMD_API_BEGIN
 
@@ -48,6 +49,12 @@ typedef struct ConvolutionFFTHandle CrossCorrelationFFTHandle;
 CrossCorrelationFFTHandle cross_correlate_fft_initialize(size_t xLength,
                                                          size_t hLength);
 
+/// @brief The same as cross_correlate_fft_initialize(), planning with the
+/// given options (see convolve_fft_set_options()) instead of the
+/// process-wide ones.
+CrossCorrelationFFTHandle cross_correlate_fft_initialize_options(
+    size_t xLength, size_t hLength, ConvolutionFFTOptions options);
+
 /// @brief Calculates the cross-correlation of two signals using
 /// the FFT method.
 /// @param handle The structure obtained from cross_correlate_fft_initialize().
@@ -63,6 +70,42 @@ void cross_correlate_fft(CrossCorrelationFFTHandle handle,
 /// @param handle The structure obtained from cross_correlate_fft_initialize().
 void cross_correlate_fft_finalize(CrossCorrelationFFTHandle handle);
 
+typedef struct CrossCorrelationFFTMultiHandle CrossCorrelationFFTMultiHandle;
+
+/// @brief Prepares for the calculation of cross-correlation of a signal
+/// with many templates using the FFT method, caching the template spectra.
+/// @details Each template is transformed once here; every
+/// cross_correlate_fft_multi() call then runs only one forward transform
+/// of the signal plus one spectrum multiply and inverse transform per
+/// template, instead of transforming everything from scratch like
+/// templateCount separate cross_correlate_fft() calls would.
+/// @param xLength The length of the signal in float-s.
+/// @param hLength The length of each template in float-s.
+/// @param templates The templates, stored contiguously (templateCount
+/// blocks of hLength float-s each).
+/// @param templateCount The number of templates.
+/// @return The handle for cross_correlate_fft_multi().
+CrossCorrelationFFTMultiHandle cross_correlate_fft_multi_initialize(
+    size_t xLength, size_t hLength,
+    const float *templates, size_t templateCount) NOTNULL(3);
+
+/// @brief Calculates the cross-correlation of the signal with every cached
+/// template.
+/// @param handle The structure obtained from
+/// cross_correlate_fft_multi_initialize().
+/// @param x The signal.
+/// @param result The resulting signals, stored contiguously (templateCount
+/// blocks of (xLength + hLength - 1) float-s each, in the order the
+/// templates were passed).
+void cross_correlate_fft_multi(CrossCorrelationFFTMultiHandle handle,
+                               const float *x, float *result) NOTNULL(2, 3);
+
+/// @brief Frees any resources allocated by
+/// cross_correlate_fft_multi_initialize().
+/// @param handle The structure obtained from
+/// cross_correlate_fft_multi_initialize().
+void cross_correlate_fft_multi_finalize(CrossCorrelationFFTMultiHandle handle);
+
 typedef struct ConvolutionOverlapSaveHandle CrossCorrelationOverlapSaveHandle;
 
 /// @brief Prepares for the calculation of cross-correlation of two signals
@@ -93,6 +136,41 @@ void cross_correlate_overlap_save(CrossCorrelationOverlapSaveHandle handle,
 void cross_correlate_overlap_save_finalize(
     CrossCorrelationOverlapSaveHandle handle);
 
+/// @brief Calculates the position and the value of the maximum of the
+/// cross-correlation of two signals (e.g. the time delay estimate),
+/// without materializing the correlation itself.
+/// @details Each overlap-save block is scanned for the maximum right after
+/// it is produced, while it is still in cache.
+/// @param handle The structure obtained from
+/// cross_correlate_overlap_save_initialize().
+/// @param x The first signal (long one).
+/// @param h The second signal (short one).
+/// @param position The index of the maximum in the virtual result of
+/// length xLength + hLength - 1 (the lag is position - hLength + 1).
+/// @param value The value of the maximum.
+void cross_correlate_argmax(CrossCorrelationOverlapSaveHandle handle,
+                            const float *x, const float *h,
+                            int *position, float *value) NOTNULL(2, 3, 4, 5);
+
+/// @brief Extracts the extrema of the cross-correlation of two signals,
+/// without materializing the correlation itself.
+/// @details Works like detect_peaks() run over the correlation result, but
+/// scans each overlap-save block while it is still in cache.
+/// @param handle The structure obtained from
+/// cross_correlate_overlap_save_initialize().
+/// @param x The first signal (long one).
+/// @param h The second signal (short one).
+/// @param type The type of the extracted extrema.
+/// @param results The pointer to the array of ExtremumPoint-s. That array
+/// will be allocated with malloc(), so it should be disposed with free()
+/// after it's been used. If no points are found, it is set to NULL.
+/// @param resultsLength The number of found extremum points.
+void cross_correlate_peaks(CrossCorrelationOverlapSaveHandle handle,
+                           const float *x, const float *h,
+                           ExtremumType type,
+                           ExtremumPoint **results,
+                           size_t *resultsLength) NOTNULL(2, 3, 5, 6);
+
 /// @brief Calculates the cross-correlation of two signals using
 /// the "brute force" method.
 /// @param simd Value indicating whether to use SIMD acceleration or not.
@@ -107,6 +185,65 @@ void cross_correlate_simd(int simd,
                           const float *__restrict h, size_t hLength,
                           float *__restrict result) NOTNULL(2, 4, 6);
 
+/// @brief Calculates the "valid" 2D cross-correlation of an image with
+/// a patch, e.g. for patch tracking in frames prepared with normalize2D().
+/// @param simd Value indicating whether to use SIMD acceleration or not.
+/// @param src The image.
+/// @param srcStride The distance between the first elements of two
+/// consecutive image rows, in float-s (>= width).
+/// @param width The width of the image in float-s.
+/// @param height The height of the image.
+/// @param kernel The patch, stored tightly (kernelHeight rows of
+/// kernelWidth float-s).
+/// @param kernelWidth The width of the patch in float-s (<= width).
+/// @param kernelHeight The height of the patch (<= height).
+/// @param dst The correlation surface, stored tightly:
+/// (height - kernelHeight + 1) rows of (width - kernelWidth + 1) float-s.
+/// @note dst may NOT overlap src or kernel.
+void cross_correlate_2d(int simd,
+                        const float *__restrict src, size_t srcStride,
+                        size_t width, size_t height,
+                        const float *__restrict kernel,
+                        size_t kernelWidth, size_t kernelHeight,
+                        float *__restrict dst) NOTNULL(2, 6, 9);
+
+/// @brief Calculates the sliding normalized cross-correlation (NCC) of
+/// a signal with a template, for template matching.
+/// @details Every score is the Pearson correlation between the template and
+/// the window of the signal starting at that lag. The window mean and energy
+/// are maintained incrementally (one sample enters, one leaves), so unlike
+/// correlating and normalizing in separate passes, x is swept only once.
+/// @param simd Value indicating whether to use SIMD acceleration or not.
+/// @param x The signal.
+/// @param xLength The length of the signal in float-s.
+/// @param h The template. It must not be longer than the signal.
+/// @param hLength The length of the template in float-s.
+/// @param result The scores in [-1, 1], one for each of the
+/// xLength - hLength + 1 window positions. Windows with zero variance
+/// score 0.
+/// @note result, x and h may NOT be the same arrays.
+void cross_correlate_ncc(int simd,
+                         const float *__restrict x, size_t xLength,
+                         const float *__restrict h, size_t hLength,
+                         float *__restrict result) NOTNULL(2, 4, 6);
+
+/// @brief Calculates the cross-correlation of two double precision signals
+/// using the "brute force" method.
+/// @details The underlying FFT library works in single precision only, so
+/// this is the variant to use when float accumulation is not enough (very
+/// long signals); it keeps four SIMD lanes instead of dropping to scalar.
+/// @param simd Value indicating whether to use SIMD acceleration or not.
+/// @param x The first signal (long one).
+/// @param xLength The length of the first array in double-s.
+/// @param h The second signal (short one).
+/// @param hLength The length of the second array in double-s.
+/// @param result The resulting signal of length xLength + hLength - 1.
+/// @note result, x and h may NOT be the same arrays.
+void cross_correlate_simd_f64(int simd,
+                              const double *__restrict x, size_t xLength,
+                              const double *__restrict h, size_t hLength,
+                              double *__restrict result) NOTNULL(2, 4, 6);
+
 typedef struct ConvolutionHandle CrossCorrelationHandle;
 
 /// @brief Prepares for the calculation of cross-correlation of
@@ -134,6 +271,36 @@ void cross_correlate(CrossCorrelationHandle handle,
 /// cross_correlate_overlap_initialize().
 void cross_correlate_finalize(CrossCorrelationHandle handle);
 
+/// @brief The sink for cross_correlate_stream(): receives the samples at
+/// [offset, offset + count) of the virtual correlation result of length
+/// xLength + hLength - 1. The chunk array belongs to the library and is
+/// overwritten by the next block, so the consumer must copy out whatever
+/// it keeps.
+typedef void (*cross_correlate_consumer)(const float *chunk, size_t offset,
+                                         size_t count, void *user);
+
+/// @brief Calculates the cross-correlation of an out-of-core signal, e.g.
+/// a multi-GB recording mapped read-only with simd_mmap_signal(), with a
+/// short template, handing the result to the consumer block by block.
+/// @details The signal is advised as sequential and fed through the
+/// streaming overlap-save machinery of convolve_stream_feed() with the
+/// template reversed, so only one block plus the hLength - 1 carried
+/// samples are ever resident - the memory use stays flat regardless of
+/// the signal length and the kernel's read-ahead overlaps the compute.
+/// @param x The first signal (long one), usually a read-only file mapping.
+/// @param xLength The length of the first array in float-s.
+/// @param h The second signal (short one).
+/// @param hLength The length of the second array in float-s.
+/// @param blockSize The number of result samples per consumer call (the
+/// last call may deliver fewer), or 0 for a cache-sized default.
+/// @param consumer The callback receiving the result blocks in order.
+/// @param user An opaque pointer passed to every consumer call.
+void cross_correlate_stream(const float *x, size_t xLength,
+                            const float *h, size_t hLength,
+                            size_t blockSize,
+                            cross_correlate_consumer consumer,
+                            void *user) NOTNULL(1, 3, 6);
+
 SIMD_API_END
 
 #endif  // INC_SIMD_CORRELATE_H_
@@ -62,6 +62,82 @@ void detect_peaks(int simd, const float *data, size_t size, ExtremumType type,
                   ExtremumPoint **results, size_t *resultsLength)
     NOTNULL(2, 5, 6);
 
+/// @brief Extract maximums and minimums from the series of floating point
+/// numbers, dropping insignificant ones during the scan.
+/// @details Folds the post-filtering usually done on the output of
+/// detect_peaks() into the single SIMD pass, so the shrunken result array
+/// is never touched twice.
+/// @param simd Value indicating whether to use SIMD acceleration.
+/// @param data The array of floating point numbers representing the signal.
+/// @param size The length of the array (in float-s, not in bytes).
+/// @param type The type of the extracted extrema.
+/// @param min_value The amplitude threshold: maximums below min_value and
+/// minimums above -min_value are dropped. Pass -FLT_MAX to disable.
+/// @param min_prominence The prominence threshold: extrema closer than this
+/// to the preceding extremum of the opposite kind are dropped. Pass 0 to
+/// disable. The prominence state is driven by the raw extremum stream,
+/// including the points the other filters drop.
+/// @param results The pointer to the array of ExtremumPoint-s. That array
+/// will be allocated with malloc(), so it should be disposed with free()
+/// after it's been used. If no points are found, it is set to NULL.
+/// @param resultsLength The number of found extremum points.
+void detect_peaks_filtered(int simd, const float *data, size_t size,
+                           ExtremumType type, float min_value,
+                           float min_prominence,
+                           ExtremumPoint **results, size_t *resultsLength)
+    NOTNULL(2, 7, 8);
+
+/// @brief The carry state of a chunked peak detection scan.
+typedef struct {
+  ExtremumType type;
+  /// The last two samples of the previously fed chunk.
+  float last[2];
+  /// The global index of the next incoming sample.
+  size_t position;
+} PeakDetectionStream;
+
+/// @brief Prepares for scanning a signal fed in chunks for extrema.
+/// @param stream The caller-allocated carry state to initialize.
+/// @param type The type of the extracted extrema.
+void detect_peaks_stream_initialize(PeakDetectionStream *stream,
+                                    ExtremumType type) NOTNULL(1);
+
+/// @brief Extracts the extrema from the next chunk of the streamed signal.
+/// @details The last two samples of every chunk are carried inside the
+/// stream state, so extrema straddling a chunk boundary are found exactly
+/// once — no overlapping or deduplication is needed on the caller's side.
+/// The union of the results of the feeds equals what detect_peaks() would
+/// return for the whole signal at once.
+/// @param simd Value indicating whether to use SIMD acceleration.
+/// @param stream The state obtained from detect_peaks_stream_initialize().
+/// @param data The next chunk of the signal.
+/// @param size The length of the chunk (in float-s, not in bytes), >= 2.
+/// @param results The pointer to the array of ExtremumPoint-s with the
+/// positions counted from the beginning of the whole signal. That array
+/// will be allocated with malloc(), so it should be disposed with free()
+/// after it's been used. If no points are found, it is set to NULL.
+/// @param resultsLength The number of found extremum points.
+void detect_peaks_stream_feed(int simd, PeakDetectionStream *stream,
+                              const float *data, size_t size,
+                              ExtremumPoint **results, size_t *resultsLength)
+    NOTNULL(2, 3, 5, 6);
+
+/// @brief Extract maximums and minimums from the series of floating point
+/// numbers into a caller-provided array, without any heap allocation.
+/// @param simd Value indicating whether to use SIMD acceleration.
+/// @param data The array of floating point numbers representing the signal.
+/// @param size The length of the array (in float-s, not in bytes).
+/// @param type The type of the extracted extrema.
+/// @param results The caller-owned array the found points are written to.
+/// @param capacity The capacity of results in ExtremumPoint-s. Points which
+/// do not fit are dropped.
+/// @param resultsLength The number of found extremum points (<= capacity).
+/// @return Zero if some points did not fit into results, non-zero otherwise.
+int detect_peaks_prealloc(int simd, const float *data, size_t size,
+                          ExtremumType type, ExtremumPoint *results,
+                          size_t capacity, size_t *resultsLength)
+    NOTNULL(2, 5, 7);
+
 SIMD_API_END
 
 #endif  // INC_SIMD_DETECT_PEAKS_H_
@@ -31,6 +31,12 @@
 #ifndef INC_SIMD_INSTRUCTION_SET_H_
 #define INC_SIMD_INSTRUCTION_SET_H_
 
+#if defined(__ARM_NEON) && !defined(__ARM_NEON__)
+// AArch64 compilers define __ARM_NEON only, while the rest of the library
+// checks the legacy 32-bit spelling. The intrinsics are identical.
+#define __ARM_NEON__
+#endif
+
 #if defined (__SSE4_2__) || defined (__SSE4_1__)
 #if !defined(_IMMINTRIN_H_INCLUDED) && !defined(__IMMINTRIN_H)
 #define _IMMINTRIN_H_INCLUDED
@@ -57,12 +63,32 @@
 #include <avx2intrin.h>
 #endif
 #endif
+#ifdef __FMA__
+#ifndef SIMD_IMMINTRIN_INCLUDED
+#include <fmaintrin.h>
+#endif
+#endif
+#ifdef __F16C__
+#ifndef SIMD_IMMINTRIN_INCLUDED
+#include <f16cintrin.h>
+#endif
+#endif
+#ifdef __AVX512F__
+#ifndef SIMD_IMMINTRIN_INCLUDED
+#include <avx512fintrin.h>
+#endif
+#endif
 #else
 #include <simd/avxintrin-emu.h>
 #define __AVX__
 #endif
 #elif defined(__ARM_NEON__)
 #include <arm_neon.h>
+#ifdef __aarch64__
+// AArch64 guarantees fused multiply-add; vmlaq_f32 decays to a separate
+// multiply and add there, so route every accumulation through vfmaq_f32.
+#define vmlaq_f32(acc, x, y) vfmaq_f32(acc, x, y)
+#endif
 #endif
 
 #ifdef __AVX__
@@ -106,4 +132,44 @@ _mm256_get_ps(__m256 vector, int index) {
 
 #endif
 
+#include <simd/common.h>
+
+SIMD_API_BEGIN
+
+/// @brief The SIMD instruction sets which simd_cpu_instruction_set() can
+/// report. Each x86 value implies all the preceding x86 ones.
+typedef enum {
+  SIMD_INSTRUCTION_SET_NONE = 0,
+  SIMD_INSTRUCTION_SET_SSE,
+  SIMD_INSTRUCTION_SET_AVX,
+  SIMD_INSTRUCTION_SET_AVX2,
+  SIMD_INSTRUCTION_SET_AVX512,
+  SIMD_INSTRUCTION_SET_NEON
+} SimdInstructionSet;
+
+/// @brief Queries the best SIMD instruction set of the running CPU via
+/// cpuid (including the OS XSAVE support check AVX needs). The result is
+/// cached, so calling this in every dispatch is free.
+SimdInstructionSet simd_cpu_instruction_set(void);
+
+/// @brief Returns nonzero if the instruction set this library was compiled
+/// for is actually available on the running CPU. Pass the result as the
+/// "simd" argument of the kernels when one binary is deployed to a mixed
+/// fleet; on lesser machines they then take their portable paths instead
+/// of faulting on unsupported instructions.
+int simd_runtime_supported(void);
+
+/// @brief Enables or disables the 512-bit kernel paths (on by default).
+/// Heavy 512-bit sequences downclock some cores, so latency-sensitive
+/// stages can switch to the 256-bit paths around their calls.
+/// @param enabled Nonzero allows AVX-512, zero forbids it.
+void simd_avx512_enable(int enabled);
+
+/// @brief Returns nonzero if the 512-bit kernel paths may be taken: the CPU
+/// implements AVX-512F, the OS saves the ZMM state and simd_avx512_enable()
+/// has not turned them off.
+int simd_avx512_available(void);
+
+SIMD_API_END
+
 #endif  // INC_SIMD_INSTRUCTION_SET_H_
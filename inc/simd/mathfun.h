@@ -64,6 +64,47 @@ INLINE void exp_psv_novec(const float *src, size_t length, float *res) {
   func_psv_novec(expf, src, length, res);
 }
 
+INLINE void sincos_psv_novec(const float *src, size_t length,
+                             float *sins, float *coss) {
+  for (size_t i = 0; i < length; ++i) {
+    sins[i] = sinf(src[i]);
+    coss[i] = cosf(src[i]);
+  }
+}
+
+INLINE float sigmoidf(float x) {
+  return 1.f / (1.f + expf(-x));
+}
+
+INLINE void pow_psv_novec(const float *src, size_t length, float power,
+                          float *res) {
+  for (size_t i = 0; i < length; ++i) {
+    res[i] = powf(src[i], power);
+  }
+}
+
+INLINE void atan2_psv_novec(const float *ys, const float *xs, size_t length,
+                            float *res) {
+  for (size_t i = 0; i < length; ++i) {
+    res[i] = atan2f(ys[i], xs[i]);
+  }
+}
+
+INLINE void hypot_psv_novec(const float *xs, const float *ys, size_t length,
+                            float *res) {
+  for (size_t i = 0; i < length; ++i) {
+    res[i] = hypotf(xs[i], ys[i]);
+  }
+}
+
+INLINE void tanh_psv_novec(const float *src, size_t length, float *res) {
+  func_psv_novec(tanhf, src, length, res);
+}
+
+INLINE void sigmoid_psv_novec(const float *src, size_t length, float *res) {
+  func_psv_novec(sigmoidf, src, length, res);
+}
+
 #ifdef __ARM_NEON__
 #include <simd/neon_mathfun.h>  // NO_LINT
 
@@ -100,6 +141,68 @@ INLINE void exp_psv_neon(const float *src, size_t length, float *res) {
   func_psv_neon(exp_ps, expf, src, length, res);
 }
 
+INLINE void pow_psv_neon(const float *src, size_t length, float power,
+                         float *res) {
+  int ilength = (int)length;
+  const float32x4_t powVec = vdupq_n_f32(power);
+  int i = 0;
+  for (; i < ilength - 3; i += 4) {
+    vst1q_f32(res + i, pow_ps(vld1q_f32(src + i), powVec));
+  }
+  for (; i < ilength; i++) {
+    res[i] = powf(src[i], power);
+  }
+}
+
+INLINE void atan2_psv_neon(const float *ys, const float *xs, size_t length,
+                           float *res) {
+  int ilength = (int)length;
+  int i = 0;
+  for (; i < ilength - 3; i += 4) {
+    vst1q_f32(res + i, atan2_ps(vld1q_f32(ys + i), vld1q_f32(xs + i)));
+  }
+  for (; i < ilength; i++) {
+    res[i] = atan2f(ys[i], xs[i]);
+  }
+}
+
+INLINE void hypot_psv_neon(const float *xs, const float *ys, size_t length,
+                           float *res) {
+  int ilength = (int)length;
+  int i = 0;
+  for (; i < ilength - 3; i += 4) {
+    vst1q_f32(res + i, hypot_ps(vld1q_f32(xs + i), vld1q_f32(ys + i)));
+  }
+  for (; i < ilength; i++) {
+    res[i] = hypotf(xs[i], ys[i]);
+  }
+}
+
+INLINE void tanh_psv_neon(const float *src, size_t length, float *res) {
+  func_psv_neon(tanh_ps, tanhf, src, length, res);
+}
+
+INLINE void sigmoid_psv_neon(const float *src, size_t length, float *res) {
+  func_psv_neon(sigmoid_ps, sigmoidf, src, length, res);
+}
+
+INLINE void sincos_psv_neon(const float *src, size_t length,
+                            float *sins, float *coss) {
+  int ilength = (int)length;
+  int i = 0;
+  for (; i < ilength - 3; i += 4) {
+    float32x4_t vec = vld1q_f32(src + i);
+    float32x4_t sin_r, cos_r;
+    sincos_ps(vec, &sin_r, &cos_r);
+    vst1q_f32(sins + i, sin_r);
+    vst1q_f32(coss + i, cos_r);
+  }
+  for (; i < ilength; i++) {
+    sins[i] = sinf(src[i]);
+    coss[i] = cosf(src[i]);
+  }
+}
+
 #endif
 
 #ifdef __AVX__
@@ -137,6 +240,70 @@ INLINE void exp_psv_avx(const float *src, size_t length, float *res) {
   func_psv_avx(exp256_ps, expf, src, length, res);
 }
 
+INLINE void pow_psv_avx(const float *src, size_t length, float power,
+                        float *res) {
+  int ilength = (int)length;
+  const __m256 powVec = _mm256_set1_ps(power);
+  int i = 0;
+  for (; i < ilength - 7; i += 8) {
+    _mm256_storeu_ps(res + i, pow256_ps(_mm256_loadu_ps(src + i), powVec));
+  }
+  for (; i < ilength; i++) {
+    res[i] = powf(src[i], power);
+  }
+}
+
+INLINE void atan2_psv_avx(const float *ys, const float *xs, size_t length,
+                          float *res) {
+  int ilength = (int)length;
+  int i = 0;
+  for (; i < ilength - 7; i += 8) {
+    _mm256_storeu_ps(res + i, atan2_256_ps(_mm256_loadu_ps(ys + i),
+                                           _mm256_loadu_ps(xs + i)));
+  }
+  for (; i < ilength; i++) {
+    res[i] = atan2f(ys[i], xs[i]);
+  }
+}
+
+INLINE void hypot_psv_avx(const float *xs, const float *ys, size_t length,
+                          float *res) {
+  int ilength = (int)length;
+  int i = 0;
+  for (; i < ilength - 7; i += 8) {
+    _mm256_storeu_ps(res + i, hypot256_ps(_mm256_loadu_ps(xs + i),
+                                          _mm256_loadu_ps(ys + i)));
+  }
+  for (; i < ilength; i++) {
+    res[i] = hypotf(xs[i], ys[i]);
+  }
+}
+
+INLINE void tanh_psv_avx(const float *src, size_t length, float *res) {
+  func_psv_avx(tanh256_ps, tanhf, src, length, res);
+}
+
+INLINE void sigmoid_psv_avx(const float *src, size_t length, float *res) {
+  func_psv_avx(sigmoid256_ps, sigmoidf, src, length, res);
+}
+
+INLINE void sincos_psv_avx(const float *src, size_t length,
+                           float *sins, float *coss) {
+  int ilength = (int)length;
+  int i = 0;
+  for (; i < ilength - 7; i += 8) {
+    __m256 vec = _mm256_loadu_ps(src + i);
+    __m256 sin_r, cos_r;
+    sincos256_ps(vec, &sin_r, &cos_r);
+    _mm256_storeu_ps(sins + i, sin_r);
+    _mm256_storeu_ps(coss + i, cos_r);
+  }
+  for (; i < ilength; i++) {
+    sins[i] = sinf(src[i]);
+    coss[i] = cosf(src[i]);
+  }
+}
+
 #endif
 
 INLINE NOTNULL(2, 4) void sin_psv(int simd, const float *src, size_t length,
@@ -203,6 +370,120 @@ INLINE NOTNULL(2, 4) void exp_psv(int simd, const float *src, size_t length,
   }
 }
 
+/// @brief Raises every element to the specified power.
+/// @details Computed as exp(power * log(x)), so only defined for
+/// positive bases (the SIMD log kernels return nan for x <= 0).
+INLINE NOTNULL(2, 5) void pow_psv(int simd, const float *src, size_t length,
+                                  float power, float *res) {
+  if (simd) {
+#ifdef __ARM_NEON__
+    pow_psv_neon(src, length, power, res);
+  } else {
+#elif defined(__AVX__)
+    pow_psv_avx(src, length, power, res);
+  } else {
+#else
+  } {
+#endif
+    pow_psv_novec(src, length, power, res);
+  }
+}
+
+/// @brief Calculates atan2(ys[i], xs[i]) for every element pair.
+/// @details The SIMD paths are accurate to about 1e-6 radian and return
+/// 0 instead of pi for atan2(0, -0.f).
+INLINE NOTNULL(2, 3, 5) void atan2_psv(int simd, const float *ys,
+                                       const float *xs, size_t length,
+                                       float *res) {
+  if (simd) {
+#ifdef __ARM_NEON__
+    atan2_psv_neon(ys, xs, length, res);
+  } else {
+#elif defined(__AVX__)
+    atan2_psv_avx(ys, xs, length, res);
+  } else {
+#else
+  } {
+#endif
+    atan2_psv_novec(ys, xs, length, res);
+  }
+}
+
+/// @brief Calculates sqrt(xs[i]^2 + ys[i]^2) for every element pair.
+/// @details Unlike hypotf(), the SIMD paths square the inputs directly,
+/// so the squares must not overflow.
+INLINE NOTNULL(2, 3, 5) void hypot_psv(int simd, const float *xs,
+                                       const float *ys, size_t length,
+                                       float *res) {
+  if (simd) {
+#ifdef __ARM_NEON__
+    hypot_psv_neon(xs, ys, length, res);
+  } else {
+#elif defined(__AVX__)
+    hypot_psv_avx(xs, ys, length, res);
+  } else {
+#else
+  } {
+#endif
+    hypot_psv_novec(xs, ys, length, res);
+  }
+}
+
+/// @brief Calculates the hyperbolic tangent of every element.
+/// @details The SIMD paths are accurate to a few 1e-7 absolute, which is
+/// plenty for neural activations.
+INLINE NOTNULL(2, 4) void tanh_psv(int simd, const float *src, size_t length,
+                                   float *res) {
+  if (simd) {
+#ifdef __ARM_NEON__
+    tanh_psv_neon(src, length, res);
+  } else {
+#elif defined(__AVX__)
+    tanh_psv_avx(src, length, res);
+  } else {
+#else
+  } {
+#endif
+    tanh_psv_novec(src, length, res);
+  }
+}
+
+/// @brief Calculates the logistic function 1 / (1 + e^-x) of every element.
+INLINE NOTNULL(2, 4) void sigmoid_psv(int simd, const float *src,
+                                      size_t length, float *res) {
+  if (simd) {
+#ifdef __ARM_NEON__
+    sigmoid_psv_neon(src, length, res);
+  } else {
+#elif defined(__AVX__)
+    sigmoid_psv_avx(src, length, res);
+  } else {
+#else
+  } {
+#endif
+    sigmoid_psv_novec(src, length, res);
+  }
+}
+
+/// @brief Calculates the sine and the cosine of every element in a single
+/// pass, sharing the argument reduction between the two results.
+INLINE NOTNULL(2, 4, 5) void sincos_psv(int simd, const float *src,
+                                        size_t length,
+                                        float *sins, float *coss) {
+  if (simd) {
+#ifdef __ARM_NEON__
+    sincos_psv_neon(src, length, sins, coss);
+  } else {
+#elif defined(__AVX__)
+    sincos_psv_avx(src, length, sins, coss);
+  } else {
+#else
+  } {
+#endif
+    sincos_psv_novec(src, length, sins, coss);
+  }
+}
+
 //////////////////////////
 
 SIMD_API_END
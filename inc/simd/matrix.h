@@ -32,11 +32,22 @@
 #define INC_SIMD_MATRIX_H_
 
 #include <stddef.h>
+#include <stdint.h>
 #include <simd/common.h>
 #include <simd/attributes.h>
 
 SIMD_API_BEGIN
 
+/// @brief Sets the number of worker threads matrix_multiply() and
+/// matrix_multiply_transposed() are allowed to use (1, the default,
+/// keeps them single-threaded).
+/// @details The result is split into horizontal panels, one per worker.
+/// The value is a process-wide setting which is supposed to be assigned
+/// once at startup; matrices too small to fill the workers fall back to
+/// fewer threads or the serial path.
+/// @param threads The number of threads (>= 1).
+void matrix_set_threads(int threads);
+
 /// @brief Sums two matrices.
 /// @param simd Value which indicates whether to use SIMD acceleration or not.
 /// @param m1 The first matrix.
@@ -55,6 +66,34 @@ void matrix_add(int simd, const float *m1, const float *m2,
 /// @param res The resulting matrix of the same size.
 void matrix_sub(int simd, const float *m1, const float *m2,
                 size_t w, size_t h, float *res) NOTNULL(2,3,6);
+/// @brief Sums two matrices with a strict layout contract.
+/// @details Unlike matrix_add(), all three pointers must be SIMD-aligned
+/// (e.g. obtained from mallocf()) and w * h must be a multiple of 16, so
+/// the kernel drops the tail and alignment handling, unrolls wider and
+/// switches to non-temporal stores for operands larger than the last
+/// level cache.
+/// @param simd Value which indicates whether to use SIMD acceleration or not.
+/// @param m1 The first matrix.
+/// @param m2 The second matrix.
+/// @param w The width of the matrices (the number of columns).
+/// @param h The height of the matrices (the number of rows).
+/// @param res The resulting matrix of the same size.
+/// @pre w * h must be a multiple of 16 and m1, m2, res must be aligned.
+void matrix_add_strict(int simd, const float *m1, const float *m2,
+                       size_t w, size_t h, float *res) NOTNULL(2,3,6);
+
+/// @brief Subtracts the second matrix from the first one with a strict
+/// layout contract (see matrix_add_strict() for the requirements).
+/// @param simd Value which indicates whether to use SIMD acceleration or not.
+/// @param m1 The first matrix.
+/// @param m2 The second matrix.
+/// @param w The width of the matrices (the number of columns).
+/// @param h The height of the matrices (the number of rows).
+/// @param res The resulting matrix of the same size.
+/// @pre w * h must be a multiple of 16 and m1, m2, res must be aligned.
+void matrix_sub_strict(int simd, const float *m1, const float *m2,
+                       size_t w, size_t h, float *res) NOTNULL(2,3,6);
+
 /// @brief Multiplies two matrices.
 /// @param simd Value which indicates whether to use SIMD acceleration or not.
 /// @param m1 The first matrix in row-major format.
@@ -69,6 +108,75 @@ void matrix_multiply(int simd, const float *m1, const float *m2,
                      size_t w1, size_t h1, size_t w2, size_t h2,
                      float *res) NOTNULL(2,3,8);
 
+/// @brief Multiplies two matrices and accumulates into the result,
+/// res = alpha * m1 * m2 + beta * res (BLAS sgemm semantics).
+/// @param simd Value which indicates whether to use SIMD acceleration or not.
+/// @param m1 The first matrix in row-major format.
+/// @param m2 The seconds matrix in row-major format.
+/// @param w1 The width of the first matrix (the number of columns).
+/// @param h1 The height of the first matrix (the number of rows).
+/// @param w2 The width of the second matrix (the number of columns).
+/// @param h2 The height of the second matrix (the number of rows).
+/// @param alpha The factor applied to the product.
+/// @param beta The factor applied to the previous contents of res;
+/// 0 overwrites res without reading it.
+/// @param res The resulting matrix, of size w2 x h1.
+/// @pre w1 must be equal to h2.
+/// @details The scaling and the accumulation happen inside the final
+/// stores of the multiplication kernel, so no temporary matrix and no
+/// extra pass over res are needed.
+void matrix_multiply_accumulate(int simd, const float *m1, const float *m2,
+                                size_t w1, size_t h1, size_t w2, size_t h2,
+                                float alpha, float beta, float *res)
+    NOTNULL(2,3,10);
+
+/// @brief Multiplies two int16 matrices, accumulating in int32.
+/// @details Quantized weights stay in int16, so no int16_to_float()
+/// conversion pass is needed and the dot products run with twice the
+/// lanes of the float kernels (_mm_madd_epi16 / vmlal_s16).
+/// @param simd Value which indicates whether to use SIMD acceleration or not.
+/// @param m1 The first matrix in row-major format.
+/// @param m2 The seconds matrix in row-major format.
+/// @param w1 The width of the first matrix (the number of columns).
+/// @param h1 The height of the first matrix (the number of rows).
+/// @param w2 The width of the second matrix (the number of columns).
+/// @param h2 The height of the second matrix (the number of rows).
+/// @param res The resulting matrix, of size w2 x h1.
+/// @pre w1 must be equal to h2.
+/// @note The caller is responsible for keeping the int32 accumulators
+/// from overflowing (always safe for w1 <= 65536).
+void matrix_multiply_i16(int simd, const int16_t *m1, const int16_t *m2,
+                         size_t w1, size_t h1, size_t w2, size_t h2,
+                         int32_t *res) NOTNULL(2,3,8);
+
+/// @brief Multiplies a matrix by a column vector, res = m * v.
+/// @param simd Value which indicates whether to use SIMD acceleration or not.
+/// @param m The matrix in row-major format.
+/// @param v The vector of w float-s.
+/// @param w The width of the matrix (the number of columns).
+/// @param h The height of the matrix (the number of rows).
+/// @param stride The actual row stride of m (>= w), so that row j starts
+/// at m + j * stride.
+/// @param res The resulting vector of h float-s.
+void matrix_vector_multiply(int simd, const float *m, const float *v,
+                            size_t w, size_t h, size_t stride, float *res)
+    NOTNULL(2,3,7);
+
+/// @brief Transposes a matrix out-of-place, dst = src^T.
+/// @details The SIMD versions shuffle whole 8x8 (AVX) or 4x4 (NEON)
+/// blocks in registers instead of doing strided scalar stores.
+/// @param simd Value which indicates whether to use SIMD acceleration or not.
+/// @param src The source matrix in row-major format, w columns x h rows.
+/// @param w The width of src (the number of columns).
+/// @param h The height of src (the number of rows).
+/// @param src_stride The actual row stride of src (>= w).
+/// @param dst_stride The actual row stride of dst (>= h).
+/// @param dst The resulting matrix, h columns x w rows. It must not
+/// overlap with src.
+void matrix_transpose(int simd, const float *src, size_t w, size_t h,
+                      size_t src_stride, size_t dst_stride, float *dst)
+    NOTNULL(2,7);
+
 /// @brief Multiplies two matrices, the second one being stored transposed.
 /// @param simd Value which indicates whether to use SIMD acceleration or not.
 /// @param m1 The first matrix in row-major format.
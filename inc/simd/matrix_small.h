@@ -0,0 +1,138 @@
+/*! @file matrix_small.h
+ *  @brief Fully unrolled multiplication kernels for small fixed-size
+ *  matrices.
+ *  @author Markovtsev Vadim <v.markovtsev@samsung.com>
+ *  @version 1.0
+ *
+ *  @section Notes
+ *  This code partially conforms to <a href="http://google-styleguide.googlecode.com/svn/trunk/cppguide.xml">Google C++ Style Guide</a>.
+ *
+ *  @section Copyright
+ *  Copyright © 2013 Samsung R&D Institute Russia
+ *
+ *  @section License
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#ifndef INC_SIMD_MATRIX_SMALL_H_
+#define INC_SIMD_MATRIX_SMALL_H_
+
+#include <simd/attributes.h>
+#include <simd/instruction_set.h>
+
+/// @brief Multiplies two 4x4 row-major matrices, res = m1 * m2.
+/// @details Unlike matrix_multiply(), this kernel is fully unrolled,
+/// keeps the whole result in registers and inlines at the call site,
+/// so it suits code which multiplies huge numbers of tiny matrices.
+/// @param m1 The first matrix, 16 float-s.
+/// @param m2 The second matrix, 16 float-s.
+/// @param res The resulting matrix, 16 float-s. It must not overlap
+/// with m1 or m2.
+INLINE NOTNULL(1, 2, 3) void matrix_multiply_4x4(
+    const float *m1, const float *m2, float *__restrict res) {
+#ifdef __AVX__
+  __m128 row0 = _mm_loadu_ps(m2);
+  __m128 row1 = _mm_loadu_ps(m2 + 4);
+  __m128 row2 = _mm_loadu_ps(m2 + 8);
+  __m128 row3 = _mm_loadu_ps(m2 + 12);
+  for (int r = 0; r < 4; r++) {
+    __m128 acc = _mm_mul_ps(_mm_set1_ps(m1[r * 4]), row0);
+#ifdef __FMA__
+    acc = _mm_fmadd_ps(_mm_set1_ps(m1[r * 4 + 1]), row1, acc);
+    acc = _mm_fmadd_ps(_mm_set1_ps(m1[r * 4 + 2]), row2, acc);
+    acc = _mm_fmadd_ps(_mm_set1_ps(m1[r * 4 + 3]), row3, acc);
+#else
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(m1[r * 4 + 1]), row1));
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(m1[r * 4 + 2]), row2));
+    acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(m1[r * 4 + 3]), row3));
+#endif
+    _mm_storeu_ps(res + r * 4, acc);
+  }
+#elif defined(__ARM_NEON__)
+  float32x4_t row0 = vld1q_f32(m2);
+  float32x4_t row1 = vld1q_f32(m2 + 4);
+  float32x4_t row2 = vld1q_f32(m2 + 8);
+  float32x4_t row3 = vld1q_f32(m2 + 12);
+  for (int r = 0; r < 4; r++) {
+    float32x4_t acc = vmulq_n_f32(row0, m1[r * 4]);
+    acc = vmlaq_n_f32(acc, row1, m1[r * 4 + 1]);
+    acc = vmlaq_n_f32(acc, row2, m1[r * 4 + 2]);
+    acc = vmlaq_n_f32(acc, row3, m1[r * 4 + 3]);
+    vst1q_f32(res + r * 4, acc);
+  }
+#else
+  for (int r = 0; r < 4; r++) {
+    for (int j = 0; j < 4; j++) {
+      res[r * 4 + j] = m1[r * 4] * m2[j] +
+                       m1[r * 4 + 1] * m2[4 + j] +
+                       m1[r * 4 + 2] * m2[8 + j] +
+                       m1[r * 4 + 3] * m2[12 + j];
+    }
+  }
+#endif
+}
+
+/// @brief Multiplies two 8x8 row-major matrices, res = m1 * m2.
+/// @details See matrix_multiply_4x4() for the reasoning; one result row
+/// occupies a whole AVX register (two NEON registers).
+/// @param m1 The first matrix, 64 float-s.
+/// @param m2 The second matrix, 64 float-s.
+/// @param res The resulting matrix, 64 float-s. It must not overlap
+/// with m1 or m2.
+INLINE NOTNULL(1, 2, 3) void matrix_multiply_8x8(
+    const float *m1, const float *m2, float *__restrict res) {
+#ifdef __AVX__
+  for (int r = 0; r < 8; r++) {
+    __m256 acc = _mm256_mul_ps(_mm256_broadcast_ss(m1 + r * 8),
+                               _mm256_loadu_ps(m2));
+    for (int k = 1; k < 8; k++) {
+      __m256 row = _mm256_loadu_ps(m2 + k * 8);
+#ifdef __FMA__
+      acc = _mm256_fmadd_ps(_mm256_broadcast_ss(m1 + r * 8 + k), row, acc);
+#else
+      acc = _mm256_add_ps(
+          acc, _mm256_mul_ps(_mm256_broadcast_ss(m1 + r * 8 + k), row));
+#endif
+    }
+    _mm256_storeu_ps(res + r * 8, acc);
+  }
+#elif defined(__ARM_NEON__)
+  for (int r = 0; r < 8; r++) {
+    float32x4_t acclo = vmulq_n_f32(vld1q_f32(m2), m1[r * 8]);
+    float32x4_t acchi = vmulq_n_f32(vld1q_f32(m2 + 4), m1[r * 8]);
+    for (int k = 1; k < 8; k++) {
+      acclo = vmlaq_n_f32(acclo, vld1q_f32(m2 + k * 8), m1[r * 8 + k]);
+      acchi = vmlaq_n_f32(acchi, vld1q_f32(m2 + k * 8 + 4), m1[r * 8 + k]);
+    }
+    vst1q_f32(res + r * 8, acclo);
+    vst1q_f32(res + r * 8 + 4, acchi);
+  }
+#else
+  for (int r = 0; r < 8; r++) {
+    for (int j = 0; j < 8; j++) {
+      float sum = 0.f;
+      for (int k = 0; k < 8; k++) {
+        sum += m1[r * 8 + k] * m2[k * 8 + j];
+      }
+      res[r * 8 + j] = sum;
+    }
+  }
+#endif
+}
+
+#endif  // INC_SIMD_MATRIX_SMALL_H_
@@ -92,6 +92,59 @@ int align_complement_u32(const uint32_t *ptr) NOTNULL(1);
 /// SIMD variant)which should be disposed with free().
 void *malloc_aligned(size_t size) MALLOC;
 
+/// @brief Acts like malloc_aligned(), but blocks of 2 MB and above are
+/// aligned to the transparent huge page size and marked with
+/// madvise(MADV_HUGEPAGE), cutting the TLB misses on multi-hundred-MB
+/// scratch and coefficient arrays. Smaller blocks, platforms without THP
+/// and failed 2 MB-aligned allocations all fall back to malloc_aligned().
+/// @param size The size of the new block in bytes.
+/// @return The newly allocated memory which should be disposed with free().
+void *malloc_aligned_huge(size_t size) MALLOC;
+
+/// @brief Acts like malloc_aligned(), but asks the kernel to place the
+/// still-untouched pages of the block on the given NUMA node, so the
+/// threads running there keep their accesses local.
+/// @details Advisory, like malloc_aligned_huge(): on platforms without the
+/// mbind(2) syscall, or when the request cannot be honored, the block is
+/// simply placed by the default first-touch policy. Pages recycled from
+/// the heap which were already faulted on another node are not migrated.
+/// @param size The size of the new block in bytes.
+/// @param node The NUMA node to place the block on, or -1 for the default
+/// policy.
+/// @return The newly allocated memory which should be disposed with free().
+void *malloc_aligned_numa(size_t size, int node) MALLOC;
+
+/// @brief Maps the file at path into memory read-only as an array of
+/// float-s and advises the kernel that it will be scanned sequentially
+/// (madvise(MADV_SEQUENTIAL)), so the read-ahead overlaps the compute and
+/// the resident size stays flat regardless of the file length. This is
+/// the intended source for the streaming entry points
+/// (stationary_wavelet_apply_stream(), cross_correlate_stream()).
+/// @details On platforms without mmap(2) the file is simply read into a
+/// malloc_aligned() buffer instead. Trailing bytes of a file whose size
+/// is not a multiple of sizeof(float) are ignored.
+/// @param path The path of the file to map.
+/// @param length Receives the number of float-s mapped.
+/// @return The mapped samples, or NULL if the file could not be mapped.
+/// Dispose with simd_munmap_signal(), not with free().
+const float *simd_mmap_signal(const char *path, size_t *length)
+    NOTNULL(1, 2);
+
+/// @brief Unmaps an array obtained from simd_mmap_signal().
+/// @param ptr The value returned by simd_mmap_signal().
+/// @param length The length reported by simd_mmap_signal(), in float-s.
+void simd_munmap_signal(const float *ptr, size_t length);
+
+/// @brief Advises the kernel that the given range will be scanned once,
+/// front to back (madvise(MADV_SEQUENTIAL)), so it prefetches ahead of
+/// the scan and drops the pages behind it. Useful for signals mapped
+/// from files without simd_mmap_signal(), which advises automatically.
+/// @details Advisory: a no-op on platforms without madvise(2), and any
+/// misalignment is absorbed by page-rounding the range.
+/// @param ptr The beginning of the range.
+/// @param size The size of the range in bytes.
+void simd_madvise_sequential(const void *ptr, size_t size) NOTNULL(1);
+
 /// @brief Allocates a block in the memory with the specified offset relative
 /// to 32 or 64 bytes alignment (depending on SIMD variant).
 /// @param size The size of the new block in bytes.
@@ -100,11 +153,75 @@ void *malloc_aligned(size_t size) MALLOC;
 void *malloc_aligned_offset(size_t size, int offset) MALLOC;
 
 /// @brief Allocates an array of floating point numbers aligned to
-/// 32 or 64 bytes (depending on SIMD variant).
+/// 32 or 64 bytes (depending on SIMD variant). Dispose it with free(),
+/// or with freef() if the block pool is enabled
+/// (see mallocf_pool_enable()).
 /// @param length The length of the block to allocate (in float-s, not
 /// in bytes).
 float *mallocf(size_t length) MALLOC;
 
+/// @brief Switches mallocf() to an opt-in pooled mode: released blocks are
+/// cached in per-thread size-bucketed free lists, so repeated same-size
+/// allocations become pointer pops instead of malloc()/free() pairs.
+/// @param enabled Nonzero turns pooling on, zero turns it off.
+/// @details Enable pooling once at startup, before the first mallocf();
+/// toggling it while pooled blocks are live mixes incompatible layouts.
+/// While pooling is enabled, every buffer obtained from mallocf()
+/// (including the ones returned by zeropadding()) must be released with
+/// freef() instead of free().
+void mallocf_pool_enable(int enabled);
+
+/// @brief Releases a buffer allocated with mallocf(). When pooling is off,
+/// this is a plain free(); when it is on, the block is cached in the free
+/// list of the calling thread for reuse. NULL is ignored either way.
+/// @param ptr The buffer obtained from mallocf().
+void freef(float *ptr);
+
+/// @brief Returns all the blocks cached by the calling thread back to the
+/// system. Call it before a thread exits, or when the pooled sizes change
+/// for good.
+void mallocf_pool_drain(void);
+
+/// @brief A memory region which hands out aligned blocks with a bump
+/// pointer, so that temporaries sharing one lifetime cost a single
+/// malloc_aligned()/free() pair instead of one pair per block.
+/// The struct is plain data and may be copied or embedded in handles.
+typedef struct {
+  /// The backing block allocated with malloc_aligned().
+  char *base;
+  /// The capacity of the backing block in bytes.
+  size_t size;
+  /// The number of bytes handed out so far (a multiple of the alignment).
+  size_t used;
+} SimdArena;
+
+/// @brief Creates an arena backed by a single malloc_aligned() block.
+/// @param size The capacity of the arena in bytes. Since every
+/// simd_arena_alloc() rounds its size up to 64 bytes, reserve
+/// an extra 64 bytes per planned allocation.
+/// @return The new arena. base is NULL if the allocation failed.
+SimdArena simd_arena_create(size_t size);
+
+/// @brief Takes the next block from the arena.
+/// @param arena The arena obtained from simd_arena_create().
+/// @param size The size of the block in bytes. It is rounded up to 64 bytes,
+/// so every returned pointer keeps the malloc_aligned() alignment.
+/// @return A pointer inside the arena which must not be passed to free();
+/// it stays valid until simd_arena_reset() or simd_arena_destroy().
+/// Exhausting the arena triggers an assertion failure.
+void *simd_arena_alloc(SimdArena *arena, size_t size) NOTNULL(1);
+
+/// @brief Forgets all the blocks handed out by simd_arena_alloc(), making
+/// the whole capacity available again. The memory is not returned to the
+/// system, so per-frame temporaries can reuse it without malloc churn.
+/// @param arena The arena obtained from simd_arena_create().
+void simd_arena_reset(SimdArena *arena) NOTNULL(1);
+
+/// @brief Frees the backing block of the arena, invalidating every pointer
+/// handed out by simd_arena_alloc().
+/// @param arena The arena obtained from simd_arena_create().
+void simd_arena_destroy(SimdArena *arena) NOTNULL(1);
+
 /// @brief Sets the contents of a floating point array to the specified value.
 /// @param ptr The array of floating point numbers.
 /// @param value The value to set for all of the array content.
@@ -116,8 +233,87 @@ float *mallocf(size_t length) MALLOC;
 /// @endcode
 /// So array[i] becomes equal to 1.0f, i = 0..99.
 /// @note This function tries to use SIMD instructions available on the host.
+/// Large fills which cannot fit in the last level cache are written with
+/// non-temporal stores, so they do not evict the working set of the
+/// following pipeline stages.
 void memsetf(float *ptr, float value, size_t length) NOTNULL(1);
 
+/// @brief Acts like memsetf(), but splits the array into page aligned
+/// slices initialized concurrently on the shared worker pool
+/// (see simd_parallel_for()).
+/// @details Besides the bandwidth of several cores, this implements the
+/// first-touch placement for freshly allocated buffers on NUMA systems:
+/// each page is faulted by the worker which will process the same slice
+/// later, so the kernel places it on that worker's node and the threaded
+/// kernels avoid cross-socket traffic. For that to work, threads should
+/// match the slicing of the later processing (usually the same thread
+/// count).
+/// @param ptr The array of floating point numbers.
+/// @param value The value to set for all of the array content.
+/// @param length The length of the array (in float-s, not in bytes).
+/// @param threads The number of slices, or 0 for simd_get_num_threads().
+void memsetf_parallel(float *ptr, float value, size_t length,
+                      int threads) NOTNULL(1);
+
+/// @brief Acts like memcpy() on arrays of floating point numbers, but
+/// writes the destination with non-temporal (streaming) stores, bypassing
+/// the caches. Use it for buffers much larger than the last level cache
+/// which will not be read back soon; for small hot buffers plain memcpy()
+/// is faster.
+/// @param dest The destination array.
+/// @param src The source array. It must not overlap with dest.
+/// @param length The length of both arrays (in float-s, not in bytes).
+/// @return dest.
+float *memcpyf_stream(float *__restrict dest,
+                      const float *__restrict src, size_t length)
+NOTNULL(1, 2);
+
+/// @brief Returns the number of complete overlapped frames
+/// frame_extract() emits for a signal of the given length.
+/// @param length The length of the signal (in float-s, not in bytes).
+/// @param frameSize The length of every frame in float-s.
+/// @param hopSize The step between successive frame starts in float-s.
+/// @return The number of frames (0 if the signal is shorter than one
+/// frame).
+size_t frame_extract_count(size_t length, size_t frameSize, size_t hopSize);
+
+/// @brief Slices a signal into overlapped analysis frames (the usual
+/// STFT-style layout: frame f starts at f * hopSize), storing them
+/// contiguously in dst.
+/// @details Instead of one strided copy loop per frame, which rereads
+/// every sample frameSize / hopSize times with poor prefetch behavior,
+/// the source is swept once front to back hop by hop: each hop segment is
+/// prefetched ahead of the sweep and scattered to every frame containing
+/// it while it is still in L1, so each source cache line is fetched from
+/// memory only once.
+/// @param src The signal to slice.
+/// @param length The length of the signal (in float-s, not in bytes).
+/// @param frameSize The length of every frame in float-s.
+/// @param hopSize The step between successive frame starts in float-s
+/// (hopSize <= frameSize; frameSize / 4 gives the common 75% overlap).
+/// @param dst The frames, stored contiguously
+/// (frame_extract_count() blocks of frameSize float-s each).
+void frame_extract(const float *__restrict src, size_t length,
+                   size_t frameSize, size_t hopSize,
+                   float *__restrict dst) NOTNULL(1, 5);
+
+/// @brief Builds zero-copy views of the overlapped frames instead of
+/// extracting them: frames[f] simply points at src + f * hopSize.
+/// @details Only succeeds when hopSize is a multiple of the SIMD
+/// alignment quantum (in float-s), so every view keeps the alignment of
+/// src and kernels expecting malloc_aligned() inputs can consume the
+/// views directly. Otherwise nothing is written and the caller should
+/// fall back to frame_extract().
+/// @param src The signal to slice.
+/// @param length The length of the signal (in float-s, not in bytes).
+/// @param frameSize The length of every frame in float-s.
+/// @param hopSize The step between successive frame starts in float-s.
+/// @param frames Receives frame_extract_count() pointers into src.
+/// @return 1 if the views were built, 0 if hopSize breaks the alignment.
+int frame_extract_views(const float *src, size_t length,
+                        size_t frameSize, size_t hopSize,
+                        const float **frames) NOTNULL(1, 5);
+
 /// @brief Allocates a new aligned memory block of size
 /// (nearest power of 2 greater than length) * 2, the contents in
 /// the difference in lengths being set to zero.
@@ -150,6 +346,21 @@ void memsetf(float *ptr, float value, size_t length) NOTNULL(1);
 float *zeropadding(const float *ptr, size_t length, size_t *newLength)
 NOTNULL(1, 3) MALLOC;
 
+/// @brief Acts like zeropadding(), but fills a buffer owned by the caller
+/// instead of allocating a new one, so hot loops which pad the same-shaped
+/// window over and over can reuse one buffer and stay allocation-free.
+/// @param dst The destination array. Unlike zeropadding(), its length is
+/// chosen by the caller and is not rounded to a power of 2.
+/// @param dstLength The length of dst (in float-s, not in bytes). It must
+/// be greater than or equal to srcLength.
+/// @param src The array to copy into the beginning of dst; the rest of dst
+/// is set to zero.
+/// @param srcLength The length of src (in float-s, not in bytes).
+/// @return dst.
+/// @note This function tries to use SIMD instructions available on the host.
+float *zeropadding_to(float *dst, size_t dstLength,
+                      const float *src, size_t srcLength) NOTNULL(1, 3);
+
 /// @brief Acts like zeropadding(), but it is possible to request some extra
 /// space at the end of the newly allocated array, which is too filled
 /// with zeros.
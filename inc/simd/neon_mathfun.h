@@ -331,6 +331,80 @@ static inline v4sf sqrt_ps(v4sf val) {
   return est;
 }
 
+/* reciprocal estimate refined with two Newton-Raphson iterations;
+   NEON has no division instruction */
+static inline v4sf recip_ps(v4sf den) {
+  v4sf est = vrecpeq_f32(den);
+  est = vmulq_f32(vrecpsq_f32(den, est), est);
+  est = vmulq_f32(vrecpsq_f32(den, est), est);
+  return est;
+}
+
+#define c_atan_p0 0.99997726f
+#define c_atan_p1 -0.33262347f
+#define c_atan_p2 0.19354346f
+#define c_atan_p3 -0.11643287f
+#define c_atan_p4 0.05265332f
+#define c_atan_p5 -0.01172120f
+#define c_pi 3.14159265358979f
+#define c_pi_over_2 1.57079632679490f
+
+/* atan2(y, x); the octant is reduced with min/max so the polynomial
+   argument stays in [0, 1], accurate to about 1e-6 radian.
+   atan2(0, -0.f) returns 0 instead of pi. */
+static inline v4sf atan2_ps(v4sf y, v4sf x) {
+  v4su sign_mask = vdupq_n_u32(0x80000000u);
+  v4sf abs_y = vabsq_f32(y);
+  v4sf abs_x = vabsq_f32(x);
+  v4sf mx = vmaxq_f32(abs_x, abs_y);
+  v4sf mn = vminq_f32(abs_x, abs_y);
+  v4sf t = vmulq_f32(mn, recip_ps(mx));
+  /* zero the 0/0 lanes so atan2(0, 0) comes out as 0 */
+  v4su nonzero = vcgtq_f32(mx, vdupq_n_f32(0));
+  t = vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(t), nonzero));
+  v4sf q = vmulq_f32(t, t);
+  v4sf a = vdupq_n_f32(c_atan_p5);
+  a = vmlaq_f32(vdupq_n_f32(c_atan_p4), a, q);
+  a = vmlaq_f32(vdupq_n_f32(c_atan_p3), a, q);
+  a = vmlaq_f32(vdupq_n_f32(c_atan_p2), a, q);
+  a = vmlaq_f32(vdupq_n_f32(c_atan_p1), a, q);
+  a = vmlaq_f32(vdupq_n_f32(c_atan_p0), a, q);
+  a = vmulq_f32(a, t);
+  /* undo the reduction: mirror across pi/4 and across the y axis */
+  v4su mask = vcgtq_f32(abs_y, abs_x);
+  a = vbslq_f32(mask, vsubq_f32(vdupq_n_f32(c_pi_over_2), a), a);
+  mask = vcltq_f32(x, vdupq_n_f32(0));
+  a = vbslq_f32(mask, vsubq_f32(vdupq_n_f32(c_pi), a), a);
+  /* the result lies in [0, pi]; transfer the sign of y */
+  v4su sign_y = vandq_u32(vreinterpretq_u32_f32(y), sign_mask);
+  return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(a), sign_y));
+}
+
+/* sqrt(x^2 + y^2); sqrt_ps is built on the reciprocal square root
+   estimate which returns nan at 0, so the zero lanes are forced to 0 */
+static inline v4sf hypot_ps(v4sf x, v4sf y) {
+  v4sf sum = vmlaq_f32(vmulq_f32(x, x), y, y);
+  v4sf root = sqrt_ps(sum);
+  v4su nonzero = vcgtq_f32(sum, vdupq_n_f32(0));
+  return vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(root),
+                                         nonzero));
+}
+
+/* hyperbolic tangent as (e^2x - 1) / (e^2x + 1); exp_ps saturates its
+   argument, so large inputs come out as exactly +-1 instead of nan */
+static inline v4sf tanh_ps(v4sf x) {
+  v4sf one = vdupq_n_f32(1);
+  v4sf e = exp_ps(vaddq_f32(x, x));
+  return vmulq_f32(vsubq_f32(e, one), recip_ps(vaddq_f32(e, one)));
+}
+
+/* the logistic function 1 / (1 + e^-x) */
+static inline v4sf sigmoid_ps(v4sf x) {
+  v4sf one = vdupq_n_f32(1);
+  v4sf e = exp_ps(vnegq_f32(x));
+  return recip_ps(vaddq_f32(e, one));
+}
+
 #pragma GCC diagnostic pop
 
 #endif  // INC_SIMD_NEON_MATHFUN_H_
@@ -31,11 +31,24 @@
 #ifndef INC_SIMD_NORMALIZE_H_
 #define INC_SIMD_NORMALIZE_H_
 
+#include <stddef.h>
 #include <stdint.h>
 #include <simd/common.h>
 
 SIMD_API_BEGIN
 
+/// @brief Sets the number of worker threads normalize2D() and minmax2D()
+/// are allowed to use (1, the default, keeps them single-threaded).
+/// @details The plane is split into horizontal row panels, one per
+/// worker. In normalize2D() the workers scan their panels for the
+/// minimum and the maximum, meet at a barrier to reduce the partial
+/// results and then scale their panels, so the plane is traversed by all
+/// cores in both passes. The value is a process-wide setting which is
+/// supposed to be assigned once at startup; planes with too few rows
+/// fall back to fewer threads or the serial path.
+/// @param threads The number of threads (>= 1).
+void normalize_set_threads(int threads);
+
 /// @brief Performs the plane normalization [min, max] -> [-1, 1]. Minimum
 /// and maximum is determined from the array.
 /// @param simd Value indicating whether to use available SIMD acceleration.
@@ -49,6 +62,32 @@ void normalize2D(int simd, const uint8_t *src, int src_stride,
                  int width, int height, float *dst, int dst_stride)
     NOTNULL(2, 6);
 
+/// @brief Performs the plane normalization in a single pass over the
+/// source, scaling with a caller-supplied range.
+/// @details The plane is processed in cache-sized tiles: each tile is
+/// scanned for its minimum and maximum and scaled immediately while it
+/// is still resident, so the source is read from DRAM once instead of
+/// twice. The scaling uses the range passed in through min and max
+/// (typically the exact range of the previous frame); on return min and
+/// max are overwritten with the exact range of this plane, ready to be
+/// fed to the next call. Seed with 0 and 255 when no better estimate
+/// exists. If the supplied range is stale, output values may fall
+/// slightly outside [-1, 1].
+/// @param simd Value indicating whether to use available SIMD acceleration.
+/// @param src The source byte array, stored in row-major format.
+/// @param src_stride The stride (the actual width) of the plane.
+/// @param width The width of the plane.
+/// @param height The height of the plane.
+/// @param dst The resulting floating point array.
+/// @param dst_stride The stride of dst.
+/// @param min The scaling minimum on input, the exact plane minimum on
+/// output.
+/// @param max The scaling maximum on input, the exact plane maximum on
+/// output.
+void normalize2D_fused(int simd, const uint8_t *src, int src_stride,
+                       int width, int height, float *dst, int dst_stride,
+                       uint8_t *min, uint8_t *max) NOTNULL(2, 6, 8, 9);
+
 /// @brief Finds the minimum and the maximum value in the specified array.
 /// @param simd Value indicating whether to use available SIMD acceleration.
 /// @param src The source byte array, stored in row-major format.
@@ -78,6 +117,86 @@ void normalize2D_minmax(int simd, uint8_t min, uint8_t max,
                         int width, int height, float *dst, int dst_stride)
     NOTNULL(4, 8);
 
+/// @brief Performs the plane normalization [min, max] -> [-32767, 32767]
+/// with int16 output. Minimum and maximum is determined from the array.
+/// @details The values are rounded to the nearest integer and packed
+/// with signed saturation, so quantized consumers can use the output
+/// directly without a float intermediate.
+/// @param simd Value indicating whether to use available SIMD acceleration.
+/// @param src The source byte array, stored in row-major format.
+/// @param src_stride The stride (the actual width) of the plane.
+/// @param width The width of the plane.
+/// @param height The height of the plane.
+/// @param dst The resulting int16 array.
+/// @param dst_stride The stride of dst.
+void normalize2D_i16(int simd, const uint8_t *src, int src_stride,
+                     int width, int height, int16_t *dst, int dst_stride)
+    NOTNULL(2, 6);
+
+/// @brief Splits an interleaved RGBRGB... byte buffer into three planes.
+/// @param simd Value indicating whether to use available SIMD acceleration.
+/// @param src The interleaved source buffer of pixels * 3 bytes.
+/// @param pixels The number of pixels.
+/// @param r The resulting red plane of pixels bytes.
+/// @param g The resulting green plane of pixels bytes.
+/// @param b The resulting blue plane of pixels bytes.
+void deinterleave_rgb(int simd, const uint8_t *src, size_t pixels,
+                      uint8_t *r, uint8_t *g, uint8_t *b)
+    NOTNULL(2, 4, 5, 6);
+
+/// @brief Merges three planes into an interleaved RGBRGB... byte buffer.
+/// @param simd Value indicating whether to use available SIMD acceleration.
+/// @param r The red plane of pixels bytes.
+/// @param g The green plane of pixels bytes.
+/// @param b The blue plane of pixels bytes.
+/// @param pixels The number of pixels.
+/// @param dst The resulting interleaved buffer of pixels * 3 bytes.
+void interleave_rgb(int simd, const uint8_t *r, const uint8_t *g,
+                    const uint8_t *b, size_t pixels, uint8_t *dst)
+    NOTNULL(2, 3, 4, 6);
+
+/// @brief The running-range state for normalize_stream_feed().
+/// The struct is plain data and may be copied or persisted freely.
+typedef struct {
+  uint8_t min;  ///< The cached running minimum.
+  uint8_t max;  ///< The cached running maximum.
+  int frames_left;  ///< Frames until the next full rescan.
+  int rescan_interval;  ///< Full minmax2D() every this many frames.
+  int decay;  ///< Per-frame widening of the cached range, in levels.
+} NormalizeStreamHandle;
+
+/// @brief Prepares the running-range state for a video stream.
+/// @details Live video rarely needs an exact per-frame range, and an
+/// exact one causes visible flicker when the extremes jump between
+/// frames. The stream mode rescans the plane with minmax2D() only every
+/// rescan_interval frames and feeds the cached range straight into
+/// normalize2D_minmax() in between, halving the per-frame cost. Between
+/// rescans the cached range is widened by decay levels on each side per
+/// frame, so content drifting outside the cached range clips less
+/// before the next rescan snaps the range tight again.
+/// @param rescan_interval The number of frames between exact rescans
+/// (>= 1; 1 degenerates to normalize2D()).
+/// @param decay The per-frame widening of the cached range in intensity
+/// levels (>= 0; 0 freezes the range between rescans).
+/// @return The handle for normalize_stream_feed().
+NormalizeStreamHandle normalize_stream_initialize(int rescan_interval,
+                                                  int decay);
+
+/// @brief Normalizes the next frame of the stream, updating the running
+/// range kept in the handle.
+/// @param handle The structure obtained from normalize_stream_initialize().
+/// @param simd Value indicating whether to use available SIMD acceleration.
+/// @param src The source byte array, stored in row-major format.
+/// @param src_stride The stride (the actual width) of the plane.
+/// @param width The width of the plane.
+/// @param height The height of the plane.
+/// @param dst The resulting floating point array.
+/// @param dst_stride The stride of dst.
+void normalize_stream_feed(NormalizeStreamHandle *handle, int simd,
+                           const uint8_t *src, int src_stride,
+                           int width, int height,
+                           float *dst, int dst_stride) NOTNULL(1, 3, 7);
+
 /// @brief Finds the minimum and the maximum value in the specified array.
 /// @param simd Value indicating whether to use available SIMD acceleration.
 /// @param src The source floating point array.
@@ -89,6 +208,27 @@ void normalize2D_minmax(int simd, uint8_t min, uint8_t max,
 void minmax1D(int simd, const float *src, int length, float *min,
               float *max) NOTNULL(2);
 
+/// @brief Finds the minimum and the maximum value in the specified array
+/// together with their positions, in a single pass.
+/// @details The SIMD kernels track index vectors alongside the value
+/// vectors in the compare loops, so no second scan over the buffer is
+/// needed. The position of the first occurrence is reported.
+/// @param simd Value indicating whether to use available SIMD acceleration.
+/// @param src The source floating point array.
+/// @param length The size of the array (in float-s, not in bytes).
+/// Must be less than 2^24.
+/// @param min The pointer to the resulting minimum. If NULL, it is not
+/// stored.
+/// @param min_idx The pointer to the position of the minimum. If NULL,
+/// it is not stored.
+/// @param max The pointer to the resulting maximum. If NULL, it is not
+/// stored.
+/// @param max_idx The pointer to the position of the maximum. If NULL,
+/// it is not stored.
+void argminmax1D(int simd, const float *src, int length,
+                 float *min, int *min_idx, float *max, int *max_idx)
+    NOTNULL(2);
+
 SIMD_API_END
 
 #endif  // INC_SIMD_NORMALIZE_H_
@@ -0,0 +1,77 @@
+/*! @file parallel.h
+ *  @brief Library-wide persistent worker pool.
+ *  @author Markovtsev Vadim <v.markovtsev@samsung.com>
+ *  @version 1.0
+ *
+ *  @section Notes
+ *  This code partially conforms to <a href="http://google-styleguide.googlecode.com/svn/trunk/cppguide.xml">Google C++ Style Guide</a>.
+ *
+ *  All the threaded kernels (matrix_multiply(), normalize2D(),
+ *  convolve_overlap_save(), stationary_wavelet_apply_threads()) run their
+ *  workers through this single pool instead of spawning threads on every
+ *  call: at a 2 ms frame budget the pthread_create()/join() round trip
+ *  would erase the gains. The pool threads are started once, pinned to
+ *  consecutive CPUs on Linux and kept warm between calls.
+ *
+ *  @section Copyright
+ *  Copyright © 2013 Samsung R&D Institute Russia
+ *
+ *  @section License
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#ifndef INC_SIMD_PARALLEL_H_
+#define INC_SIMD_PARALLEL_H_
+
+#include <stddef.h>
+#include <simd/common.h>
+#include <simd/attributes.h>
+
+SIMD_API_BEGIN
+
+/// @brief The task executed by simd_parallel_for(): index identifies the
+/// slice of work (0 <= index < count) and user is passed through verbatim.
+typedef void (*simd_parallel_func)(size_t index, void *user);
+
+/// @brief Sets the default number of worker threads the parallel kernels
+/// use and resizes the pool accordingly. The initial value is the number
+/// of online CPUs. The per-kernel setters (matrix_set_threads() and
+/// friends) still decide how many slices each kernel cuts; this call
+/// only sizes and pre-warms the shared pool those slices run on.
+/// @param threads The number of participating threads (>= 1; 1 disables
+/// the pool and every kernel runs serially by default).
+void simd_set_num_threads(int threads);
+
+/// @brief Returns the value set with simd_set_num_threads() (the number
+/// of online CPUs until then).
+int simd_get_num_threads(void);
+
+/// @brief Runs func(0, user) ... func(count - 1, user), each index on its
+/// own thread, and returns when all of them finished. The caller executes
+/// index 0 itself; the remaining indices go to the persistent pool
+/// threads, which are created on first use and kept warm afterwards. All
+/// count indices run concurrently, so the tasks may synchronize with each
+/// other (normalize2D() relies on this for its min/max barrier).
+/// @note The pool serializes the dispatches: calling this from inside a
+/// task deadlocks.
+void simd_parallel_for(simd_parallel_func func, size_t count, void *user)
+    NOTNULL(1);
+
+SIMD_API_END
+
+#endif  // INC_SIMD_PARALLEL_H_
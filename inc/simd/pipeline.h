@@ -0,0 +1,144 @@
+/*! @file pipeline.h
+ *  @brief Fused kernel pipelines executed tile by tile.
+ *  @author Markovtsev Vadim <v.markovtsev@samsung.com>
+ *  @version 1.0
+ *
+ *  @section Notes
+ *  This code partially conforms to <a href="http://google-styleguide.googlecode.com/svn/trunk/cppguide.xml">Google C++ Style Guide</a>.
+ *
+ *  @section Copyright
+ *  Copyright © 2013 Samsung R&D Institute Russia
+ *
+ *  @section License
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#ifndef INC_SIMD_PIPELINE_H_
+#define INC_SIMD_PIPELINE_H_
+
+#include <stddef.h>
+#include <simd/common.h>
+#include <simd/attributes.h>
+#include <simd/detect_peaks.h>
+
+SIMD_API_BEGIN
+
+/// @brief A registered sequence of kernels executed over cache sized tiles.
+/// @details Chaining the kernels one whole array at a time materializes an
+/// intermediate array per stage, each streamed to and from DRAM. A pipeline
+/// instead pushes one tile through every stage before touching the next
+/// tile, so the intermediates stay in cache and the input is read from
+/// memory once per frame. The stages which need context across tile
+/// boundaries (the FIR convolution and the peak detection) keep their carry
+/// inside the pipeline, which also makes execute calls streamable: feeding
+/// a signal as several frames yields the same FIR output as one big frame.
+typedef struct SimdPipeline SimdPipeline;
+
+/// @brief Creates an empty pipeline.
+/// @param simd Value indicating whether the stages use SIMD acceleration.
+/// @param tileSize The tile length in float-s (0 picks a cache friendly
+/// default). Must be at least 3 otherwise: the peak detection carry needs
+/// chunks of at least two samples, and with a cap of 2 an odd signal
+/// length cannot avoid a single trailing sample.
+/// @return The pipeline to register stages on, to be disposed with
+/// simd_pipeline_finalize().
+SimdPipeline *simd_pipeline_initialize(int simd, size_t tileSize) MALLOC;
+
+/// @brief Appends an int16_to_float() conversion stage.
+/// @details May only be the first stage; simd_pipeline_execute() then takes
+/// int16_t input instead of float.
+/// @param pipeline The pipeline being built.
+void simd_pipeline_add_int16_to_float(SimdPipeline *pipeline) NOTNULL(1);
+
+/// @brief Appends a stage multiplying the frame by a window element-wise
+/// (real_multiply_array()).
+/// @param pipeline The pipeline being built.
+/// @param window The window coefficients, indexed by the position within
+/// the executed frame. The array is not copied and must outlive the
+/// pipeline.
+/// @param length The length of window in float-s. Every executed frame must
+/// not be longer than this.
+void simd_pipeline_add_window(SimdPipeline *pipeline, const float *window,
+                              size_t length) NOTNULL(1, 2);
+
+/// @brief Appends a causal FIR convolution stage:
+/// result[i] = Σ h[k] · x[i - k], with x[i] = 0 before the first executed
+/// sample.
+/// @details Unlike convolve(), the stage emits exactly one output sample
+/// per input sample (the first length samples of the full convolution) and
+/// carries the trailing h history across tiles and across execute calls.
+/// Call simd_pipeline_reset() to start an unrelated signal.
+/// @param pipeline The pipeline being built.
+/// @param h The filter coefficients (copied).
+/// @param hLength The length of h in float-s (>= 1).
+void simd_pipeline_add_fir(SimdPipeline *pipeline, const float *h,
+                           size_t hLength) NOTNULL(1, 2);
+
+/// @brief Appends an affine scaling stage:
+/// result[i] = value[i] · multiplier + offset (e.g. the [min, max] to
+/// [0, 255] mapping of normalize2D() with precomputed coefficients).
+/// @param pipeline The pipeline being built.
+/// @param multiplier The factor every value is multiplied by.
+/// @param offset The constant added to every product.
+void simd_pipeline_add_scale(SimdPipeline *pipeline, float multiplier,
+                             float offset) NOTNULL(1);
+
+/// @brief Appends a terminal peak detection stage (see detect_peaks()).
+/// @details Must be the last stage. The extrema found by the executes since
+/// the last reset are retrieved with simd_pipeline_get_peaks().
+/// @param pipeline The pipeline being built.
+/// @param type The type of the extracted extrema.
+void simd_pipeline_add_detect_peaks(SimdPipeline *pipeline,
+                                    ExtremumType type) NOTNULL(1);
+
+/// @brief Pushes one frame through every registered stage, tile by tile.
+/// @param pipeline The built pipeline.
+/// @param input The frame: int16_t values when the first stage is the
+/// int16_to_float() conversion, float values otherwise.
+/// @param length The length of the frame in samples (>= 2).
+/// @param output The array of length float-s the last stage's values are
+/// written to. May be NULL when the pipeline ends with the peak detection
+/// stage and the samples themselves are not needed.
+void simd_pipeline_execute(SimdPipeline *pipeline, const void *input,
+                           size_t length, float *output) NOTNULL(1, 2);
+
+/// @brief Retrieves the extrema accumulated by the peak detection stage
+/// since the last reset.
+/// @param pipeline The pipeline which ends with the peak detection stage.
+/// @param results The pointer to the array of ExtremumPoint-s with the
+/// positions counted across all the executed frames. The array is owned by
+/// the pipeline and is invalidated by the next execute, reset or finalize.
+/// If no points were found, it is set to NULL.
+/// @param resultsLength The number of found extremum points.
+void simd_pipeline_get_peaks(const SimdPipeline *pipeline,
+                             ExtremumPoint **results,
+                             size_t *resultsLength) NOTNULL(1, 2, 3);
+
+/// @brief Clears the FIR histories and the accumulated peaks, so the next
+/// execute starts a fresh signal.
+/// @param pipeline The built pipeline.
+void simd_pipeline_reset(SimdPipeline *pipeline) NOTNULL(1);
+
+/// @brief Frees any resources allocated by simd_pipeline_initialize() and
+/// the stage registrations.
+/// @param pipeline The pipeline to dispose.
+void simd_pipeline_finalize(SimdPipeline *pipeline) NOTNULL(1);
+
+SIMD_API_END
+
+#endif  // INC_SIMD_PIPELINE_H_
@@ -0,0 +1,114 @@
+/*! @file stats.h
+ *  @brief Opt-in per-kernel instrumentation counters.
+ *  @author Markovtsev Vadim <v.markovtsev@samsung.com>
+ *  @version 1.0
+ *
+ *  @section Notes
+ *  This code partially conforms to <a href="http://google-styleguide.googlecode.com/svn/trunk/cppguide.xml">Google C++ Style Guide</a>.
+ *
+ *  The counters are compiled into the kernel dispatchers only when the
+ *  library is configured with --enable-simd-stats (that is, built with
+ *  -DSIMD_STATS); in the default build the accounting macros expand to
+ *  nothing and the only cost is the simd_stats_snapshot() symbol, which
+ *  then reports zeros. With the counters enabled every dispatcher adds
+ *  one cycle counter read at entry and exit plus three atomic additions,
+ *  which is negligible next to any kernel body.
+ *
+ *  @section Copyright
+ *  Copyright © 2013 Samsung R&D Institute Russia
+ *
+ *  @section License
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#ifndef INC_SIMD_STATS_H_
+#define INC_SIMD_STATS_H_
+
+#include <stdint.h>
+#include <simd/common.h>
+#include <simd/attributes.h>
+
+SIMD_API_BEGIN
+
+/// @brief The kernel families which are counted separately.
+typedef enum {
+  SIMD_KERNEL_CONVOLVE = 0,
+  SIMD_KERNEL_MATRIX,
+  SIMD_KERNEL_NORMALIZE,
+  SIMD_KERNEL_WAVELET,
+  SIMD_KERNEL_COUNT
+} SimdKernel;
+
+/// @brief The counters gathered for one kernel family.
+typedef struct {
+  /// The number of dispatcher calls.
+  uint64_t invocations;
+  /// The total number of processed elements (samples, matrix cells or
+  /// pixels, depending on the family).
+  uint64_t elements;
+  /// The total number of cycles spent inside the dispatchers, read from
+  /// the time stamp counter (rdtsc on x86, cntvct_el0 on AArch64; zero
+  /// on other platforms).
+  uint64_t cycles;
+} SimdKernelStats;
+
+/// @brief Copies the accumulated counters of every kernel family into
+/// stats (indexed by SimdKernel) and resets them to zero, so successive
+/// snapshots report disjoint intervals. The counters are summed over all
+/// threads. Without -DSIMD_STATS every field is zero.
+/// @param stats An array of at least SIMD_KERNEL_COUNT elements.
+void simd_stats_snapshot(SimdKernelStats stats[]) NOTNULL(1);
+
+/// @brief Internal: accumulates one dispatcher call. The kernels invoke
+/// this through the SIMD_STATS_* macros below; it is not meant to be
+/// called directly.
+void simd_stats_account(SimdKernel kernel, uint64_t elements,
+                        uint64_t cycles);
+
+SIMD_API_END
+
+#ifdef SIMD_STATS
+
+/// @brief Reads the cycle counter the instrumentation timestamps with.
+INLINE uint64_t simd_stats_cycles(void) {
+#if defined(__i386__) || defined(__x86_64__)
+  unsigned int lo, hi;
+  __asm__ __volatile__("rdtsc" : "=a"(lo), "=d"(hi));
+  return ((uint64_t)hi << 32) | lo;
+#elif defined(__aarch64__)
+  uint64_t value;
+  __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(value));
+  return value;
+#else
+  return 0;
+#endif
+}
+
+#define SIMD_STATS_START() uint64_t simd_stats_start_ = simd_stats_cycles()
+#define SIMD_STATS_FINISH(kernel, elements) \
+  simd_stats_account(kernel, (uint64_t)(elements), \
+                     simd_stats_cycles() - simd_stats_start_)
+
+#else
+
+#define SIMD_STATS_START() do { } while (0)
+#define SIMD_STATS_FINISH(kernel, elements) do { } while (0)
+
+#endif  // SIMD_STATS
+
+#endif  // INC_SIMD_STATS_H_
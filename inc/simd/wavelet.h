@@ -78,6 +78,47 @@ void wavelet_recycle_source(int order, float *src, size_t length,
                             float **destlohi, float **destlolo)
     NOTNULL(2, 4, 5, 6, 7);
 
+typedef struct {
+  WaveletType type;
+  int order;
+  size_t length;
+  /// The owned buffer src is copied into (in the prepared format).
+  float *source;
+  /// The owned highpass destination of size length/2.
+  float *desthi;
+  /// The owned lowpass destination of size length/2.
+  float *destlo;
+} WaveletHandle;
+
+/// @brief Prepares for repeated wavelet transforms of signals of the same
+/// length, allocating the prepared source and the destinations once.
+/// @details Calling wavelet_prepare_array() and
+/// wavelet_allocate_destination() per invocation makes the allocator
+/// dominate short transforms; with a handle, steady-state operation is
+/// allocation-free and only the new samples are copied in.
+/// @param type The wavelet type.
+/// @param order The order of the wavelet to apply.
+/// @param length The logical length of the transformed signals
+/// (in float-s, not in bytes).
+/// @return The handle for wavelet_transform(), to be disposed with
+/// wavelet_finalize().
+WaveletHandle wavelet_initialize(WaveletType type, int order, size_t length);
+
+/// @brief Performs a single wavelet transform using the preallocated
+/// buffers of the handle.
+/// @param handle The structure obtained from wavelet_initialize().
+/// @param ext The way to extend the signal.
+/// @param src An array of handle.length floating point numbers to
+/// transform. It is copied into handle.source.
+/// @details The results are left in handle.desthi and handle.destlo
+/// (length/2 float-s each).
+void wavelet_transform(WaveletHandle handle, ExtensionType ext,
+                       const float *src) NOTNULL(3);
+
+/// @brief Frees any resources allocated by wavelet_initialize().
+/// @param handle The structure obtained from wavelet_initialize().
+void wavelet_finalize(WaveletHandle handle);
+
 /// @brief Performs a single wavelet transform on series of real numbers.
 /// @param type The wavelet type.
 /// @param order The order of the wavelet to apply.
@@ -116,6 +157,158 @@ void wavelet_apply_na(WaveletType type, int order, ExtensionType ext,
                       float *__restrict desthi, float *__restrict destlo)
     NOTNULL(4, 6, 7);
 
+/// @brief Performs a multi-level wavelet decomposition on series of real
+/// numbers.
+/// @details All the scratch buffers are allocated up front and reused
+/// between the levels, so unlike looping wavelet_apply() with
+/// wavelet_prepare_array() and wavelet_allocate_destination() by hand,
+/// no per-level allocation or copying of the source happens.
+/// @param type The wavelet type.
+/// @param order The order of the wavelet to apply.
+/// For example, order = 6 means 6 coefficients.
+/// @param ext The way to extend the signal.
+/// @param levels The number of decomposition levels (>= 1).
+/// @param src An array of floating point numbers to transform.
+/// @param length The logical length of src (in float-s, not in bytes).
+/// It must be a multiple of 2^levels.
+/// @param dest The resulting coefficients, length float-s in total: the
+/// highpass part of every level in order, followed by the lowpass part of
+/// the last level, that is, [D1, D2, .., Dlevels, Alevels] where Dk takes
+/// length / 2^k float-s and Alevels takes length / 2^levels float-s.
+/// @pre The length of the last level (length / 2^(levels - 1)) must satisfy
+/// the preconditions of wavelet_apply().
+void wavelet_decompose(WaveletType type, int order, ExtensionType ext,
+                       int levels, const float *__restrict src, size_t length,
+                       float *__restrict dest) NOTNULL(5, 7);
+
+/// @brief Performs a single wavelet transform on a batch of equal-length
+/// series of real numbers.
+/// @details The filter coefficients are set up once for the whole batch
+/// and groups of signals are interleaved sample-major, so the batch
+/// dimension fills all the SIMD lanes regardless of the wavelet order.
+/// Looping wavelet_apply() instead reloads the coefficient tables per
+/// signal and leaves lanes idle for short filters.
+/// @param type The wavelet type.
+/// @param order The order of the wavelet to apply.
+/// For example, order = 6 means 6 coefficients.
+/// @param ext The way to extend the signals.
+/// @param srcs The signals to transform, count pointers of length float-s
+/// each. No prepared layout is required.
+/// @param count The number of signals.
+/// @param length The logical length of every signal (in float-s, not in
+/// bytes).
+/// @param desthi The high frequency parts of the results (highpass),
+/// count pointers of at least length/2 float-s each.
+/// @param destlo The low frequency parts of the results (lowpass),
+/// count pointers of at least length/2 float-s each.
+/// @pre length must be greater than or equal to (order * 2).
+/// @pre length must be even.
+void wavelet_apply_batch(WaveletType type, int order, ExtensionType ext,
+                         const float *const *srcs, size_t count,
+                         size_t length,
+                         float *const *desthi, float *const *destlo)
+    NOTNULL(4, 7, 8);
+
+/// @brief Performs a single separable 2D wavelet transform on an image,
+/// producing the standard LL/LH/HL/HH sub-bands.
+/// @details The rows are split first (lowpass into the left half of every
+/// row, highpass into the right), then the columns (lowpass into the top
+/// half, highpass into the bottom), so the quadrants of dst are, from the
+/// top-left clockwise: LL, LH, HH, HL, each of size width/2 x height/2.
+/// The column pass fills the SIMD lanes with adjacent columns, so it runs
+/// at full width without any transposes or strided loads.
+/// @param type The wavelet type.
+/// @param order The order of the wavelet to apply.
+/// For example, order = 6 means 6 coefficients.
+/// @param ext The way to extend the rows and the columns.
+/// @param src The image, stored tightly (height rows of width float-s).
+/// @param width The width of the image in float-s.
+/// @param height The height of the image.
+/// @param dst The sub-bands, of the same size and layout as src.
+/// @pre width and height must be even and greater than or equal to
+/// (order * 2).
+/// @note dst may NOT overlap src.
+void wavelet_apply_2d(WaveletType type, int order, ExtensionType ext,
+                      const float *__restrict src, size_t width,
+                      size_t height, float *__restrict dst) NOTNULL(4, 7);
+
+/// @brief Performs a single inverse wavelet transform, fusing the highpass
+/// and the lowpass parts back into the original series of real numbers.
+/// @param type The wavelet type.
+/// @param order The order of the wavelet which was applied.
+/// @param desthi The high frequency part (highpass) of size length/2.
+/// @param destlo The low frequency part (lowpass) of size length/2.
+/// @param length The logical length of dest (in float-s, not in bytes).
+/// @param dest The reconstructed signal of size length.
+/// @details Exactly inverts wavelet_apply() performed with
+/// EXTENSION_TYPE_PERIODIC (the wrapped tail of other extension types is
+/// not recoverable).
+/// @pre length must be greater than or equal to order.
+/// @pre length must be even.
+void wavelet_synthesize(WaveletType type, int order,
+                        const float *__restrict desthi,
+                        const float *__restrict destlo,
+                        size_t length, float *__restrict dest)
+    NOTNULL(3, 4, 6);
+
+/// @brief Performs a single inverse wavelet transform, fusing the highpass
+/// and the lowpass parts back into the original series of real numbers
+/// (no SIMD acceleration is used).
+/// @param type The wavelet type.
+/// @param order The order of the wavelet which was applied.
+/// @param desthi The high frequency part (highpass) of size length/2.
+/// @param destlo The low frequency part (lowpass) of size length/2.
+/// @param length The logical length of dest (in float-s, not in bytes).
+/// @param dest The reconstructed signal of size length.
+/// @pre length must be greater than or equal to order.
+/// @pre length must be even.
+void wavelet_synthesize_na(WaveletType type, int order,
+                           const float *__restrict desthi,
+                           const float *__restrict destlo,
+                           size_t length, float *__restrict dest)
+    NOTNULL(3, 4, 6);
+
+/// @brief Performs a multi-level inverse wavelet transform, rebuilding the
+/// original series of real numbers from the coefficients emitted by
+/// wavelet_decompose().
+/// @param type The wavelet type.
+/// @param order The order of the wavelet which was applied.
+/// @param levels The number of decomposition levels (>= 1).
+/// @param coeffs The coefficients in the wavelet_decompose() layout,
+/// that is, [D1, D2, .., Dlevels, Alevels], length float-s in total.
+/// The coefficients may be modified in place beforehand, e.g. thresholded
+/// for denoising.
+/// @param length The logical length of dest (in float-s, not in bytes).
+/// It must be a multiple of 2^levels.
+/// @param dest The reconstructed signal of size length.
+/// @details Exactly inverts wavelet_decompose() performed with
+/// EXTENSION_TYPE_PERIODIC.
+void wavelet_reconstruct(WaveletType type, int order, int levels,
+                         const float *__restrict coeffs, size_t length,
+                         float *__restrict dest) NOTNULL(4, 6);
+
+/// @brief The same as wavelet_reconstruct(), but thresholds the detail
+/// coefficients of every level on the fly instead of requiring a separate
+/// pass over the coefficient arrays (the usual wavelet denoising setup).
+/// @param type The wavelet type.
+/// @param order The order of the wavelet which was applied.
+/// @param levels The number of decomposition levels (>= 1).
+/// @param coeffs The coefficients in the wavelet_decompose() layout.
+/// They are not modified.
+/// @param length The logical length of dest (in float-s, not in bytes).
+/// It must be a multiple of 2^levels.
+/// @param threshold_type The thresholding rule for the detail coefficients.
+/// @param thresholds The threshold magnitude for every level, levels
+/// float-s; thresholds[0] corresponds to the finest details D1. It may be
+/// NULL if threshold_type is WAVELET_THRESHOLD_NONE.
+/// @param dest The reconstructed signal of size length.
+void wavelet_reconstruct_thresholded(WaveletType type, int order, int levels,
+                                     const float *__restrict coeffs,
+                                     size_t length,
+                                     WaveletThresholdType threshold_type,
+                                     const float *thresholds,
+                                     float *__restrict dest) NOTNULL(4, 8);
+
 /// @brief Performs a single stationary (undecimated) wavelet transform
 /// on series of real numbers.
 /// @param type The wavelet type.
@@ -161,6 +354,107 @@ void stationary_wavelet_apply_na(WaveletType type, int order, int level,
                                  float *__restrict destlo)
     NOTNULL(5, 7, 8);
 
+/// @brief Performs a single stationary (undecimated) wavelet transform
+/// on series of real numbers, splitting the work between several threads.
+/// @details The undecimated transform of every output sample only looks
+/// at the order * 2^(level - 1) input samples which follow it, so the
+/// signal is cut into cache-sized blocks with that halo and the blocks
+/// are processed by the worker threads independently. The result is the
+/// same as from stationary_wavelet_apply(); short signals fall back to
+/// the single-threaded path.
+/// @param type The wavelet type.
+/// @param order The order of the wavelet to apply.
+/// For example, order = 6 means 6 coefficients.
+/// @param level The current decomposition level.
+/// @param ext The way to extend the signal.
+/// @param threads The number of threads to use. Values less than 2 select
+/// the single-threaded stationary_wavelet_apply().
+/// @param src An array of floating point numbers to transform.
+/// @param length The logical length of src (in float-s, not in bytes).
+/// @param desthi The high frequency part of result (highpass). It must be at
+/// least of size length.
+/// @param destlo The low frequency part of result (lowpass). It must be at
+/// least of size length.
+/// @pre length must be greater than or equal to 8.
+/// @pre length must be even.
+void stationary_wavelet_apply_threads(WaveletType type, int order, int level,
+                                      ExtensionType ext, int threads,
+                                      const float *__restrict src,
+                                      size_t length,
+                                      float *__restrict desthi,
+                                      float *__restrict destlo)
+    NOTNULL(6, 8, 9);
+
+/// @brief The same as stationary_wavelet_apply_threads(), but additionally
+/// thresholds the detail coefficients while the transformed block is still
+/// in cache, saving a separate pass over desthi (the usual wavelet
+/// denoising setup).
+/// @param type The wavelet type.
+/// @param order The order of the wavelet to apply.
+/// For example, order = 6 means 6 coefficients.
+/// @param level The current decomposition level.
+/// @param ext The way to extend the signal.
+/// @param threshold_type The thresholding rule for the detail coefficients.
+/// WAVELET_THRESHOLD_NONE makes this function behave exactly like
+/// stationary_wavelet_apply_threads().
+/// @param threshold The threshold magnitude for this level (>= 0).
+/// @param threads The number of threads to use. Values less than 2 select
+/// the single-threaded path.
+/// @param src An array of floating point numbers to transform.
+/// @param length The logical length of src (in float-s, not in bytes).
+/// @param desthi The high frequency part of result (highpass). It must be at
+/// least of size length.
+/// @param destlo The low frequency part of result (lowpass). It must be at
+/// least of size length.
+/// @pre length must be greater than or equal to 8.
+/// @pre length must be even.
+void stationary_wavelet_apply_thresholded(
+    WaveletType type, int order, int level, ExtensionType ext,
+    WaveletThresholdType threshold_type, float threshold, int threads,
+    const float *__restrict src, size_t length,
+    float *__restrict desthi, float *__restrict destlo)
+    NOTNULL(8, 10, 11);
+
+/// @brief The sink for stationary_wavelet_apply_stream(): receives the
+/// transform of the chunk at [offset, offset + count) of the source.
+/// The desthi and destlo arrays belong to the library and are overwritten
+/// by the next chunk, so the consumer must copy out whatever it keeps.
+typedef void (*stationary_wavelet_consumer)(const float *desthi,
+                                            const float *destlo,
+                                            size_t offset, size_t count,
+                                            void *user);
+
+/// @brief Performs a single stationary (undecimated) wavelet transform of
+/// an out-of-core signal, e.g. a multi-GB recording mapped read-only with
+/// simd_mmap_signal(), handing the result to the consumer chunk by chunk.
+/// @details The source is advised as sequential and scanned front to back
+/// in cache-sized chunks, each transformed into two internal chunk-sized
+/// buffers - the memory use stays flat regardless of the signal length
+/// and the kernel's read-ahead overlaps the compute. The delivered
+/// coefficients are identical to one whole-signal
+/// stationary_wavelet_apply().
+/// @param type The wavelet type.
+/// @param order The order of the wavelet to apply.
+/// For example, order = 6 means 6 coefficients.
+/// @param level The current decomposition level.
+/// @param ext The way to extend the signal.
+/// @param src An array of floating point numbers to transform, usually a
+/// read-only file mapping.
+/// @param length The logical length of src (in float-s, not in bytes).
+/// @param chunkSize The number of result samples per consumer call (the
+/// last call may deliver up to order * 2^(level - 1) more), or 0 for a
+/// cache-sized default. Odd values are rounded down.
+/// @param consumer The callback receiving the transformed chunks in order.
+/// @param user An opaque pointer passed to every consumer call.
+/// @pre length must be greater than or equal to 8.
+/// @pre length must be even.
+void stationary_wavelet_apply_stream(WaveletType type, int order, int level,
+                                     ExtensionType ext,
+                                     const float *src, size_t length,
+                                     size_t chunkSize,
+                                     stationary_wavelet_consumer consumer,
+                                     void *user) NOTNULL(5, 8);
+
 SIMD_API_END
 
 #endif  // INC_SIMD_WAVELET_H_
@@ -52,6 +52,16 @@ typedef enum {
   EXTENSION_TYPE_ZERO,
 } ExtensionType;
 
+typedef enum {
+  /// @brief The detail coefficients are stored unchanged.
+  WAVELET_THRESHOLD_NONE,
+  /// @brief Values whose magnitude does not exceed the threshold become zero.
+  WAVELET_THRESHOLD_HARD,
+  /// @brief Hard thresholding plus shrinking the survivors towards zero
+  /// by the threshold.
+  WAVELET_THRESHOLD_SOFT,
+} WaveletThresholdType;
+
 SIMD_API_END
 
 
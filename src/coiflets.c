@@ -31,7 +31,8 @@
 #define WAVELET_INTERNAL_USE
 #include "src/coiflets.h"
 
-const double kCoifletsD[5][30] = {
+const double kCoifletsD[WAVELET_COIFLETS_ROWS][WAVELET_COIFLETS_COLS] = {
+#if WAVELET_MAX_ORDER >= 6
   // 1 (6)
   { -5.14297284710e-02,
      2.38929728471e-01,
@@ -39,7 +40,9 @@ const double kCoifletsD[5][30] = {
      2.72140543058e-01,
     -5.14297284710e-02,
     -1.10702715290e-02 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 12
   // 2 (12)
   {  1.15875967390e-02,
     -2.93201379800e-02,
@@ -53,7 +56,9 @@ const double kCoifletsD[5][30] = {
      3.96788361300e-03,
     -1.28920335600e-03,
     -5.09505399000e-04 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 18
   // 3 (18)
   { -2.68241867100e-03,
      5.50312670900e-03,
@@ -73,7 +78,9 @@ const double kCoifletsD[5][30] = {
      3.29665174000e-04,
     -5.01927750000e-05,
     -2.44657340000e-05 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 24
   // 4 (24)
   {  6.30961046000e-04,
     -1.15222485200e-03,
@@ -99,7 +106,9 @@ const double kCoifletsD[5][30] = {
      2.20828570000e-05,
     -2.30494200000e-06,
     -1.26217500000e-06 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 30
   // 5 (30)
   { -1.49963800000e-04,
      2.53561200000e-04,
@@ -131,106 +140,5 @@ const double kCoifletsD[5][30] = {
      1.45930000000e-06,
     -1.18400000000e-07,
     -6.73000000000e-08 }
-};
-
-const float kCoifletsF[5][30] = {
-  // 1 (6)
-  {-5.1429728e-02f,
-    2.3892973e-01f,
-    6.0285946e-01f,
-    2.7214054e-01f,
-   -5.1429728e-02f,
-   -1.1070272e-02f },
-
-  // 2 (12)
-  { 1.1587597e-02f,
-   -2.9320138e-02f,
-   -4.7639590e-02f,
-    2.7302105e-01f,
-    5.7468239e-01f,
-    2.9486719e-01f,
-   -5.4085607e-02f,
-   -4.2026480e-02f,
-    1.6744410e-02f,
-    3.9678836e-03f,
-   -1.2892034e-03f,
-   -5.0950540e-04f },
-
-  // 3 (18)
-  {-2.6824187e-03f,
-    5.5031267e-03f,
-    1.6583560e-02f,
-   -4.6507764e-02f,
-   -4.3220764e-02f,
-    2.8650334e-01f,
-    5.6128526e-01f,
-    3.0298357e-01f,
-   -5.0770141e-02f,
-   -5.8196251e-02f,
-    2.4434094e-02f,
-    1.1229241e-02f,
-   -6.3696010e-03f,
-   -1.8204589e-03f,
-    7.9020510e-04f,
-    3.2966517e-04f,
-   -5.0192775e-05f,
-   -2.4465734e-05f },
-
-  // 4 (24)
-  { 6.3096105e-04f,
-   -1.1522249e-03f,
-   -5.1945240e-03f,
-    1.1362459e-02f,
-    1.8867235e-02f,
-   -5.7464234e-02f,
-   -3.9652649e-02f,
-    2.9366739e-01f,
-    5.5312645e-01f,
-    3.0715733e-01f,
-   -4.7112739e-02f,
-   -6.8038127e-02f,
-    2.7813640e-02f,
-    1.7735837e-02f,
-   -1.0756319e-02f,
-   -4.0010129e-03f,
-    2.6526659e-03f,
-    8.9559453e-04f,
-   -4.1650057e-04f,
-   -1.8382977e-04f,
-    4.4080354e-05f,
-    2.2082857e-05f,
-   -2.3049420e-06f,
-   -1.2621750e-06f },
-
-  // 5 (30)
-  {-1.4996380e-04f,
-    2.5356120e-04f,
-    1.5402457e-03f,
-   -2.9411108e-03f,
-   -7.1637819e-03f,
-    1.6552066e-02f,
-    1.9917804e-02f,
-   -6.4997263e-02f,
-   -3.6800074e-02f,
-    2.9809232e-01f,
-    5.4750543e-01f,
-    3.0970685e-01f,
-   -4.3866051e-02f,
-   -7.4652239e-02f,
-    2.9195880e-02f,
-    2.3110777e-02f,
-   -1.3973688e-02f,
-   -6.4800900e-03f,
-    4.7830014e-03f,
-    1.7206547e-03f,
-   -1.1758222e-03f,
-   -4.5122700e-04f,
-    2.1372980e-04f,
-    9.9377600e-05f,
-   -2.9232100e-05f,
-   -1.5072000e-05f,
-    2.6408000e-06f,
-    1.4593000e-06f,
-   -1.1840000e-07f,
-   -6.7300000e-08f }
+#endif
 };
@@ -35,7 +35,14 @@
 #error This file should not be included directly into mid level code
 #endif
 
-extern const double kCoifletsD[5][30];
-extern const float  kCoifletsF[5][30];
+#ifndef WAVELET_MAX_ORDER
+#define WAVELET_MAX_ORDER 76
+#endif
+
+#define WAVELET_COIFLETS_ROWS \
+    (WAVELET_MAX_ORDER > 30 ? 5 : WAVELET_MAX_ORDER / 6)
+#define WAVELET_COIFLETS_COLS (WAVELET_COIFLETS_ROWS * 6)
+
+extern const double kCoifletsD[WAVELET_COIFLETS_ROWS][WAVELET_COIFLETS_COLS];
 
 #endif  // SRC_COIFLETS_H_
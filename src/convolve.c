@@ -32,10 +32,80 @@
 #define LIBSIMD_IMPLEMENTATION
 #include "inc/simd/convolve.h"
 #include <assert.h>
+#include <float.h>
+// clock_gettime() needs the POSIX timers under strict -std=c99
+#ifndef __USE_POSIX199309
+#define __USE_POSIX199309
+#endif
+#include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <fftf/api.h>
 #include "inc/simd/arithmetic.h"
+#include <simd/parallel.h>
+#include <simd/stats.h>
+
+// The FFTW3 wisdom entry points, referenced weakly so the library keeps
+// working when FFTF was built without the FFTW backend
+extern int fftwf_export_wisdom_to_filename(const char *filename)
+    __attribute__((weak));
+extern int fftwf_import_wisdom_from_filename(const char *filename)
+    __attribute__((weak));
+
+static pthread_mutex_t fft_options_mutex = PTHREAD_MUTEX_INITIALIZER;
+static ConvolutionFFTOptions fft_options = {
+  -1, CONVOLUTION_FFT_PLANNING_DEFAULT
+};
+
+void convolve_fft_set_options(ConvolutionFFTOptions options) {
+  pthread_mutex_lock(&fft_options_mutex);
+  fft_options = options;
+  pthread_mutex_unlock(&fft_options_mutex);
+}
+
+ConvolutionFFTOptions convolve_fft_get_options(void) {
+  pthread_mutex_lock(&fft_options_mutex);
+  ConvolutionFFTOptions options = fft_options;
+  pthread_mutex_unlock(&fft_options_mutex);
+  return options;
+}
+
+int convolve_fft_plan_options(void) {
+  ConvolutionFFTOptions options = convolve_fft_get_options();
+  if (options.backend >= 0) {
+    fftf_set_backend((FFTFBackendId)options.backend);
+  }
+  if (options.backend == FFTF_BACKEND_FFTW3) {
+    // FFTF forwards the options word to the backend untouched; these are
+    // the FFTW planner flags. FFTW_MEASURE is 0, so DEFAULT keeps it.
+    switch (options.planning) {
+      case CONVOLUTION_FFT_PLANNING_ESTIMATE:
+        return 1 << 6;  // FFTW_ESTIMATE
+      case CONVOLUTION_FFT_PLANNING_EXHAUSTIVE:
+        return 1 << 3;  // FFTW_EXHAUSTIVE
+      default:
+        break;
+    }
+  }
+  return FFTF_NO_OPTIONS;
+}
+
+int convolve_wisdom_save(const char *path) {
+  assert(path);
+  if (fftwf_export_wisdom_to_filename == NULL) {
+    return 0;
+  }
+  return fftwf_export_wisdom_to_filename(path);
+}
+
+int convolve_wisdom_load(const char *path) {
+  assert(path);
+  if (fftwf_import_wisdom_from_filename == NULL) {
+    return 0;
+  }
+  return fftwf_import_wisdom_from_filename(path);
+}
 
 void convolve_simd(int simd,
                    const float *__restrict x, size_t xLength,
@@ -54,7 +124,36 @@ void convolve_simd(int simd,
       end = hLength;
     }
     if (simd) {
-#ifdef __AVX__
+#ifdef __AVX512F__
+      int simdEnd = beg + ((end - beg) & ~15);
+      const __m512i revIndex = _mm512_set_epi32(0, 1, 2, 3, 4, 5, 6, 7,
+                                                8, 9, 10, 11, 12, 13, 14, 15);
+      __m512 accum = _mm512_setzero_ps();
+      for (int m = beg; m < simdEnd; m += 16) {
+        __m512 xvec = _mm512_loadu_ps(x + n - m - 15);
+        __m512 hvec = _mm512_loadu_ps(h + m);
+        xvec = _mm512_permutexvar_ps(revIndex, xvec);
+        accum = _mm512_fmadd_ps(xvec, hvec, accum);
+      }
+      int rem = end - simdEnd;
+      if (rem > 0) {
+        // The tail is done with masked loads; x is loaded forward starting
+        // from its lowest used index and reversed through the first rem lanes
+        // (the masked out products are zero anyway).
+        __mmask16 tailMask = (__mmask16)((1u << rem) - 1);
+        __m512 hvec = _mm512_maskz_loadu_ps(tailMask, h + simdEnd);
+        __m512 xvec = _mm512_maskz_loadu_ps(tailMask, x + n - end + 1);
+        __m512i tailIndex = _mm512_and_si512(
+            _mm512_sub_epi32(_mm512_set1_epi32(rem - 1),
+                             _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8,
+                                              7, 6, 5, 4, 3, 2, 1, 0)),
+            _mm512_set1_epi32(15));
+        xvec = _mm512_permutexvar_ps(tailIndex, xvec);
+        accum = _mm512_fmadd_ps(xvec, hvec, accum);
+      }
+      sum = _mm512_reduce_add_ps(accum);
+    } else {
+#elif defined(__AVX__)
       int simdEnd =  beg + ((end - beg) & ~7);
       __m256 accum = _mm256_setzero_ps();
       for (int m = beg; m < simdEnd; m += 8) {
@@ -100,6 +199,273 @@ void convolve_simd(int simd,
  }
 }
 
+void convolve_simd_symmetric(int simd,
+                             const float *__restrict x, size_t xLength,
+                             const float *__restrict h, size_t hLength,
+                             float *__restrict result) {
+  assert(x);
+  assert(h);
+  assert(result);
+  assert(xLength > 0);
+  assert(hLength > 0);
+  // A cheap sanity check of the claimed linear phase
+  assert(h[0] == h[hLength - 1]);
+  if (xLength < hLength) {
+    // No steady state region to fold
+    convolve_simd(simd, x, xLength, h, hLength, result);
+    return;
+  }
+  int M = (int)hLength;
+  int half = M / 2;
+  // The leading and trailing edges have taps falling off the ends of x,
+  // which breaks the h[m] / h[M - 1 - m] pairing; they are M - 1 samples
+  // each, negligible next to the folded steady state for long signals
+  for (int n = 0; n < M - 1; n++) {
+    float sum = 0.f;
+    for (int m = 0; m <= n; m++) {
+      sum += h[m] * x[n - m];
+    }
+    result[n] = sum;
+  }
+  for (int n = (int)xLength; n < (int)(xLength + hLength - 1); n++) {
+    float sum = 0.f;
+    for (int m = n - (int)xLength + 1; m < M; m++) {
+      sum += h[m] * x[n - m];
+    }
+    result[n] = sum;
+  }
+  // The steady state: every tap is inside x, so the taps equidistant from
+  // the center share a coefficient and x[n - m] + x[n - M + 1 + m] is
+  // formed before the single multiply - half the multiplies and only the
+  // first half of h is ever read
+  for (int n = M - 1; n < (int)xLength; n++) {
+    const float *xe = x + n - M + 1;
+    float sum = (M & 1) ? h[half] * xe[half] : 0.f;
+    int mstart = 0;
+    if (simd) {
+#ifdef __AVX__
+      int simdEnd = half & ~7;
+      __m256 accum = _mm256_setzero_ps();
+      for (int m = 0; m < simdEnd; m += 8) {
+        __m256 fwd = _mm256_loadu_ps(xe + m);
+        __m256 rev = _mm256_loadu_ps(x + n - m - 7);
+        rev = _mm256_permute2f128_ps(rev, rev, 1);
+        rev = _mm256_permute_ps(rev, 27);
+        __m256 hvec = _mm256_loadu_ps(h + m);
+        accum = _mm256_add_ps(accum,
+                              _mm256_mul_ps(hvec, _mm256_add_ps(fwd, rev)));
+      }
+      accum = _mm256_hadd_ps(accum, accum);
+      accum = _mm256_hadd_ps(accum, accum);
+      sum += _mm256_get_ps(accum, 0) + _mm256_get_ps(accum, 4);
+      mstart = simdEnd;
+#elif defined(__ARM_NEON__)
+      int simdEnd = half & ~3;
+      float32x4_t accum = vdupq_n_f32(0.f);
+      for (int m = 0; m < simdEnd; m += 4) {
+        float32x4_t fwd = vld1q_f32(xe + m);
+        float32x4_t rev = vld1q_f32(x + n - m - 3);
+        rev = vrev64q_f32(rev);
+        rev = vcombine_f32(vget_high_f32(rev), vget_low_f32(rev));
+        float32x4_t hvec = vld1q_f32(h + m);
+        accum = vmlaq_f32(accum, hvec, vaddq_f32(fwd, rev));
+      }
+      float32x2_t accum2 = vpadd_f32(vget_high_f32(accum),
+                                     vget_low_f32(accum));
+      sum += vget_lane_f32(accum2, 0) + vget_lane_f32(accum2, 1);
+      mstart = simdEnd;
+#endif
+    }
+    for (int m = mstart; m < half; m++) {
+      sum += h[m] * (x[n - m] + xe[m]);
+    }
+    result[n] = sum;
+  }
+}
+
+size_t convolve_sparse_extract(const float *h, size_t hLength,
+                               size_t *indices, float *values) {
+  assert(h);
+  assert(indices);
+  assert(values);
+  assert(hLength > 0);
+  size_t taps = 0;
+  for (size_t m = 0; m < hLength; m++) {
+    if (h[m] != 0.f) {
+      indices[taps] = m;
+      values[taps] = h[m];
+      taps++;
+    }
+  }
+  return taps;
+}
+
+void convolve_sparse(int simd,
+                     const float *__restrict x, size_t xLength,
+                     const size_t *__restrict indices,
+                     const float *__restrict values, size_t taps,
+                     size_t hLength,
+                     float *__restrict result) {
+  assert(x);
+  assert(indices);
+  assert(values);
+  assert(result);
+  assert(xLength > 0);
+  assert(hLength > 0);
+  memsetf(result, 0.f, xLength + hLength - 1);
+  // The tap loop is outermost: each live tap contributes one scaled copy
+  // of the whole of x at offset indices[t], a contiguous multiply-add
+  // instead of the reversed gather of convolve_simd()
+  for (size_t t = 0; t < taps; t++) {
+    assert(indices[t] < hLength);
+    assert(t == 0 || indices[t] > indices[t - 1]);
+    float *out = result + indices[t];
+    const float v = values[t];
+    if (simd) {
+#ifdef __AVX__
+      const __m256 vvec = _mm256_set1_ps(v);
+      size_t simdEnd = xLength & ~(size_t)7;
+      for (size_t i = 0; i < simdEnd; i += 8) {
+        __m256 acc = _mm256_loadu_ps(out + i);
+        acc = _mm256_add_ps(acc,
+                            _mm256_mul_ps(_mm256_loadu_ps(x + i), vvec));
+        _mm256_storeu_ps(out + i, acc);
+      }
+      for (size_t i = simdEnd; i < xLength; i++) {
+        out[i] += v * x[i];
+      }
+    } else {
+#elif defined(__ARM_NEON__)
+      size_t simdEnd = xLength & ~(size_t)3;
+      for (size_t i = 0; i < simdEnd; i += 4) {
+        float32x4_t acc = vld1q_f32(out + i);
+        acc = vmlaq_n_f32(acc, vld1q_f32(x + i), v);
+        vst1q_f32(out + i, acc);
+      }
+      for (size_t i = simdEnd; i < xLength; i++) {
+        out[i] += v * x[i];
+      }
+    } else {
+#else
+    } {
+#endif
+      for (size_t i = 0; i < xLength; i++) {
+        out[i] += v * x[i];
+      }
+    }
+  }
+}
+
+void convolve_simd_i16(int simd,
+                       const int16_t *__restrict x, size_t xLength,
+                       const int16_t *__restrict h, size_t hLength,
+                       int32_t *__restrict result) {
+  assert(x);
+  assert(h);
+  assert(result);
+  assert(xLength > 0);
+  assert(hLength > 0);
+  for (int n = 0; n < (int)(xLength + hLength - 1); n++) {
+    int32_t sum = 0;
+    int beg = n < (int)xLength? 0 : n - xLength + 1;
+    int end = n + 1;
+    if (end > (int)hLength) {
+      end = hLength;
+    }
+    if (simd) {
+#ifdef __AVX__
+      int simdEnd = beg + ((end - beg) & ~7);
+      // Reverses the eight int16_t-s of a 128-bit vector
+      const __m128i revMask = _mm_set_epi8(1, 0, 3, 2, 5, 4, 7, 6,
+                                           9, 8, 11, 10, 13, 12, 15, 14);
+      __m128i accum = _mm_setzero_si128();
+      for (int m = beg; m < simdEnd; m += 8) {
+        __m128i xvec = _mm_loadu_si128((const __m128i*)(x + n - m - 7));
+        __m128i hvec = _mm_loadu_si128((const __m128i*)(h + m));
+        xvec = _mm_shuffle_epi8(xvec, revMask);
+        accum = _mm_add_epi32(accum, _mm_madd_epi16(xvec, hvec));
+      }
+      __m128i hsum = _mm_add_epi32(accum, _mm_srli_si128(accum, 8));
+      hsum = _mm_add_epi32(hsum, _mm_srli_si128(hsum, 4));
+      sum = _mm_cvtsi128_si32(hsum);
+      for (int m = simdEnd; m < end; m++) {
+        sum += h[m] * (int32_t)x[n - m];
+      }
+    } else {
+#elif defined(__ARM_NEON__)
+      int simdEnd = beg + ((end - beg) & ~3);
+      int32x4_t accum = vdupq_n_s32(0);
+      for (int m = beg; m < simdEnd; m += 4) {
+        int16x4_t xvec = vld1_s16(x + n - m - 3);
+        int16x4_t hvec = vld1_s16(h + m);
+        xvec = vrev64_s16(xvec);
+        accum = vmlal_s16(accum, xvec, hvec);
+      }
+      int32x2_t accum2 = vpadd_s32(vget_high_s32(accum),
+                                   vget_low_s32(accum));
+      sum = vget_lane_s32(accum2, 0) + vget_lane_s32(accum2, 1);
+      for (int m = simdEnd; m < end; m++) {
+        sum += h[m] * (int32_t)x[n - m];
+      }
+    } else {
+#else
+    } {
+#endif
+      for (int m = beg; m < end; m++) {
+        sum += h[m] * (int32_t)x[n - m];
+      }
+    }
+    result[n] = sum;
+  }
+}
+
+void convolve_simd_f64(int simd,
+                       const double *__restrict x, size_t xLength,
+                       const double *__restrict h, size_t hLength,
+                       double *__restrict result) {
+  assert(x);
+  assert(h);
+  assert(result);
+  assert(xLength > 0);
+  assert(hLength > 0);
+  for (int n = 0; n < (int)(xLength + hLength - 1); n++) {
+    double sum = 0.;
+    int beg = n < (int)xLength? 0 : n - xLength + 1;
+    int end = n + 1;
+    if (end > (int)hLength) {
+      end = hLength;
+    }
+    if (simd) {
+#ifdef __AVX__
+      int simdEnd = beg + ((end - beg) & ~3);
+      __m256d accum = _mm256_setzero_pd();
+      for (int m = beg; m < simdEnd; m += 4) {
+        __m256d xvec = _mm256_loadu_pd(x + n - m - 3);
+        __m256d hvec = _mm256_loadu_pd(h + m);
+        xvec = _mm256_permute2f128_pd(xvec, xvec, 1);
+        xvec = _mm256_permute_pd(xvec, 5);
+        __m256d mulres = _mm256_mul_pd(xvec, hvec);
+        accum = _mm256_add_pd(accum, mulres);
+      }
+      __m128d halves = _mm_add_pd(_mm256_castpd256_pd128(accum),
+                                  _mm256_extractf128_pd(accum, 1));
+      sum = _mm_cvtsd_f64(halves) +
+          _mm_cvtsd_f64(_mm_unpackhi_pd(halves, halves));
+      for (int m = simdEnd; m < end; m++) {
+        sum += h[m] * x[n - m];
+      }
+    } else {
+#else
+    } {
+#endif
+      for (int m = beg; m < end; m++) {
+        sum += h[m] * x[n - m];
+      }
+    }
+    result[n] = sum;
+  }
+}
+
 ConvolutionOverlapSaveHandle convolve_overlap_save_initialize(
     size_t xLength, size_t hLength) {
   assert(hLength < xLength / 2);
@@ -111,6 +477,10 @@ ConvolutionOverlapSaveHandle convolve_overlap_save_initialize(
   handle.x_length = xLength;
   handle.h_length = hLength;
   handle.reverse = 0;
+  handle.threads = 1;
+  handle.thread_scratches = NULL;
+  handle.thread_fft_plans = NULL;
+  handle.thread_fft_inverse_plans = NULL;
 
   // Do zero padding of h to the next power of 2 + extra 2 float-s
   int L = M;
@@ -130,7 +500,7 @@ ConvolutionOverlapSaveHandle convolve_overlap_save_initialize(
 
   handle.fft_plan = fftf_init(FFTF_TYPE_REAL, FFTF_DIRECTION_FORWARD,
                               FFTF_DIMENSION_1D, handle.L,
-                              FFTF_NO_OPTIONS, handle.fft_boiler_plate,
+                              convolve_fft_plan_options(), handle.fft_boiler_plate,
                               handle.fft_boiler_plate);
 
   assert(handle.fft_plan);
@@ -138,19 +508,259 @@ ConvolutionOverlapSaveHandle convolve_overlap_save_initialize(
   handle.fft_inverse_plan = fftf_init(
       FFTF_TYPE_REAL, FFTF_DIRECTION_BACKWARD,
       FFTF_DIMENSION_1D, handle.L,
-      FFTF_NO_OPTIONS, handle.fft_boiler_plate,
+      convolve_fft_plan_options(), handle.fft_boiler_plate,
       handle.fft_boiler_plate);
   assert(handle.fft_inverse_plan);
 
   return handle;
 }
 
+ConvolutionOverlapSaveHandle convolve_overlap_save_initialize_threads(
+    size_t xLength, size_t hLength, int threads) {
+  ConvolutionOverlapSaveHandle handle =
+      convolve_overlap_save_initialize(xLength, hLength);
+  if (threads <= 1) {
+    return handle;
+  }
+  int L = *handle.L;
+  handle.threads = threads;
+  handle.thread_scratches = malloc(threads * sizeof(float *));
+  handle.thread_fft_plans = malloc(threads * sizeof(void *));
+  handle.thread_fft_inverse_plans = malloc(threads * sizeof(void *));
+  for (int t = 0; t < threads; t++) {
+    handle.thread_scratches[t] = mallocf(L + 2);
+    assert(handle.thread_scratches[t]);
+    handle.thread_fft_plans[t] = fftf_init(
+        FFTF_TYPE_REAL, FFTF_DIRECTION_FORWARD,
+        FFTF_DIMENSION_1D, handle.L,
+        convolve_fft_plan_options(), handle.thread_scratches[t],
+        handle.thread_scratches[t]);
+    assert(handle.thread_fft_plans[t]);
+    handle.thread_fft_inverse_plans[t] = fftf_init(
+        FFTF_TYPE_REAL, FFTF_DIRECTION_BACKWARD,
+        FFTF_DIMENSION_1D, handle.L,
+        convolve_fft_plan_options(), handle.thread_scratches[t],
+        handle.thread_scratches[t]);
+    assert(handle.thread_fft_inverse_plans[t]);
+  }
+  return handle;
+}
+
 void convolve_overlap_save_finalize(ConvolutionOverlapSaveHandle handle) {
-  free(handle.fft_boiler_plate);
+  freef(handle.fft_boiler_plate);
   fftf_destroy(handle.fft_plan);
   fftf_destroy(handle.fft_inverse_plan);
   free(handle.L);
-  free(handle.H);
+  freef(handle.H);
+  if (handle.threads > 1) {
+    for (int t = 0; t < handle.threads; t++) {
+      freef(handle.thread_scratches[t]);
+      fftf_destroy(handle.thread_fft_plans[t]);
+      fftf_destroy(handle.thread_fft_inverse_plans[t]);
+    }
+    free(handle.thread_scratches);
+    free(handle.thread_fft_plans);
+    free(handle.thread_fft_inverse_plans);
+  }
+}
+
+/// @brief Convolves one overlap-save block, leaving the step (or fewer, for
+/// the last block) valid output samples at scratch + M - 1.
+/// @return The number of valid output samples.
+static size_t convolve_overlap_save_block_calc(
+    const ConvolutionOverlapSaveHandle *handle, float *scratch,
+    void *fft_plan, void *fft_inverse_plan,
+    const float *x, size_t i) {
+  size_t M = handle->h_length;  //  usual designation
+  int L = *handle->L;
+  int step = L - (M - 1);
+
+  // X = [zeros(1, M - 1), x, zeros(1, L-1)];
+  // we must run FFT on X[i, i + L].
+  // No X is really needed, some index arithmetic is used.
+  if (i > 0) {
+    if (i + step <= handle->x_length) {
+      memcpy(scratch, x + i - (M - 1), L * sizeof(float));
+    } else {
+      int cl = handle->x_length - i + M - 1;
+      memcpy(scratch, x + i - (M - 1), cl * sizeof(float));
+      memsetf(scratch + cl, 0.f, L - cl);
+    }
+  } else {
+    memsetf(scratch, 0.f, M - 1);
+    memcpy(scratch + M - 1, x, step * sizeof(float));
+  }
+  fftf_calc(fft_plan);
+
+  // scratch = scratch * H (complex arithmetic)
+  int cciStart = 0;
+#ifdef SIMD
+  cciStart = L;
+  for (int cci = 0; cci < L; cci += FLOAT_STEP) {
+    complex_multiply(scratch + cci, handle->H + cci, scratch + cci);
+  }
+#endif
+  for (int cci = cciStart; cci < L + 2; cci += 2) {
+    complex_multiply_na(scratch + cci, handle->H + cci, scratch + cci);
+  }
+
+  // Return back from the Fourier representation
+  fftf_calc(fft_inverse_plan);
+  // Normalize
+  real_multiply_scalar(scratch + M - 1, step, 1.0f / L, scratch + M - 1);
+
+  if (i + step < handle->x_length + handle->h_length) {
+    return step;
+  }
+  return handle->x_length + handle->h_length - 1 - i;
+}
+
+static void convolve_overlap_save_block(
+    const ConvolutionOverlapSaveHandle *handle, float *scratch,
+    void *fft_plan, void *fft_inverse_plan,
+    const float *x, size_t i, float *result) {
+  size_t length = convolve_overlap_save_block_calc(
+      handle, scratch, fft_plan, fft_inverse_plan, x, i);
+  memcpy(result + i, scratch + handle->h_length - 1,
+         length * sizeof(float));
+}
+
+/// @brief Transforms h (reversed, if the handle says so) into handle->H.
+static void convolve_overlap_save_prepare_h(
+    const ConvolutionOverlapSaveHandle *handle, const float *h) {
+  int L = *handle->L;
+  if (handle->reverse) {
+    rmemcpyf(handle->fft_boiler_plate, h, handle->h_length);
+  } else {
+    memcpy(handle->fft_boiler_plate, h, handle->h_length * sizeof(float));
+  }
+  memsetf(handle->fft_boiler_plate + handle->h_length, 0.f,
+          L - handle->h_length);
+
+  // H = FFT(paddedH, L)
+  fftf_calc(handle->fft_plan);
+  memcpy(handle->H, handle->fft_boiler_plate, (L + 2) * sizeof(float));
+}
+
+void convolve_overlap_save_argmax(ConvolutionOverlapSaveHandle handle,
+                                  const float *x, const float *h,
+                                  int *position, float *value) {
+  assert(x != NULL);
+  assert(h != NULL);
+  assert(position != NULL);
+  assert(value != NULL);
+
+  size_t M = handle.h_length;  //  usual designation
+  size_t step = *handle.L - (M - 1);
+  convolve_overlap_save_prepare_h(&handle, h);
+
+  int best_position = 0;
+  float best_value = -FLT_MAX;
+  for (size_t i = 0; i < handle.x_length + M - 1; i += step) {
+    size_t length = convolve_overlap_save_block_calc(
+        &handle, handle.fft_boiler_plate,
+        handle.fft_plan, handle.fft_inverse_plan, x, i);
+    // The block is scanned while it is still cache-hot, so the full
+    // result is never materialized
+    const float *block = handle.fft_boiler_plate + M - 1;
+    for (size_t j = 0; j < length; j++) {
+      if (block[j] > best_value) {
+        best_value = block[j];
+        best_position = i + j;
+      }
+    }
+  }
+  *position = best_position;
+  *value = best_value;
+}
+
+INLINE void append_extremum(int position, float value, size_t index,
+                            ExtremumPoint **results, size_t *allocatedSize) {
+  size_t alloc_size = *allocatedSize;
+  if (alloc_size <= index) {
+    alloc_size = alloc_size == 0? 2 : alloc_size * 2;
+    *allocatedSize = alloc_size;
+    *results = realloc(*results, alloc_size * sizeof((*results)[0]));
+  }
+  (*results)[index] = (ExtremumPoint) { .position = position,
+                                        .value = value };
+}
+
+void convolve_overlap_save_peaks(ConvolutionOverlapSaveHandle handle,
+                                 const float *x, const float *h,
+                                 ExtremumType type,
+                                 ExtremumPoint **results,
+                                 size_t *resultsLength) {
+  assert(x != NULL);
+  assert(h != NULL);
+  assert(results != NULL);
+  assert(resultsLength != NULL);
+
+  size_t M = handle.h_length;  //  usual designation
+  size_t step = *handle.L - (M - 1);
+  convolve_overlap_save_prepare_h(&handle, h);
+
+  *results = NULL;
+  *resultsLength = 0;
+  size_t allocated_size = 0;
+
+  // The last two produced samples are carried over the block boundary,
+  // so each sample is checked against both its neighbors exactly like in
+  // detect_peaks(), without materializing the full result
+  float prev = 0.f, curr = 0.f;
+  size_t produced = 0;
+  for (size_t i = 0; i < handle.x_length + M - 1; i += step) {
+    size_t length = convolve_overlap_save_block_calc(
+        &handle, handle.fft_boiler_plate,
+        handle.fft_plan, handle.fft_inverse_plan, x, i);
+    const float *block = handle.fft_boiler_plate + M - 1;
+    for (size_t j = 0; j < length; j++) {
+      float next = block[j];
+      if (produced >= 2) {
+        float delta1 = curr - prev;
+        float delta2 = curr - next;
+        if (delta1 * delta2 > 0) {
+          if ((delta1 > 0 && (type & kExtremumTypeMaximum) != 0) ||
+              (delta1 < 0 && (type & kExtremumTypeMinimum) != 0)) {
+            append_extremum(produced - 1, curr, *resultsLength,
+                            results, &allocated_size);
+            (*resultsLength)++;
+          }
+        }
+      }
+      prev = curr;
+      curr = next;
+      produced++;
+    }
+  }
+}
+
+typedef struct {
+  const ConvolutionOverlapSaveHandle *handle;
+  const float *x;
+  float *result;
+  int thread_index;
+} ConvolutionOverlapSaveWorker;
+
+static void *convolve_overlap_save_worker(void *arg) {
+  const ConvolutionOverlapSaveWorker *ctx = arg;
+  const ConvolutionOverlapSaveHandle *handle = ctx->handle;
+  size_t M = handle->h_length;
+  size_t step = *handle->L - (M - 1);
+  // Blocks write disjoint result ranges, so they are handed out round-robin
+  for (size_t i = ctx->thread_index * step; i < handle->x_length + M - 1;
+       i += step * handle->threads) {
+    convolve_overlap_save_block(
+        handle, handle->thread_scratches[ctx->thread_index],
+        handle->thread_fft_plans[ctx->thread_index],
+        handle->thread_fft_inverse_plans[ctx->thread_index],
+        ctx->x, i, ctx->result);
+  }
+  return NULL;
+}
+
+static void convolve_overlap_save_task(size_t index, void *user) {
+  convolve_overlap_save_worker(&((ConvolutionOverlapSaveWorker *)user)[index]);
 }
 
 void convolve_overlap_save(ConvolutionOverlapSaveHandle handle,
@@ -164,67 +774,28 @@ void convolve_overlap_save(ConvolutionOverlapSaveHandle handle,
   size_t M = handle.h_length;  //  usual designation
   int L = *handle.L;
 
-  if (handle.reverse) {
-    rmemcpyf(handle.fft_boiler_plate, h, handle.h_length);
-  } else {
-    memcpy(handle.fft_boiler_plate, h, handle.h_length * sizeof(float));
-  }
-  memsetf(handle.fft_boiler_plate + handle.h_length, 0.f, L - handle.h_length);
-
-  // H = FFT(paddedH, L)
-  fftf_calc(handle.fft_plan);
-  memcpy(handle.H, handle.fft_boiler_plate, (L + 2) * sizeof(float));
+  convolve_overlap_save_prepare_h(&handle, h);
 
   int step = L - (M - 1);
+  if (handle.threads > 1) {
+    ConvolutionOverlapSaveWorker *contexts =
+        malloc(handle.threads * sizeof(ConvolutionOverlapSaveWorker));
+    for (int t = 0; t < handle.threads; t++) {
+      contexts[t].handle = &handle;
+      contexts[t].x = x;
+      contexts[t].result = result;
+      contexts[t].thread_index = t;
+    }
+    simd_parallel_for(convolve_overlap_save_task, handle.threads, contexts);
+    free(contexts);
+    return;
+  }
   // Note: no "#pragma omp parallel for" here since
   // handle.fft_boiler_plate is shared AND FFTF should utilize all available resources.
   for (size_t i = 0; i < handle.x_length + M - 1; i += step) {
-    // X = [zeros(1, M - 1), x, zeros(1, L-1)];
-    // we must run FFT on X[i, i + L].
-    // No X is really needed, some index arithmetic is used.
-    if (i > 0) {
-      if (i + step <= handle.x_length) {
-        memcpy(handle.fft_boiler_plate, x + i - (M - 1), L * sizeof(float));
-      } else {
-        int cl = handle.x_length - i + M - 1;
-        memcpy(handle.fft_boiler_plate, x + i - (M - 1),
-               cl * sizeof(float));
-        memsetf(handle.fft_boiler_plate + cl, 0.f, L - cl);
-      }
-    } else {
-      memsetf(handle.fft_boiler_plate, 0.f, M - 1);
-      memcpy(handle.fft_boiler_plate + M - 1, x, step * sizeof(float));
-    }
-    fftf_calc(handle.fft_plan);
-
-    // fftBoilerPlate = fftBoilerPlate * H (complex arithmetic)
-    int cciStart = 0;
-#ifdef SIMD
-    cciStart = L;
-    for (int cci = 0; cci < L; cci += FLOAT_STEP) {
-      complex_multiply(handle.fft_boiler_plate + cci, handle.H + cci,
-                       handle.fft_boiler_plate + cci);
-    }
-#endif
-    for (int cci = cciStart; cci < L + 2; cci += 2) {
-      complex_multiply_na(handle.fft_boiler_plate + cci,
-                          handle.H + cci,
-                          handle.fft_boiler_plate + cci);
-    }
-
-    // Return back from the Fourier representation
-    fftf_calc(handle.fft_inverse_plan);
-    // Normalize
-    real_multiply_scalar(handle.fft_boiler_plate + M - 1, step, 1.0f / L,
-                         handle.fft_boiler_plate + M - 1);
-
-    if (i + step < handle.x_length + handle.h_length) {
-      memcpy(result + i, handle.fft_boiler_plate + M - 1,
-             step * sizeof(float));
-    } else {
-      memcpy(result + i, handle.fft_boiler_plate + M - 1,
-             (handle.x_length + handle.h_length - 1 - i) * sizeof(float));
-    }
+    convolve_overlap_save_block(&handle, handle.fft_boiler_plate,
+                                handle.fft_plan, handle.fft_inverse_plan,
+                                x, i, result);
   }
 }
 
@@ -242,7 +813,10 @@ ConvolutionFFTHandle convolve_fft_initialize(size_t xLength, size_t hLength) {
     }
     M = (1 << log);
   }
-  handle.M = malloc(sizeof(M));
+  // All the scratch of this handle shares one lifetime, so it is carved
+  // out of a single arena instead of one malloc per block.
+  handle.arena = simd_arena_create(2 * (M + 2) * sizeof(float) + 4 * 64);
+  handle.M = simd_arena_alloc(&handle.arena, sizeof(M));
   *handle.M = M;
   handle.x_length = xLength;
   handle.h_length = hLength;
@@ -251,12 +825,12 @@ ConvolutionFFTHandle convolve_fft_initialize(size_t xLength, size_t hLength) {
   // Now M is the nearest greater than or equal power of 2.
   // Do zero padding of x and h
   // Allocate 2 extra samples for the M/2 complex number.
-  float *X = mallocf(M + 2);
+  float *X = simd_arena_alloc(&handle.arena, (M + 2) * sizeof(float));
   memsetf(X + xLength, 0.f, M + 2 - xLength);
-  float *H = mallocf(M + 2);
+  float *H = simd_arena_alloc(&handle.arena, (M + 2) * sizeof(float));
   memsetf(H + hLength, 0.f, M + 2 - hLength);
 
-  handle.inputs = malloc(2 * sizeof(float *));
+  handle.inputs = simd_arena_alloc(&handle.arena, 2 * sizeof(float *));
   handle.inputs[0] = X;
   handle.inputs[1] = H;
 
@@ -264,7 +838,7 @@ ConvolutionFFTHandle convolve_fft_initialize(size_t xLength, size_t hLength) {
   handle.fft_plan = fftf_init_batch(
       FFTF_TYPE_REAL, FFTF_DIRECTION_FORWARD,
       FFTF_DIMENSION_1D, handle.M,
-      FFTF_NO_OPTIONS, 2, (const float *const *)handle.inputs,
+      convolve_fft_plan_options(), 2, (const float *const *)handle.inputs,
       handle.inputs);
   assert(handle.fft_plan);
 
@@ -272,16 +846,22 @@ ConvolutionFFTHandle convolve_fft_initialize(size_t xLength, size_t hLength) {
   handle.fft_inverse_plan = fftf_init(
     FFTF_TYPE_REAL, FFTF_DIRECTION_BACKWARD,
     FFTF_DIMENSION_1D, handle.M,
-    FFTF_NO_OPTIONS, X, X);
+    convolve_fft_plan_options(), X, X);
   assert(handle.fft_inverse_plan);
   return handle;
 }
 
+ConvolutionFFTHandle convolve_fft_initialize_options(
+    size_t xLength, size_t hLength, ConvolutionFFTOptions options) {
+  ConvolutionFFTOptions saved = convolve_fft_get_options();
+  convolve_fft_set_options(options);
+  ConvolutionFFTHandle handle = convolve_fft_initialize(xLength, hLength);
+  convolve_fft_set_options(saved);
+  return handle;
+}
+
 void convolve_fft_finalize(ConvolutionFFTHandle handle) {
-  free(handle.inputs[0]);
-  free(handle.inputs[1]);
-  free(handle.inputs);
-  free(handle.M);
+  simd_arena_destroy(&handle.arena);
   fftf_destroy(handle.fft_plan);
   fftf_destroy(handle.fft_inverse_plan);
 }
@@ -308,64 +888,543 @@ void convolve_fft(ConvolutionFFTHandle handle,
   // fft(X), fft(H)
   fftf_calc(handle.fft_plan);
 
+  // Multiply the spectra, applying the 1/M normalization of the inverse
+  // transform right away so that no separate pass over the result is needed
+  float scale = 1.0f / M;
   int istart = 0;
 #ifdef SIMD
   istart = M;
   for (int i = 0; i < M; i += FLOAT_STEP) {
-    complex_multiply(X + i, H + i, X + i);
+    complex_multiply_scaled(X + i, H + i, X + i, scale);
   }
 #endif
   for (int i = istart; i < M + 2; i += 2) {
-    complex_multiply_na(X + i, H + i, X + i);
+    complex_multiply_scaled_na(X + i, H + i, X + i, scale);
   }
 
   // Return back from the Fourier representation
   fftf_calc(handle.fft_inverse_plan);
-  // Normalize
-  real_multiply_scalar(X, xLength + hLength - 1, 1.0f / M, result);
+  memcpy(result, X, (xLength + hLength - 1) * sizeof(float));
 }
 
-ConvolutionHandle convolve_initialize(size_t xLength, size_t hLength) {
-  ConvolutionHandle handle;
+ConvolutionFFTHandle convolve_fft_inplace_initialize(
+    size_t xLength, size_t hLength, float *x, float *h) {
+  assert(hLength > 0);
+  assert(xLength > 0);
+  assert(x);
+  assert(h);
+
+  ConvolutionFFTHandle handle;
+
+  int M = xLength + hLength - 1;
+  if ((M & (M - 1)) != 0) {
+    int log = 1;
+    while (M >>= 1) {
+      log++;
+    }
+    M = (1 << log);
+  }
+  handle.arena = simd_arena_create(2 * 64);
+  handle.M = simd_arena_alloc(&handle.arena, sizeof(M));
+  *handle.M = M;
   handle.x_length = xLength;
   handle.h_length = hLength;
-#ifdef __ARM_NEON__
-  if (xLength > hLength * 2) {
-    if (xLength > 200) {
-      handle.algorithm = kConvolutionAlgorithmOverlapSave;
-      handle.handle.os = convolve_overlap_save_initialize(xLength, hLength);
-    } else {
-      handle.algorithm = kConvolutionAlgorithmBruteForce;
+  handle.reverse = 0;
+
+  // The caller's buffers are transformed in-place, no scratch is allocated
+  handle.inputs = simd_arena_alloc(&handle.arena, 2 * sizeof(float *));
+  handle.inputs[0] = x;
+  handle.inputs[1] = h;
+
+  handle.fft_plan = fftf_init_batch(
+      FFTF_TYPE_REAL, FFTF_DIRECTION_FORWARD,
+      FFTF_DIMENSION_1D, handle.M,
+      convolve_fft_plan_options(), 2, (const float *const *)handle.inputs,
+      handle.inputs);
+  assert(handle.fft_plan);
+
+  handle.fft_inverse_plan = fftf_init(
+    FFTF_TYPE_REAL, FFTF_DIRECTION_BACKWARD,
+    FFTF_DIMENSION_1D, handle.M,
+    convolve_fft_plan_options(), x, x);
+  assert(handle.fft_inverse_plan);
+  return handle;
+}
+
+void convolve_fft_inplace_finalize(ConvolutionFFTHandle handle) {
+  simd_arena_destroy(&handle.arena);
+  fftf_destroy(handle.fft_plan);
+  fftf_destroy(handle.fft_inverse_plan);
+}
+
+void convolve_fft_inplace(ConvolutionFFTHandle handle, float *result) {
+  assert(result != NULL);
+
+  float *X = handle.inputs[0];
+  float *H = handle.inputs[1];
+  int M = *handle.M;
+
+  // fft(X), fft(H)
+  fftf_calc(handle.fft_plan);
+
+  // Multiply the spectra, applying the 1/M normalization of the inverse
+  // transform right away so that no separate pass over the result is needed
+  float scale = 1.0f / M;
+  int istart = 0;
+#ifdef SIMD
+  istart = M;
+  for (int i = 0; i < M; i += FLOAT_STEP) {
+    complex_multiply_scaled(X + i, H + i, X + i, scale);
+  }
+#endif
+  for (int i = istart; i < M + 2; i += 2) {
+    complex_multiply_scaled_na(X + i, H + i, X + i, scale);
+  }
+
+  // Return back from the Fourier representation
+  fftf_calc(handle.fft_inverse_plan);
+  memcpy(result, X, (handle.x_length + handle.h_length - 1) * sizeof(float));
+}
+
+ConvolutionStreamHandle convolve_stream_initialize(
+    const float *h, size_t hLength, size_t blockSize) {
+  assert(h);
+  assert(hLength > 0);
+  assert(blockSize > 0);
+
+  ConvolutionStreamHandle handle;
+  size_t M = hLength;  //  usual designation
+  handle.h_length = hLength;
+  handle.block_size = blockSize;
+
+  // The FFT must cover one block plus the M - 1 carried samples
+  int L = blockSize + M - 1;
+  int log = 1;
+  while (L >>= 1) {
+    log++;
+  }
+  L = (1 << log);
+  handle.L = malloc(sizeof(L));
+  *handle.L = L;
+
+  handle.fft_boiler_plate = mallocf(L + 2);
+  assert(handle.fft_boiler_plate);
+
+  handle.fft_plan = fftf_init(FFTF_TYPE_REAL, FFTF_DIRECTION_FORWARD,
+                              FFTF_DIMENSION_1D, handle.L,
+                              convolve_fft_plan_options(), handle.fft_boiler_plate,
+                              handle.fft_boiler_plate);
+  assert(handle.fft_plan);
+
+  handle.fft_inverse_plan = fftf_init(
+      FFTF_TYPE_REAL, FFTF_DIRECTION_BACKWARD,
+      FFTF_DIMENSION_1D, handle.L,
+      convolve_fft_plan_options(), handle.fft_boiler_plate,
+      handle.fft_boiler_plate);
+  assert(handle.fft_inverse_plan);
+
+  // H = FFT(paddedH, L), calculated once for the whole stream
+  handle.H = mallocf(L + 2);
+  assert(handle.H);
+  memcpy(handle.fft_boiler_plate, h, hLength * sizeof(h[0]));
+  memsetf(handle.fft_boiler_plate + hLength, 0.f, L - hLength);
+  fftf_calc(handle.fft_plan);
+  memcpy(handle.H, handle.fft_boiler_plate, (L + 2) * sizeof(float));
+
+  handle.carry = mallocf(M > 1? M - 1 : 1);
+  assert(handle.carry);
+  memsetf(handle.carry, 0.f, M > 1? M - 1 : 1);
+  return handle;
+}
+
+void convolve_stream_finalize(ConvolutionStreamHandle handle) {
+  freef(handle.fft_boiler_plate);
+  fftf_destroy(handle.fft_plan);
+  fftf_destroy(handle.fft_inverse_plan);
+  free(handle.L);
+  freef(handle.H);
+  freef(handle.carry);
+}
+
+void convolve_stream_feed(ConvolutionStreamHandle handle,
+                          const float *block,
+                          float *result) {
+  assert(block != NULL);
+  assert(result != NULL);
+
+  size_t M = handle.h_length;  //  usual designation
+  size_t step = handle.block_size;
+  int L = *handle.L;
+
+  memcpy(handle.fft_boiler_plate, handle.carry, (M - 1) * sizeof(float));
+  memcpy(handle.fft_boiler_plate + M - 1, block, step * sizeof(float));
+  memsetf(handle.fft_boiler_plate + M - 1 + step, 0.f, L - (M - 1) - step);
+
+  fftf_calc(handle.fft_plan);
+
+  int cciStart = 0;
+#ifdef SIMD
+  cciStart = L;
+  for (int cci = 0; cci < L; cci += FLOAT_STEP) {
+    complex_multiply(handle.fft_boiler_plate + cci, handle.H + cci,
+                     handle.fft_boiler_plate + cci);
+  }
+#endif
+  for (int cci = cciStart; cci < L + 2; cci += 2) {
+    complex_multiply_na(handle.fft_boiler_plate + cci,
+                        handle.H + cci,
+                        handle.fft_boiler_plate + cci);
+  }
+
+  fftf_calc(handle.fft_inverse_plan);
+  real_multiply_scalar(handle.fft_boiler_plate + M - 1, step, 1.0f / L,
+                       result);
+
+  // Remember the last M - 1 input samples for the next block
+  if (step >= M - 1) {
+    memcpy(handle.carry, block + step - (M - 1), (M - 1) * sizeof(float));
+  } else {
+    memmove(handle.carry, handle.carry + step,
+            (M - 1 - step) * sizeof(float));
+    memcpy(handle.carry + M - 1 - step, block, step * sizeof(float));
+  }
+}
+
+ConvolutionBatchHandle convolve_batch_initialize(size_t xLength,
+                                                 size_t hLength,
+                                                 size_t batchSize) {
+  assert(xLength > 0);
+  assert(hLength > 0);
+  assert(batchSize > 0);
+
+  ConvolutionBatchHandle handle;
+
+  int M = xLength + hLength - 1;
+  if ((M & (M - 1)) != 0) {
+    int log = 1;
+    while (M >>= 1) {
+      log++;
     }
+    M = (1 << log);
+  }
+  handle.M = malloc(sizeof(M));
+  *handle.M = M;
+  handle.x_length = xLength;
+  handle.h_length = hLength;
+  handle.batch_size = batchSize;
+  handle.reverse = 0;
+
+  // One zero padded block of M + 2 float-s per signal in the batch.
+  handle.inputs = malloc(batchSize * sizeof(float *));
+  for (size_t i = 0; i < batchSize; i++) {
+    handle.inputs[i] = mallocf(M + 2);
+    memsetf(handle.inputs[i] + xLength, 0.f, M + 2 - xLength);
+  }
+
+  handle.H = mallocf(M + 2);
+  memsetf(handle.H + hLength, 0.f, M + 2 - hLength);
+
+  // The whole batch is transformed with a single plan in both directions.
+  handle.fft_plan = fftf_init_batch(
+      FFTF_TYPE_REAL, FFTF_DIRECTION_FORWARD,
+      FFTF_DIMENSION_1D, handle.M,
+      convolve_fft_plan_options(), batchSize, (const float *const *)handle.inputs,
+      handle.inputs);
+  assert(handle.fft_plan);
+
+  handle.fft_inverse_plan = fftf_init_batch(
+      FFTF_TYPE_REAL, FFTF_DIRECTION_BACKWARD,
+      FFTF_DIMENSION_1D, handle.M,
+      convolve_fft_plan_options(), batchSize, (const float *const *)handle.inputs,
+      handle.inputs);
+  assert(handle.fft_inverse_plan);
+
+  // The filter is transformed once per convolve_batch() call.
+  handle.fft_filter_plan = fftf_init(
+      FFTF_TYPE_REAL, FFTF_DIRECTION_FORWARD,
+      FFTF_DIMENSION_1D, handle.M,
+      convolve_fft_plan_options(), handle.H, handle.H);
+  assert(handle.fft_filter_plan);
+  return handle;
+}
+
+void convolve_batch_finalize(ConvolutionBatchHandle handle) {
+  for (int i = 0; i < handle.batch_size; i++) {
+    freef(handle.inputs[i]);
+  }
+  free(handle.inputs);
+  freef(handle.H);
+  free(handle.M);
+  fftf_destroy(handle.fft_plan);
+  fftf_destroy(handle.fft_inverse_plan);
+  fftf_destroy(handle.fft_filter_plan);
+}
+
+void convolve_batch(ConvolutionBatchHandle handle,
+                    const float *x, const float *h,
+                    float *result) {
+  assert(x != NULL);
+  assert(h != NULL);
+  assert(result != NULL);
+
+  int xLength = handle.x_length;
+  int hLength = handle.h_length;
+  int batchSize = handle.batch_size;
+  int M = *handle.M;
+
+  if (handle.reverse) {
+    rmemcpyf(handle.H, h, hLength);
   } else {
-    if (xLength > 50) {
-      handle.algorithm = kConvolutionAlgorithmFFT;
-      handle.handle.fft = convolve_fft_initialize(xLength, hLength);
-    } else {
-      handle.algorithm = kConvolutionAlgorithmBruteForce;
+    memcpy(handle.H, h, hLength * sizeof(h[0]));
+  }
+  fftf_calc(handle.fft_filter_plan);
+
+  for (int i = 0; i < batchSize; i++) {
+    memcpy(handle.inputs[i], x + i * xLength, xLength * sizeof(x[0]));
+  }
+  fftf_calc(handle.fft_plan);
+
+  // One spectrum multiply sweep over the whole batch
+  for (int i = 0; i < batchSize; i++) {
+    float *X = handle.inputs[i];
+    int istart = 0;
+#ifdef SIMD
+    istart = M;
+    for (int cci = 0; cci < M; cci += FLOAT_STEP) {
+      complex_multiply(X + cci, handle.H + cci, X + cci);
+    }
+#endif
+    for (int cci = istart; cci < M + 2; cci += 2) {
+      complex_multiply_na(X + cci, handle.H + cci, X + cci);
     }
   }
+
+  fftf_calc(handle.fft_inverse_plan);
+
+  for (int i = 0; i < batchSize; i++) {
+    real_multiply_scalar(handle.inputs[i], xLength + hLength - 1, 1.0f / M,
+                         result + i * (xLength + hLength - 1));
+  }
+}
+
+typedef struct ConvolutionCacheEntry {
+  ConvolutionHandle handle;
+  int ref_count;
+  struct ConvolutionCacheEntry *next;
+} ConvolutionCacheEntry;
+
+static ConvolutionCacheEntry *convolution_cache = NULL;
+static int convolution_cache_enabled = 0;
+static pthread_mutex_t convolution_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static ConvolutionHandle convolve_initialize_uncached(size_t xLength,
+                                                      size_t hLength);
+static void convolve_finalize_uncached(ConvolutionHandle handle);
+
+void convolve_cache_enable(int value) {
+  convolution_cache_enabled = value;
+}
+
+void convolve_cache_clear(void) {
+  pthread_mutex_lock(&convolution_cache_lock);
+  ConvolutionCacheEntry *entry = convolution_cache;
+  while (entry != NULL) {
+    ConvolutionCacheEntry *next = entry->next;
+    convolve_finalize_uncached(entry->handle);
+    free(entry);
+    entry = next;
+  }
+  convolution_cache = NULL;
+  pthread_mutex_unlock(&convolution_cache_lock);
+}
+
+ConvolutionHandle convolve_initialize(size_t xLength, size_t hLength) {
+  if (!convolution_cache_enabled) {
+    return convolve_initialize_uncached(xLength, hLength);
+  }
+  pthread_mutex_lock(&convolution_cache_lock);
+  for (ConvolutionCacheEntry *entry = convolution_cache; entry != NULL;
+       entry = entry->next) {
+    if (entry->handle.x_length == (int)xLength &&
+        entry->handle.h_length == (int)hLength) {
+      entry->ref_count++;
+      ConvolutionHandle handle = entry->handle;
+      pthread_mutex_unlock(&convolution_cache_lock);
+      return handle;
+    }
+  }
+  ConvolutionHandle handle = convolve_initialize_uncached(xLength, hLength);
+  if (handle.algorithm != kConvolutionAlgorithmBruteForce) {
+    handle.cached = 1;
+    ConvolutionCacheEntry *entry = malloc(sizeof(ConvolutionCacheEntry));
+    entry->handle = handle;
+    entry->ref_count = 1;
+    entry->next = convolution_cache;
+    convolution_cache = entry;
+  }
+  pthread_mutex_unlock(&convolution_cache_lock);
+  return handle;
+}
+
+ConvolutionHandle convolve_initialize_symmetric(size_t xLength,
+                                                size_t hLength) {
+  // The flag lives in the returned value only, so the cached FFT and
+  // overlap-save state (which does not care about symmetry) stays shared
+  ConvolutionHandle handle = convolve_initialize(xLength, hLength);
+  handle.symmetric = 1;
+  return handle;
+}
+
+static ConvolutionTuning convolution_tuning = {
+  200,
+#ifdef __ARM_NEON__
+  50
 #else
+  350
+#endif
+};
+
+ConvolutionTuning convolve_tuning_get(void) {
+  return convolution_tuning;
+}
+
+void convolve_tuning_set(ConvolutionTuning tuning) {
+  convolution_tuning = tuning;
+}
+
+static double convolve_tune_now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double convolve_tune_brute(const float *x, size_t xLength,
+                                  const float *h, size_t hLength,
+                                  float *result, int iterations) {
+  double start = convolve_tune_now();
+  for (int i = 0; i < iterations; i++) {
+    convolve_simd(1, x, xLength, h, hLength, result);
+  }
+  return convolve_tune_now() - start;
+}
+
+static double convolve_tune_fft(const float *x, size_t xLength,
+                                const float *h, size_t hLength,
+                                float *result, int iterations) {
+  ConvolutionFFTHandle handle = convolve_fft_initialize(xLength, hLength);
+  double start = convolve_tune_now();
+  for (int i = 0; i < iterations; i++) {
+    convolve_fft(handle, x, h, result);
+  }
+  double elapsed = convolve_tune_now() - start;
+  convolve_fft_finalize(handle);
+  return elapsed;
+}
+
+static double convolve_tune_overlap_save(const float *x, size_t xLength,
+                                         const float *h, size_t hLength,
+                                         float *result, int iterations) {
+  ConvolutionOverlapSaveHandle handle =
+      convolve_overlap_save_initialize(xLength, hLength);
+  double start = convolve_tune_now();
+  for (int i = 0; i < iterations; i++) {
+    convolve_overlap_save(handle, x, h, result);
+  }
+  double elapsed = convolve_tune_now() - start;
+  convolve_overlap_save_finalize(handle);
+  return elapsed;
+}
+
+void convolve_tune(void) {
+  const int maxLength = 4096;
+  const int iterations = 50;
+  float *x = mallocf(maxLength);
+  float *h = mallocf(maxLength);
+  float *result = mallocf(2 * maxLength);
+  for (int i = 0; i < maxLength; i++) {
+    x[i] = i % 23;
+    h[i] = i % 17;
+  }
+
+  // FFT vs brute force with xLength == hLength (the xLength <= 2 * hLength
+  // branch of convolve_initialize())
+  convolution_tuning.fft_threshold = maxLength;
+  for (int n = 32; n <= maxLength; n *= 2) {
+    if (convolve_tune_fft(x, n, h, n, result, iterations) <
+        convolve_tune_brute(x, n, h, n, result, iterations)) {
+      convolution_tuning.fft_threshold = n;
+      break;
+    }
+  }
+
+  // Overlap-save vs brute force with a short filter (the xLength >
+  // 2 * hLength branch); hLength matches the shortest sensible filter
+  const int hTuneLength = 50;
+  convolution_tuning.overlap_save_threshold = maxLength;
+  for (int n = 128; n <= maxLength; n *= 2) {
+    if (convolve_tune_overlap_save(x, n, h, hTuneLength, result, iterations) <
+        convolve_tune_brute(x, n, h, hTuneLength, result, iterations)) {
+      convolution_tuning.overlap_save_threshold = n;
+      break;
+    }
+  }
+
+  freef(x);
+  freef(h);
+  freef(result);
+}
+
+static ConvolutionHandle convolve_initialize_uncached(size_t xLength,
+                                                      size_t hLength) {
+  ConvolutionHandle handle;
+  handle.x_length = xLength;
+  handle.h_length = hLength;
+  handle.symmetric = 0;
+  handle.cached = 0;
   if (xLength > hLength * 2) {
-    if (xLength > 200) {
+    if ((int)xLength > convolution_tuning.overlap_save_threshold) {
       handle.algorithm = kConvolutionAlgorithmOverlapSave;
       handle.handle.os = convolve_overlap_save_initialize(xLength, hLength);
     } else {
       handle.algorithm = kConvolutionAlgorithmBruteForce;
     }
   } else {
-    if (xLength > 350) {
+    if ((int)xLength > convolution_tuning.fft_threshold) {
       handle.algorithm = kConvolutionAlgorithmFFT;
       handle.handle.fft = convolve_fft_initialize(xLength, hLength);
     } else {
       handle.algorithm = kConvolutionAlgorithmBruteForce;
     }
   }
-#endif
   return handle;
 }
 
 void convolve_finalize(ConvolutionHandle handle) {
+  // The membership recorded at initialize time decides the disposal, not
+  // the current state of the enable flag: a cached handle finalized after
+  // convolve_cache_enable(0) must still only drop its reference, and an
+  // uncached one created before convolve_cache_enable(1) must not touch a
+  // same-shape cache entry it never referenced.
+  if (handle.cached) {
+    pthread_mutex_lock(&convolution_cache_lock);
+    for (ConvolutionCacheEntry *entry = convolution_cache; entry != NULL;
+         entry = entry->next) {
+      if (entry->handle.x_length == handle.x_length &&
+          entry->handle.h_length == handle.h_length) {
+        entry->ref_count--;
+        pthread_mutex_unlock(&convolution_cache_lock);
+        return;
+      }
+    }
+    pthread_mutex_unlock(&convolution_cache_lock);
+    // The entry owning the plans is gone: convolve_cache_clear() already
+    // destroyed them, so there is nothing left to free here
+    return;
+  }
+  convolve_finalize_uncached(handle);
+}
+
+static void convolve_finalize_uncached(ConvolutionHandle handle) {
   switch (handle.algorithm) {
     case kConvolutionAlgorithmFFT:
       convolve_fft_finalize(handle.handle.fft);
@@ -381,6 +1440,7 @@ void convolve_finalize(ConvolutionHandle handle) {
 void convolve(ConvolutionHandle handle,
               const float *__restrict x, const float *__restrict h,
               float *__restrict result) {
+  SIMD_STATS_START();
   switch (handle.algorithm) {
     case kConvolutionAlgorithmFFT:
       convolve_fft(handle.handle.fft, x, h, result);
@@ -389,9 +1449,16 @@ void convolve(ConvolutionHandle handle,
       convolve_overlap_save(handle.handle.os, x, h, result);
       break;
     case kConvolutionAlgorithmBruteForce:
-      convolve_simd(1, x, handle.x_length, h, handle.h_length, result);
+      if (handle.symmetric) {
+        convolve_simd_symmetric(1, x, handle.x_length, h, handle.h_length,
+                                result);
+      } else {
+        convolve_simd(1, x, handle.x_length, h, handle.h_length, result);
+      }
       break;
   }
+  SIMD_STATS_FINISH(SIMD_KERNEL_CONVOLVE,
+                    handle.x_length + handle.h_length);
 }
 
 #endif  // #ifndef NO_FFTF
@@ -31,6 +31,11 @@
 #ifndef NO_FFTF
 #define LIBSIMD_IMPLEMENTATION
 #include "inc/simd/correlate.h"
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fftf/api.h>
 #include "inc/simd/convolve.h"
 #include "inc/simd/arithmetic.h"
 
@@ -41,6 +46,14 @@ CrossCorrelationFFTHandle cross_correlate_fft_initialize(size_t xLength,
   return handle;
 }
 
+CrossCorrelationFFTHandle cross_correlate_fft_initialize_options(
+    size_t xLength, size_t hLength, ConvolutionFFTOptions options) {
+  CrossCorrelationFFTHandle handle = convolve_fft_initialize_options(
+      xLength, hLength, options);
+  handle.reverse = 1;
+  return handle;
+}
+
 void cross_correlate_fft(CrossCorrelationFFTHandle handle,
                          const float *x, const float *h,
                          float *result) {
@@ -51,6 +64,106 @@ void cross_correlate_fft_finalize(CrossCorrelationFFTHandle handle) {
   convolve_fft_finalize(handle);
 }
 
+CrossCorrelationFFTMultiHandle cross_correlate_fft_multi_initialize(
+    size_t xLength, size_t hLength,
+    const float *templates, size_t templateCount) {
+  assert(xLength > 0);
+  assert(hLength > 0);
+  assert(hLength <= xLength);
+  assert(templates);
+  assert(templateCount > 0);
+
+  CrossCorrelationFFTMultiHandle handle;
+
+  int M = xLength + hLength - 1;
+  if ((M & (M - 1)) != 0) {
+    int log = 1;
+    while (M >>= 1) {
+      log++;
+    }
+    M = (1 << log);
+  }
+  // The scratch buffers and the cached spectra all live exactly as long
+  // as the handle, so a single arena backs them.
+  handle.arena = simd_arena_create(
+      (templateCount + 2) * (M + 2) * sizeof(float) + 4 * 64);
+  handle.M = simd_arena_alloc(&handle.arena, sizeof(M));
+  *handle.M = M;
+  handle.x_length = xLength;
+  handle.h_length = hLength;
+  handle.template_count = templateCount;
+
+  handle.X = simd_arena_alloc(&handle.arena, (M + 2) * sizeof(float));
+  handle.work = simd_arena_alloc(&handle.arena, (M + 2) * sizeof(float));
+  handle.H = simd_arena_alloc(&handle.arena,
+                              templateCount * (M + 2) * sizeof(float));
+
+  handle.fft_plan = fftf_init(
+      FFTF_TYPE_REAL, FFTF_DIRECTION_FORWARD,
+      FFTF_DIMENSION_1D, handle.M,
+      convolve_fft_plan_options(), handle.X, handle.X);
+  assert(handle.fft_plan);
+
+  handle.fft_inverse_plan = fftf_init(
+      FFTF_TYPE_REAL, FFTF_DIRECTION_BACKWARD,
+      FFTF_DIMENSION_1D, handle.M,
+      convolve_fft_plan_options(), handle.work, handle.work);
+  assert(handle.fft_inverse_plan);
+
+  // Transform every template once, caching the spectra in the handle.
+  // The templates are stored time-reversed so that the per-call stage is
+  // the same plain spectrum multiply cross_correlate_fft() boils down to.
+  for (int t = 0; t < (int)templateCount; t++) {
+    memsetf(handle.X, 0.f, M + 2);
+    rmemcpyf(handle.X, templates + t * hLength, hLength);
+    fftf_calc(handle.fft_plan);
+    memcpy(handle.H + t * (M + 2), handle.X, (M + 2) * sizeof(float));
+  }
+
+  return handle;
+}
+
+void cross_correlate_fft_multi(CrossCorrelationFFTMultiHandle handle,
+                               const float *x, float *result) {
+  assert(x != NULL);
+  assert(result != NULL);
+
+  int xLength = handle.x_length;
+  int hLength = handle.h_length;
+  int M = *handle.M;
+
+  // One forward transform of the signal, shared by all the templates.
+  // The padding must be re-zeroed every time: the forward transform works
+  // in-place, so the tail of X holds spectrum data from the previous call.
+  memcpy(handle.X, x, xLength * sizeof(x[0]));
+  memsetf(handle.X + xLength, 0.f, M + 2 - xLength);
+  fftf_calc(handle.fft_plan);
+
+  float scale = 1.0f / M;
+  for (int t = 0; t < handle.template_count; t++) {
+    const float *H = handle.H + t * (M + 2);
+    int istart = 0;
+#ifdef SIMD
+    istart = M;
+    for (int i = 0; i < M; i += FLOAT_STEP) {
+      complex_multiply_scaled(handle.X + i, H + i, handle.work + i, scale);
+    }
+#endif
+    for (int i = istart; i < M + 2; i += 2) {
+      complex_multiply_scaled_na(handle.X + i, H + i, handle.work + i, scale);
+    }
+    fftf_calc(handle.fft_inverse_plan);
+    memcpy(result + t * (xLength + hLength - 1), handle.work,
+           (xLength + hLength - 1) * sizeof(float));
+  }
+}
+
+void cross_correlate_fft_multi_finalize(CrossCorrelationFFTMultiHandle handle) {
+  fftf_destroy(handle.fft_plan);
+  fftf_destroy(handle.fft_inverse_plan);
+  simd_arena_destroy(&handle.arena);
+}
+
 CrossCorrelationOverlapSaveHandle cross_correlate_overlap_save_initialize(
     size_t xLength, size_t hLength) {
   CrossCorrelationOverlapSaveHandle handle =
@@ -71,6 +184,19 @@ void cross_correlate_overlap_save_finalize(
   convolve_overlap_save_finalize(handle);
 }
 
+void cross_correlate_argmax(CrossCorrelationOverlapSaveHandle handle,
+                            const float *x, const float *h,
+                            int *position, float *value) {
+  convolve_overlap_save_argmax(handle, x, h, position, value);
+}
+
+void cross_correlate_peaks(CrossCorrelationOverlapSaveHandle handle,
+                           const float *x, const float *h,
+                           ExtremumType type,
+                           ExtremumPoint **results, size_t *resultsLength) {
+  convolve_overlap_save_peaks(handle, x, h, type, results, resultsLength);
+}
+
 void cross_correlate_simd(int simd,
                           const float *__restrict x, size_t xLength,
                           const float *__restrict h, size_t hLength,
@@ -83,7 +209,23 @@ void cross_correlate_simd(int simd,
       end = (int)xLength;
     }
     if (simd) {
-#ifdef __AVX__
+#ifdef __AVX512F__
+      int simdEnd = beg + ((end - beg) & ~15);
+      __m512 accum = _mm512_setzero_ps();
+      for (int m = beg; m < simdEnd; m += 16) {
+        __m512 xvec = _mm512_loadu_ps(x + m);
+        __m512 hvec = _mm512_loadu_ps(h + n + m);
+        accum = _mm512_fmadd_ps(xvec, hvec, accum);
+      }
+      if (simdEnd < end) {
+        __mmask16 tailMask = (__mmask16)((1u << (end - simdEnd)) - 1);
+        __m512 xvec = _mm512_maskz_loadu_ps(tailMask, x + simdEnd);
+        __m512 hvec = _mm512_maskz_loadu_ps(tailMask, h + n + simdEnd);
+        accum = _mm512_fmadd_ps(xvec, hvec, accum);
+      }
+      sum = _mm512_reduce_add_ps(accum);
+    } else {
+#elif defined(__AVX__)
       int simdEnd = beg + ((end - beg) & ~7);
       __m256 accum = _mm256_setzero_ps();
       for (int m = beg; m < simdEnd; m += 8) {
@@ -125,6 +267,238 @@ void cross_correlate_simd(int simd,
   }
 }
 
+void cross_correlate_ncc(int simd,
+                         const float *__restrict x, size_t xLength,
+                         const float *__restrict h, size_t hLength,
+                         float *__restrict result) {
+  assert(x);
+  assert(h);
+  assert(result);
+  assert(hLength > 0);
+  assert(xLength >= hLength);
+
+  // The template statistics do not depend on the lag
+  float hSum = 0.f, hSumSq = 0.f;
+  for (int j = 0; j < (int)hLength; j++) {
+    hSum += h[j];
+    hSumSq += h[j] * h[j];
+  }
+  float hEnergy = hSumSq - hSum * hSum / hLength;
+
+  // The window statistics are maintained incrementally: one sample enters
+  // and one leaves per lag, so x is read once for them instead of
+  // re-scanning the whole window
+  float wSum = 0.f, wSumSq = 0.f;
+  for (int j = 0; j < (int)hLength; j++) {
+    wSum += x[j];
+    wSumSq += x[j] * x[j];
+  }
+
+  for (int i = 0; i <= (int)(xLength - hLength); i++) {
+    float dot = 0.f;
+    if (simd) {
+#ifdef __AVX512F__
+      int simdEnd = (int)hLength & ~15;
+      __m512 accum = _mm512_setzero_ps();
+      for (int j = 0; j < simdEnd; j += 16) {
+        __m512 xvec = _mm512_loadu_ps(x + i + j);
+        __m512 hvec = _mm512_loadu_ps(h + j);
+        accum = _mm512_fmadd_ps(xvec, hvec, accum);
+      }
+      if (simdEnd < (int)hLength) {
+        __mmask16 tailMask = (__mmask16)((1u << (hLength - simdEnd)) - 1);
+        __m512 xvec = _mm512_maskz_loadu_ps(tailMask, x + i + simdEnd);
+        __m512 hvec = _mm512_maskz_loadu_ps(tailMask, h + simdEnd);
+        accum = _mm512_fmadd_ps(xvec, hvec, accum);
+      }
+      dot = _mm512_reduce_add_ps(accum);
+    } else {
+#elif defined(__AVX__)
+      int simdEnd = (int)hLength & ~7;
+      __m256 accum = _mm256_setzero_ps();
+      for (int j = 0; j < simdEnd; j += 8) {
+        __m256 xvec = _mm256_loadu_ps(x + i + j);
+        __m256 hvec = _mm256_loadu_ps(h + j);
+        __m256 mulres = _mm256_mul_ps(xvec, hvec);
+        accum = _mm256_add_ps(accum, mulres);
+      }
+      accum = _mm256_hadd_ps(accum, accum);
+      accum = _mm256_hadd_ps(accum, accum);
+      dot = _mm256_get_ps(accum, 0) + _mm256_get_ps(accum, 4);
+      for (int j = simdEnd; j < (int)hLength; j++) {
+        dot += x[i + j] * h[j];
+      }
+    } else {
+#elif defined(__ARM_NEON__)
+      int simdEnd = (int)hLength & ~3;
+      float32x4_t accum = vdupq_n_f32(0.f);
+      for (int j = 0; j < simdEnd; j += 4) {
+        float32x4_t xvec = vld1q_f32(x + i + j);
+        float32x4_t hvec = vld1q_f32(h + j);
+        accum = vmlaq_f32(accum, xvec, hvec);
+      }
+      float32x2_t accum2 = vpadd_f32(vget_high_f32(accum),
+                                     vget_low_f32(accum));
+      dot = vget_lane_f32(accum2, 0) + vget_lane_f32(accum2, 1);
+      for (int j = simdEnd; j < (int)hLength; j++) {
+        dot += x[i + j] * h[j];
+      }
+    } else {
+#else
+    } {
+#endif
+      for (int j = 0; j < (int)hLength; j++) {
+        dot += x[i + j] * h[j];
+      }
+    }
+    float num = dot - wSum * hSum / hLength;
+    float den = sqrtf((wSumSq - wSum * wSum / hLength) * hEnergy);
+    result[i] = den > 0.f? num / den : 0.f;
+    if (i < (int)(xLength - hLength)) {
+      float out = x[i];
+      float in = x[i + hLength];
+      wSum += in - out;
+      wSumSq += in * in - out * out;
+    }
+  }
+}
+
+void cross_correlate_2d(int simd,
+                        const float *__restrict src, size_t srcStride,
+                        size_t width, size_t height,
+                        const float *__restrict kernel,
+                        size_t kernelWidth, size_t kernelHeight,
+                        float *__restrict dst) {
+  assert(src);
+  assert(kernel);
+  assert(dst);
+  assert(kernelWidth > 0 && kernelWidth <= width);
+  assert(kernelHeight > 0 && kernelHeight <= height);
+  assert(srcStride >= width);
+
+  int dstWidth = width - kernelWidth + 1;
+  int dstHeight = height - kernelHeight + 1;
+
+  for (int y = 0; y < dstHeight; y++) {
+    for (int x = 0; x < dstWidth; x++) {
+      float sum = 0.f;
+      if (simd) {
+#ifdef __AVX512F__
+        int simdEnd = (int)kernelWidth & ~15;
+        __m512 accum = _mm512_setzero_ps();
+        __mmask16 tailMask =
+            (__mmask16)((1u << (kernelWidth - simdEnd)) - 1);
+        for (int ky = 0; ky < (int)kernelHeight; ky++) {
+          const float *row = src + (y + ky) * srcStride + x;
+          const float *krow = kernel + ky * kernelWidth;
+          for (int kx = 0; kx < simdEnd; kx += 16) {
+            __m512 svec = _mm512_loadu_ps(row + kx);
+            __m512 kvec = _mm512_loadu_ps(krow + kx);
+            accum = _mm512_fmadd_ps(svec, kvec, accum);
+          }
+          if (simdEnd < (int)kernelWidth) {
+            __m512 svec = _mm512_maskz_loadu_ps(tailMask, row + simdEnd);
+            __m512 kvec = _mm512_maskz_loadu_ps(tailMask, krow + simdEnd);
+            accum = _mm512_fmadd_ps(svec, kvec, accum);
+          }
+        }
+        sum = _mm512_reduce_add_ps(accum);
+      } else {
+#elif defined(__AVX__)
+        int simdEnd = (int)kernelWidth & ~7;
+        __m256 accum = _mm256_setzero_ps();
+        for (int ky = 0; ky < (int)kernelHeight; ky++) {
+          const float *row = src + (y + ky) * srcStride + x;
+          const float *krow = kernel + ky * kernelWidth;
+          for (int kx = 0; kx < simdEnd; kx += 8) {
+            __m256 svec = _mm256_loadu_ps(row + kx);
+            __m256 kvec = _mm256_loadu_ps(krow + kx);
+            __m256 mulres = _mm256_mul_ps(svec, kvec);
+            accum = _mm256_add_ps(accum, mulres);
+          }
+          for (int kx = simdEnd; kx < (int)kernelWidth; kx++) {
+            sum += row[kx] * krow[kx];
+          }
+        }
+        accum = _mm256_hadd_ps(accum, accum);
+        accum = _mm256_hadd_ps(accum, accum);
+        sum += _mm256_get_ps(accum, 0) + _mm256_get_ps(accum, 4);
+      } else {
+#elif defined(__ARM_NEON__)
+        int simdEnd = (int)kernelWidth & ~3;
+        float32x4_t accum = vdupq_n_f32(0.f);
+        for (int ky = 0; ky < (int)kernelHeight; ky++) {
+          const float *row = src + (y + ky) * srcStride + x;
+          const float *krow = kernel + ky * kernelWidth;
+          for (int kx = 0; kx < simdEnd; kx += 4) {
+            float32x4_t svec = vld1q_f32(row + kx);
+            float32x4_t kvec = vld1q_f32(krow + kx);
+            accum = vmlaq_f32(accum, svec, kvec);
+          }
+          for (int kx = simdEnd; kx < (int)kernelWidth; kx++) {
+            sum += row[kx] * krow[kx];
+          }
+        }
+        float32x2_t accum2 = vpadd_f32(vget_high_f32(accum),
+                                       vget_low_f32(accum));
+        sum += vget_lane_f32(accum2, 0) + vget_lane_f32(accum2, 1);
+      } else {
+#else
+      } {
+#endif
+        for (int ky = 0; ky < (int)kernelHeight; ky++) {
+          const float *row = src + (y + ky) * srcStride + x;
+          const float *krow = kernel + ky * kernelWidth;
+          for (int kx = 0; kx < (int)kernelWidth; kx++) {
+            sum += row[kx] * krow[kx];
+          }
+        }
+      }
+      dst[y * dstWidth + x] = sum;
+    }
+  }
+}
+
+void cross_correlate_simd_f64(int simd,
+                              const double *__restrict x, size_t xLength,
+                              const double *__restrict h, size_t hLength,
+                              double *__restrict result) {
+  for (int n = hLength - 1; n > -(int)xLength; n--) {
+    double sum = 0.;
+    int beg = n <= 0? -n : 0;
+    int end = -n + hLength;
+    if (end > (int)xLength) {
+      end = (int)xLength;
+    }
+    if (simd) {
+#ifdef __AVX__
+      int simdEnd = beg + ((end - beg) & ~3);
+      __m256d accum = _mm256_setzero_pd();
+      for (int m = beg; m < simdEnd; m += 4) {
+        __m256d xvec = _mm256_loadu_pd(x + m);
+        __m256d hvec = _mm256_loadu_pd(h + n + m);
+        __m256d mulres = _mm256_mul_pd(xvec, hvec);
+        accum = _mm256_add_pd(accum, mulres);
+      }
+      __m128d halves = _mm_add_pd(_mm256_castpd256_pd128(accum),
+                                  _mm256_extractf128_pd(accum, 1));
+      sum = _mm_cvtsd_f64(halves) +
+          _mm_cvtsd_f64(_mm_unpackhi_pd(halves, halves));
+      for (int m = simdEnd; m < end; m++) {
+        sum += x[m] * h[n + m];
+      }
+    } else {
+#else
+    } {
+#endif
+      for (int m = beg; m < end; m++) {
+        sum += x[m] * h[n + m];
+      }
+    }
+    result[-n + hLength - 1] = sum;
+  }
+}
+
 CrossCorrelationHandle cross_correlate_initialize(size_t xLength,
                                                 size_t hLength) {
   CrossCorrelationHandle handle = convolve_initialize(xLength, hLength);
@@ -158,4 +532,57 @@ void cross_correlate(CrossCorrelationHandle handle,
 void cross_correlate_finalize(CrossCorrelationHandle handle) {
   convolve_finalize(handle);
 }
+
+/// @brief The default number of result samples per cross_correlate_stream()
+/// consumer call: one block comfortably fits the last level cache together
+/// with its FFT scratch.
+#define CROSS_CORRELATE_STREAM_BLOCK 16384
+
+void cross_correlate_stream(const float *x, size_t xLength,
+                            const float *h, size_t hLength,
+                            size_t blockSize,
+                            cross_correlate_consumer consumer,
+                            void *user) {
+  assert(x);
+  assert(h);
+  assert(consumer);
+  assert(xLength > 0);
+  assert(hLength > 0);
+  assert(xLength > hLength);
+
+  simd_madvise_sequential(x, xLength * sizeof(float));
+
+  size_t block = blockSize > 0? blockSize : CROSS_CORRELATE_STREAM_BLOCK;
+  // Correlation is convolution with the reversed template
+  float *reversed = mallocf(hLength);
+  assert(reversed);
+  rmemcpyf(reversed, h, hLength);
+  ConvolutionStreamHandle handle =
+      convolve_stream_initialize(reversed, hLength, block);
+
+  float *input = mallocf(block);
+  float *result = mallocf(block);
+  assert(input);
+  assert(result);
+  size_t total = xLength + hLength - 1;
+  for (size_t offset = 0; offset < total; offset += block) {
+    size_t count = total - offset < block? total - offset : block;
+    size_t avail = 0;
+    if (offset < xLength) {
+      avail = xLength - offset < block? xLength - offset : block;
+      memcpy(input, x + offset, avail * sizeof(float));
+    }
+    // Zeros past the end of x drain the correlation tail
+    if (avail < block) {
+      memsetf(input + avail, 0.f, block - avail);
+    }
+    convolve_stream_feed(handle, input, result);
+    consumer(result, offset, count, user);
+  }
+
+  convolve_stream_finalize(handle);
+  freef(input);
+  freef(result);
+  freef(reversed);
+}
 #endif
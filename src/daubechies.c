@@ -31,17 +31,22 @@
 #define WAVELET_INTERNAL_USE
 #include "src/daubechies.h"
 
-const double kDaubechiesD[38][76] = {
+const double kDaubechiesD[WAVELET_DAUBECHIES_ROWS][WAVELET_DAUBECHIES_COLS] = {
+#if WAVELET_MAX_ORDER >= 2
   // 1 (2)
   {  7.071067811865475244008443621048490392848359376884740365883398e-01,
      7.071067811865475244008443621048490392848359376884740365883398e-01 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 4
   // 2 (4)
   {  4.829629131445341433748715998644486838169524195042022752011715e-01,
      8.365163037378079055752937809168732034593703883484392934953414e-01,
      2.241438680420133810259727622404003554678835181842717613871683e-01,
     -1.294095225512603811744494188120241641745344506599652569070016e-01 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 6
   // 3 (6)
   {  3.326705529500826159985115891390056300129233992450683597084705e-01,
      8.068915093110925764944936040887134905192973949948236181650920e-01,
@@ -49,7 +54,9 @@ const double kDaubechiesD[38][76] = {
     -1.350110200102545886963899066993744805622198452237811919756862e-01,
     -8.544127388202666169281916918177331153619763898808662976351748e-02,
      3.522629188570953660274066471551002932775838791743161039893406e-02 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 8
   // 4 (8)
   {  2.303778133088965008632911830440708500016152482483092977910968e-01,
      7.148465705529156470899219552739926037076084010993081758450110e-01,
@@ -59,7 +66,9 @@ const double kDaubechiesD[38][76] = {
      3.084138183556076362721936253495905017031482172003403341821219e-02,
      3.288301166688519973540751354924438866454194113754971259727278e-02,
     -1.059740178506903210488320852402722918109996490637641983484974e-02 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 10
   // 5 (10)
   {  1.601023979741929144807237480204207336505441246250578327725699e-01,
      6.038292697971896705401193065250621075074221631016986987969283e-01,
@@ -71,7 +80,9 @@ const double kDaubechiesD[38][76] = {
     -6.241490212798274274190519112920192970763557165687607323417435e-03,
     -1.258075199908199946850973993177579294920459162609785020169232e-02,
      3.335725285473771277998183415817355747636524742305315099706428e-03 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 12
   // 6 (12)
   {  1.115407433501094636213239172409234390425395919844216759082360e-01,
      4.946238903984530856772041768778555886377863828962743623531834e-01,
@@ -85,7 +96,9 @@ const double kDaubechiesD[38][76] = {
      5.538422011614961392519183980465012206110262773864964295476524e-04,
      4.777257510945510639635975246820707050230501216581434297593254e-03,
     -1.077301085308479564852621609587200035235233609334419689818580e-03 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 14
   // 7 (14)
   {  7.785205408500917901996352195789374837918305292795568438702937e-02,
      3.965393194819173065390003909368428563587151149333287401110499e-01,
@@ -101,7 +114,9 @@ const double kDaubechiesD[38][76] = {
      4.295779729213665211321291228197322228235350396942409742946366e-04,
     -1.801640704047490915268262912739550962585651469641090625323864e-03,
      3.537137999745202484462958363064254310959060059520040012524275e-04 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 16
   // 8 (16)
   {  5.441584224310400995500940520299935503599554294733050397729280e-02,
      3.128715909142999706591623755057177219497319740370229185698712e-01,
@@ -119,7 +134,9 @@ const double kDaubechiesD[38][76] = {
     -3.917403733769470462980803573237762675229350073890493724492694e-04,
      6.754494064505693663695475738792991218489630013558432103617077e-04,
     -1.174767841247695337306282316988909444086693950311503927620013e-04 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 18
   // 9 (18)
   {  3.807794736387834658869765887955118448771714496278417476647192e-02,
      2.438346746125903537320415816492844155263611085609231361429088e-01,
@@ -139,7 +156,9 @@ const double kDaubechiesD[38][76] = {
      2.303857635231959672052163928245421692940662052463711972260006e-04,
     -2.519631889427101369749886842878606607282181543478028214134265e-04,
      3.934732031627159948068988306589150707782477055517013507359938e-05 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 20
   // 10 (20)
   {  2.667005790055555358661744877130858277192498290851289932779975e-02,
      1.881768000776914890208929736790939942702546758640393484348595e-01,
@@ -161,7 +180,9 @@ const double kDaubechiesD[38][76] = {
     -1.164668551292854509514809710258991891527461854347597362819235e-04,
      9.358867032006959133405013034222854399688456215297276443521873e-05,
     -1.326420289452124481243667531226683305749240960605829756400674e-05 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 22
   // 11 (22)
   {  1.869429776147108402543572939561975728967774455921958543286692e-02,
      1.440670211506245127951915849361001143023718967556239604318852e-01,
@@ -185,7 +206,9 @@ const double kDaubechiesD[38][76] = {
      5.443907469936847167357856879576832191936678525600793978043688e-05,
     -3.463498418698499554128085159974043214506488048233458035943601e-05,
      4.494274277236510095415648282310130916410497987383753460571741e-06 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 24
   // 12 (24)
   {  1.311225795722951750674609088893328065665510641931325007748280e-02,
      1.095662728211851546057045050248905426075680503066774046383657e-01,
@@ -211,7 +234,9 @@ const double kDaubechiesD[38][76] = {
     -2.424154575703078402978915320531719580423778362664282239377532e-05,
      1.277695221937976658714046362616620887375960941439428756055353e-05,
     -1.529071758068510902712239164522901223197615439660340672602696e-06 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 26
   // 13 (26)
   {  9.202133538962367972970163475644184667534171916416562386009703e-03,
      8.286124387290277964432027131230466405208113332890135072514277e-02,
@@ -239,7 +264,9 @@ const double kDaubechiesD[38][76] = {
      1.044193057140813708170714991080596951670706436217328169641474e-05,
     -4.700416479360868325650195165061771321650383582970958556568059e-06,
      5.220035098454864691736424354843176976747052155243557001531901e-07 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 28
   // 14 (28)
   {  6.461153460087947818166397448622814272327159419201199218101404e-03,
      6.236475884939889832798566758434877428305333693407667164602518e-02,
@@ -269,7 +296,9 @@ const double kDaubechiesD[38][76] = {
     -4.389704901781394115254042561367169829323085360800825718151049e-06,
      1.724994675367812769885712692741798523587894709867356576910717e-06,
     -1.787139968311359076334192938470839343882990309976959446994022e-07 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 30
   // 15 (30)
   {  4.538537361578898881459394910211696346663671243788786997916513e-03,
      4.674339489276627189170969334843575776579151700214943513113197e-02,
@@ -301,7 +330,9 @@ const double kDaubechiesD[38][76] = {
      1.811270407940577083768510912285841160577085925337507850590290e-06,
     -6.316882325881664421201597299517657654166137915121195510416641e-07,
      6.133359913305752029056299460289788601989190450885396512173845e-08 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 32
   // 16 (32)
   {  3.189220925347738029769547564645958687067086750131428767875878e-03,
      3.490771432367334641030147224023020009218241430503984146140054e-02,
@@ -335,7 +366,9 @@ const double kDaubechiesD[38][76] = {
     -7.363656785451205512099695719725563646585445545841663327433569e-07,
      2.308784086857545866405412732942006121306306735866655525372544e-07,
     -2.109339630100743097000572623603489906836297584591605307745349e-08 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 34
   // 17 (34)
   {  2.241807001037312853535962677074436914062191880560370733250531e-03,
      2.598539370360604338914864591720788315473944524878241294399948e-02,
@@ -371,7 +404,9 @@ const double kDaubechiesD[38][76] = {
      2.957700933316856754979905258816151367870345628924317307354639e-07,
     -8.423948446002680178787071296922877068410310942222799622593133e-08,
      7.267492968561608110879767441409035034158581719789791088892046e-09 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 36
   // 18 (36)
   {  1.576310218440760431540744929939777747670753710991660363684429e-03,
      1.928853172414637705921391715829052419954667025288497572236714e-02,
@@ -409,7 +444,9 @@ const double kDaubechiesD[38][76] = {
     -1.176098767028231698450982356561292561347579777695396953528141e-07,
      3.068835863045174800935478294933975372450179787894574492930570e-08,
     -2.507934454948598267195173183147126731806317144868275819941403e-09 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 38
   // 19 (38)
   {  1.108669763181710571099154195209715164245299677773435932135455e-03,
      1.428109845076439737439889152950199234745663442163665957870715e-02,
@@ -449,7 +486,9 @@ const double kDaubechiesD[38][76] = {
      4.636937775782604223430857728210948898871748291085962296649320e-08,
     -1.116402067035825816390504769142472586464975799284473682246076e-08,
      8.666848838997619350323013540782124627289742190273059319122840e-10 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 40
   // 20 (40)
   {  7.799536136668463215861994818889370970510722039232863880031127e-04,
      1.054939462495039832454480973015641498231961468733236691299796e-02,
@@ -491,7 +530,9 @@ const double kDaubechiesD[38][76] = {
     -1.814843248299695973210605258227024081458531110762083371310917e-08,
      4.056127055551832766099146230616888024627380574113178257963252e-09,
     -2.998836489619319566407767078372705385732460052685621923178375e-10 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 42
   // 21 (42)
   {  5.488225098526837086776336675992521426750673054588245523834775e-04,
      7.776639052354783754338787398088799862510779059555623704879234e-03,
@@ -535,7 +576,9 @@ const double kDaubechiesD[38][76] = {
      7.058033541231121859020947976903904685464512825731230495144226e-09,
     -1.471954197650365265189549600816698778213247061389470277337173e-09,
      1.038805571023706553035373138760372703492942617518816122570050e-10 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 44
   // 22 (44)
   {  3.862632314910982158524358900615460368877852009576899680767316e-04,
      5.721854631334539120809783403484493333555361591386208129183833e-03,
@@ -581,7 +624,9 @@ const double kDaubechiesD[38][76] = {
     -2.729623146632976083449327361739104754443221903317745768938846e-09,
      5.335938821667489905169783227036804533253011117886586305435615e-10,
     -3.602113484339554703794807810939301847299106970237814334104274e-11 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 46
   // 23 (46)
   {  2.719041941282888414192673609703302357098336003920923958924757e-04,
      4.202748893183833538390034372523511472345215563611003407984701e-03,
@@ -629,7 +674,9 @@ const double kDaubechiesD[38][76] = {
      1.050446453696543404071105111096438573423068913105255997908040e-09,
     -1.932405111313417542192651899622541612314066389643607507706887e-10,
      1.250203302351040941433216718217504240541423430995137507404787e-11 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 48
   // 24 (48)
   {  1.914358009475513695026138336474115599435172088053846745168462e-04,
      3.082081714905494436206199424544404720984720556128685270556458e-03,
@@ -679,7 +726,9 @@ const double kDaubechiesD[38][76] = {
     -4.024658644584379774251499574468195118601698713554294941756559e-10,
      6.991801157638230974132696433509625934021677793453732225542951e-11,
     -4.342782503803710247259037552886749457951053124203814185811297e-12 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 50
   // 25 (50)
   {  1.348029793470188994578489247159356055370460656508881471268611e-04,
      2.256959591854779520121391049628056149270016860666661928130747e-03,
@@ -732,7 +781,9 @@ const double kDaubechiesD[38][76] = {
      1.535901570162657197021927739530721955859277615795931442682785e-10,
     -2.527625163465644811048864286169758128142169484216932624854015e-11,
      1.509692082823910867903367712096001664979004526477422347957324e-12 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 52
   // 26 (52)
   {  9.493795750710592117802731381148054398461637804818126397577999e-05,
      1.650520233532988247022384885622071050555268137055829216839523e-03,
@@ -786,7 +837,9 @@ const double kDaubechiesD[38][76] = {
     -5.840408185341171468465492447799819262905317576847426970757700e-11,
      9.130510016371796243923232926650252570239054815939483900056681e-12,
     -5.251871224244435037810503452564279828539007071678724285717464e-13 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 54
   // 27 (54)
   {  6.687131385431931734918880680779563307675740731544063787599480e-05,
      1.205531231673213234251999812212394463872002561229330125152073e-03,
@@ -842,7 +895,9 @@ const double kDaubechiesD[38][76] = {
      2.213662088067662485181472969374945928903854605356443772873438e-11,
     -3.295790122476585807069953975043096139541415768606924980926275e-12,
      1.828188352882424933624530026056448539377272017834175009418822e-13 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 56
   // 28 (56)
   {  4.710807775014051101066545468288837625869263629358873937759173e-05,
      8.794985159843870273564636742144073059158975665525081816488582e-04,
@@ -900,7 +955,9 @@ const double kDaubechiesD[38][76] = {
     -8.365490471258800799349289794397908900767054085216008197372193e-12,
      1.188850533405901520842321749021089497203940688882364518455403e-12,
     -6.367772354714857335632692092267254266368934590973693820942617e-14 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 58
   // 29 (58)
   {  3.318966279841524761813546359818075441349169975922439988843475e-05,
      6.409516803044434540833706729120596322083061716935004987374676e-04,
@@ -960,7 +1017,9 @@ const double kDaubechiesD[38][76] = {
      3.152762413370310423797539876893861621418382024668704492620948e-12,
     -4.285654870068344101898185073376307686875386259541180967347399e-13,
      2.219191311588302960934661700068023727737812918006011019184982e-14 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 60
   // 30 (60)
   {  2.338616172731421471474407279894891960011661146356580425400538e-05,
      4.666379504285509336662000111055365140848987563882199035322085e-04,
@@ -1022,7 +1081,9 @@ const double kDaubechiesD[38][76] = {
     -1.185237592101582328254231496310584611948560976394420324137742e-12,
      1.543997570847620046003616417646988780670333040868954794039905e-13,
     -7.737942630954405708679963277418806436871098329050829841696327e-15 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 62
   // 31 (62)
   {  1.648013386456140748122177817418358316441195236228590958603489e-05,
      3.394122037769956699157160165352942212213928231154233571163033e-04,
@@ -1086,7 +1147,9 @@ const double kDaubechiesD[38][76] = {
      4.445467096291932163298411852093011459626037560439178917611592e-13,
     -5.559442050579014337641375730083534521513818164827556763756543e-14,
      2.699382879762665647295493928801387173921314576598505507855504e-15 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 64
   // 32 (64)
   {  1.161463302135014885567464100760659332951431420121048996305591e-05,
      2.466566906380903352739104211274667134470169443886449124673996e-04,
@@ -1152,7 +1215,9 @@ const double kDaubechiesD[38][76] = {
     -1.663800489433402369889818192962259823988673359967722467427927e-13,
      2.000715303810524954375796020597627467104635766752154321244151e-14,
     -9.421019139535078421314655362291088223782497046057523323473331e-16 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 66
   // 33 (66)
   {  8.186358314175091939858945975190102731733968885547217619434602e-06,
      1.791016153702791479424389068736094134247294413108336017758506e-04,
@@ -1220,7 +1285,9 @@ const double kDaubechiesD[38][76] = {
      6.214740247174398315576214699577230693021307854673557214652751e-14,
     -7.196510545363322414033654470779070592316600780697558361083151e-15,
      3.289373678416306368625564108782095644036415401902518812978798e-16 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 68
   // 34 (68)
   {  5.770510632730285627466067796809329117324708919047900817738025e-06,
      1.299476200679530037833484815390569400369432658207722720405084e-04,
@@ -1290,7 +1357,9 @@ const double kDaubechiesD[38][76] = {
     -2.317083703906408481078257081903089523234020423092175261925515e-14,
      2.587338381935699555813538163144986688834142571207152879144731e-15,
     -1.148944754480590128244815794312606245147888158018823490936280e-16 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 70
   // 35 (70)
   {  4.067934061148559026665247110206084571051201477121972612218005e-06,
      9.421469475576740631603027533116630224451049736050903361458759e-05,
@@ -1362,7 +1431,9 @@ const double kDaubechiesD[38][76] = {
      8.624037434720089202680337663692777682810714650060805832406135e-15,
     -9.298012529324185420921555664719863501848315099116725184370339e-16,
      4.014628712333488654318569164614220308046021091178184654250982e-17 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 72
   // 36 (72)
   {  2.867925182755946334630479473029238615535511775894262711054705e-06,
      6.826028678546358691748629102209605362240344266505035981791715e-05,
@@ -1436,7 +1507,9 @@ const double kDaubechiesD[38][76] = {
     -3.204628543401749860439316638848579711789176444320134355253750e-15,
      3.339971984818693213132578777712503670014459411167839211495237e-16,
     -1.403274175373190617489823209168013922564353495443487431242610e-17 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 74
   // 37 (74)
   {  2.022060862498392121815038335333633351464174415618614893795880e-06,
      4.942343750628132004714286117434454499485737947791397867195910e-05,
@@ -1512,7 +1585,9 @@ const double kDaubechiesD[38][76] = {
      1.189012387508252879928637969242590755033933791160383262132698e-15,
     -1.199280335852879554967035114674445327319437557227036460257649e-16,
      4.906615064935203694857690087429901193139905690549533773201453e-18 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 76
   // 38 (76)
   {  1.425776641674131672055420247567865803211784397464191115245081e-06,
      3.576251994264023012742569014888876217958307227940126418281357e-05,
@@ -1590,1565 +1665,5 @@ const double kDaubechiesD[38][76] = {
     -4.405307042483461342449027139838301611006835285455050155842865e-16,
      4.304596839558790016251867477122791508849697688058169053134463e-17,
     -1.716152451088744188732404281737964277713026087224248235541071e-18 }
-};
-
-const float kDaubechiesF[38][76] = {
-  // 1 (2)
-  { 7.0710678e-01f,
-    7.0710678e-01f },
-
-  // 2 (4)
-  { 4.8296291e-01f,
-    8.3651630e-01f,
-    2.2414387e-01f,
-   -1.2940952e-01f },
-
-  // 3 (6)
-  { 3.3267055e-01f,
-    8.0689151e-01f,
-    4.5987750e-01f,
-   -1.3501102e-01f,
-   -8.5441274e-02f,
-    3.5226292e-02f },
-
-  // 4 (8)
-  { 2.3037781e-01f,
-    7.1484657e-01f,
-    6.3088077e-01f,
-   -2.7983769e-02f,
-   -1.8703481e-01f,
-    3.0841382e-02f,
-    3.2883012e-02f,
-   -1.0597402e-02f },
-
-  // 5 (10)
-  { 1.6010240e-01f,
-    6.0382927e-01f,
-    7.2430853e-01f,
-    1.3842815e-01f,
-   -2.4229489e-01f,
-   -3.2244870e-02f,
-    7.7571494e-02f,
-   -6.2414902e-03f,
-   -1.2580752e-02f,
-    3.3357253e-03f },
-
-  // 6 (12)
-  { 1.1154074e-01f,
-    4.9462389e-01f,
-    7.5113391e-01f,
-    3.1525035e-01f,
-   -2.2626469e-01f,
-   -1.2976687e-01f,
-    9.7501606e-02f,
-    2.7522866e-02f,
-   -3.1582039e-02f,
-    5.5384220e-04f,
-    4.7772575e-03f,
-   -1.0773011e-03f },
-
-  // 7 (14)
-  { 7.7852054e-02f,
-    3.9653932e-01f,
-    7.2913209e-01f,
-    4.6978229e-01f,
-   -1.4390600e-01f,
-   -2.2403618e-01f,
-    7.1309219e-02f,
-    8.0612609e-02f,
-   -3.8029937e-02f,
-   -1.6574542e-02f,
-    1.2550999e-02f,
-    4.2957797e-04f,
-   -1.8016407e-03f,
-    3.5371380e-04f },
-
-  // 8 (16)
-  { 5.4415842e-02f,
-    3.1287159e-01f,
-    6.7563074e-01f,
-    5.8535468e-01f,
-   -1.5829105e-02f,
-   -2.8401554e-01f,
-    4.7248457e-04f,
-    1.2874743e-01f,
-   -1.7369301e-02f,
-   -4.4088254e-02f,
-    1.3981028e-02f,
-    8.7460940e-03f,
-   -4.8703530e-03f,
-   -3.9174037e-04f,
-    6.7544941e-04f,
-   -1.1747678e-04f },
-
-  // 9 (18)
-  { 3.8077947e-02f,
-    2.4383467e-01f,
-    6.0482312e-01f,
-    6.5728808e-01f,
-    1.3319739e-01f,
-   -2.9327378e-01f,
-   -9.6840783e-02f,
-    1.4854075e-01f,
-    3.0725681e-02f,
-   -6.7632829e-02f,
-    2.5094711e-04f,
-    2.2361662e-02f,
-   -4.7232048e-03f,
-   -4.2815037e-03f,
-    1.8476469e-03f,
-    2.3038576e-04f,
-   -2.5196319e-04f,
-    3.9347320e-05f },
-
-  // 10 (20)
-  { 2.6670058e-02f,
-    1.8817680e-01f,
-    5.2720119e-01f,
-    6.8845904e-01f,
-    2.8117234e-01f,
-   -2.4984642e-01f,
-   -1.9594627e-01f,
-    1.2736934e-01f,
-    9.3057365e-02f,
-   -7.1394147e-02f,
-   -2.9457537e-02f,
-    3.3212674e-02f,
-    3.6065536e-03f,
-   -1.0733175e-02f,
-    1.3953517e-03f,
-    1.9924053e-03f,
-   -6.8585669e-04f,
-   -1.1646686e-04f,
-    9.3588670e-05f,
-   -1.3264203e-05f },
-
-  // 11 (22)
-  { 1.8694298e-02f,
-    1.4406702e-01f,
-    4.4989976e-01f,
-    6.8568677e-01f,
-    4.1196437e-01f,
-   -1.6227525e-01f,
-   -2.7423085e-01f,
-    6.6043588e-02f,
-    1.4981201e-01f,
-   -4.6479955e-02f,
-   -6.6438786e-02f,
-    3.1335090e-02f,
-    2.0840904e-02f,
-   -1.5364821e-02f,
-   -3.3408589e-03f,
-    4.9284177e-03f,
-   -3.0859286e-04f,
-   -8.9302325e-04f,
-    2.4915252e-04f,
-    5.4439075e-05f,
-   -3.4634984e-05f,
-    4.4942743e-06f },
-
-  // 12 (24)
-  { 1.3112258e-02f,
-    1.0956627e-01f,
-    3.7735514e-01f,
-    6.5719872e-01f,
-    5.1588648e-01f,
-   -4.4763886e-02f,
-   -3.1617845e-01f,
-   -2.3779257e-02f,
-    1.8247861e-01f,
-    5.3595697e-03f,
-   -9.6432120e-02f,
-    1.0849130e-02f,
-    4.1546277e-02f,
-   -1.2218649e-02f,
-   -1.2840825e-02f,
-    6.7114990e-03f,
-    2.2486072e-03f,
-   -2.1795036e-03f,
-    6.5451282e-06f,
-    3.8865306e-04f,
-   -8.8504109e-05f,
-   -2.4241546e-05f,
-    1.2776952e-05f,
-   -1.5290718e-06f },
-
-  // 13 (26)
-  { 9.2021335e-03f,
-    8.2861244e-02f,
-    3.1199632e-01f,
-    6.1105585e-01f,
-    5.8888957e-01f,
-    8.6985726e-02f,
-   -3.1497291e-01f,
-   -1.2457673e-01f,
-    1.7947608e-01f,
-    7.2948934e-02f,
-   -1.0580762e-01f,
-   -2.6488406e-02f,
-    5.6139477e-02f,
-    2.3799723e-03f,
-   -2.3831421e-02f,
-    3.9239414e-03f,
-    7.2555894e-03f,
-   -2.7619112e-03f,
-   -1.3156739e-03f,
-    9.3232613e-04f,
-    4.9251525e-05f,
-   -1.6512899e-04f,
-    3.0678538e-05f,
-    1.0441931e-05f,
-   -4.7004165e-06f,
-    5.2200351e-07f },
-
-  // 14 (28)
-  { 6.4611535e-03f,
-    6.2364759e-02f,
-    2.5485027e-01f,
-    5.5430562e-01f,
-    6.3118785e-01f,
-    2.1867069e-01f,
-   -2.7168855e-01f,
-   -2.1803353e-01f,
-    1.3839521e-01f,
-    1.3998902e-01f,
-   -8.6748412e-02f,
-   -7.1548956e-02f,
-    5.5237126e-02f,
-    2.6981408e-02f,
-   -3.0185352e-02f,
-   -5.6150495e-03f,
-    1.2789493e-02f,
-   -7.4621899e-04f,
-   -3.8496389e-03f,
-    1.0616911e-03f,
-    7.0802115e-04f,
-   -3.8683195e-04f,
-   -4.1777246e-05f,
-    6.8755043e-05f,
-   -1.0337209e-05f,
-   -4.3897049e-06f,
-    1.7249947e-06f,
-   -1.7871400e-07f },
-
-  // 15 (30)
-  { 4.5385374e-03f,
-    4.6743395e-02f,
-    2.0602386e-01f,
-    4.9263177e-01f,
-    6.4581314e-01f,
-    3.3900254e-01f,
-   -1.9320414e-01f,
-   -2.8888260e-01f,
-    6.5282953e-02f,
-    1.9014671e-01f,
-   -3.9666177e-02f,
-   -1.1112094e-01f,
-    3.3877144e-02f,
-    5.4780551e-02f,
-   -2.5767007e-02f,
-   -2.0810050e-02f,
-    1.5083918e-02f,
-    5.1010004e-03f,
-   -6.4877346e-03f,
-   -2.4175649e-04f,
-    1.9433240e-03f,
-   -3.7348235e-04f,
-   -3.5956524e-04f,
-    1.5589649e-04f,
-    2.5792699e-05f,
-   -2.8133296e-05f,
-    3.3629872e-06f,
-    1.8112704e-06f,
-   -6.3168823e-07f,
-    6.1333599e-08f },
-
-  // 16 (32)
-  { 3.1892209e-03f,
-    3.4907714e-02f,
-    1.6506428e-01f,
-    4.3031272e-01f,
-    6.3735633e-01f,
-    4.4029026e-01f,
-   -8.9751089e-02f,
-   -3.2706331e-01f,
-   -2.7918208e-02f,
-    2.1119069e-01f,
-    2.7340264e-02f,
-   -1.3238831e-01f,
-   -6.2397228e-03f,
-    7.5924236e-02f,
-   -7.5889744e-03f,
-   -3.6888398e-02f,
-    1.0297660e-02f,
-    1.3993769e-02f,
-   -6.9900146e-03f,
-   -3.6442796e-03f,
-    3.1280234e-03f,
-    4.0789698e-04f,
-   -9.4102175e-04f,
-    1.1424152e-04f,
-    1.7478725e-04f,
-   -6.1035966e-05f,
-   -1.3945669e-05f,
-    1.1336609e-05f,
-   -1.0435713e-06f,
-   -7.3636568e-07f,
-    2.3087841e-07f,
-   -2.1093396e-08f },
-
-  // 17 (34)
-  { 2.2418070e-03f,
-    2.5985394e-02f,
-    1.3121490e-01f,
-    3.7035072e-01f,
-    6.1099662e-01f,
-    5.1831576e-01f,
-    2.7314970e-02f,
-   -3.2832075e-01f,
-   -1.2659975e-01f,
-    1.9731059e-01f,
-    1.0113549e-01f,
-   -1.2681569e-01f,
-   -5.7091420e-02f,
-    8.1105987e-02f,
-    2.2312336e-02f,
-   -4.6922438e-02f,
-   -3.2709555e-03f,
-    2.2733677e-02f,
-   -3.0429900e-03f,
-   -8.6029215e-03f,
-    2.9679967e-03f,
-    2.3012052e-03f,
-   -1.4368453e-03f,
-   -3.2813252e-04f,
-    4.3946543e-04f,
-   -2.5610110e-05f,
-   -8.2048032e-05f,
-    2.3186814e-05f,
-    6.9906010e-06f,
-   -4.5059425e-06f,
-    3.0165496e-07f,
-    2.9577009e-07f,
-   -8.4239484e-08f,
-    7.2674930e-09f },
-
-  // 18 (36)
-  { 1.5763102e-03f,
-    1.9288532e-02f,
-    1.0358847e-01f,
-    3.1467894e-01f,
-    5.7182681e-01f,
-    5.7180165e-01f,
-    1.4722311e-01f,
-   -2.9365404e-01f,
-   -2.1648093e-01f,
-    1.4953398e-01f,
-    1.6708131e-01f,
-   -9.2331884e-02f,
-   -1.0675225e-01f,
-    6.4887216e-02f,
-    5.7051248e-02f,
-   -4.4526142e-02f,
-   -2.3733210e-02f,
-    2.6670706e-02f,
-    6.2621680e-03f,
-   -1.3051481e-02f,
-    1.1863003e-04f,
-    4.9433436e-03f,
-   -1.1187327e-03f,
-   -1.3405963e-03f,
-    6.2846568e-04f,
-    2.1358156e-04f,
-   -1.9864855e-04f,
-   -1.5359171e-07f,
-    3.7412379e-05f,
-   -8.5206025e-06f,
-   -3.3326345e-06f,
-    1.7687130e-06f,
-   -7.6916327e-08f,
-   -1.1760988e-07f,
-    3.0688359e-08f,
-   -2.5079345e-09f },
-
-  // 19 (38)
-  { 1.1086698e-03f,
-    1.4281098e-02f,
-    8.1278113e-02f,
-    2.6438843e-01f,
-    5.2443638e-01f,
-    6.0170455e-01f,
-    2.6089495e-01f,
-   -2.2809139e-01f,
-   -2.8583863e-01f,
-    7.4652270e-02f,
-    2.1234974e-01f,
-   -3.3518542e-02f,
-   -1.4278570e-01f,
-    2.7584351e-02f,
-    8.6906756e-02f,
-   -2.6501236e-02f,
-   -4.5674226e-02f,
-    2.1623767e-02f,
-    1.9375550e-02f,
-   -1.3988389e-02f,
-   -5.8669223e-03f,
-    7.0407474e-03f,
-    7.6895436e-04f,
-   -2.6875518e-03f,
-    3.4180865e-04f,
-    7.3580252e-04f,
-   -2.6067614e-04f,
-   -1.2460079e-04f,
-    8.7112705e-05f,
-    5.1059505e-06f,
-   -1.6640176e-05f,
-    3.0109643e-06f,
-    1.5319315e-06f,
-   -6.8627557e-07f,
-    1.4470883e-08f,
-    4.6369378e-08f,
-   -1.1164021e-08f,
-    8.6668488e-10f },
-
-  // 20 (40)
-  { 7.7995361e-04f,
-    1.0549395e-02f,
-    6.3423780e-02f,
-    2.1994211e-01f,
-    4.7269619e-01f,
-    6.1049324e-01f,
-    3.6150230e-01f,
-   -1.3921209e-01f,
-   -3.2678680e-01f,
-   -1.6727088e-02f,
-    2.2829105e-01f,
-    3.9850246e-02f,
-   -1.5545875e-01f,
-   -2.4716827e-02f,
-    1.0229172e-01f,
-    5.6322469e-03f,
-   -6.1722900e-02f,
-    5.8746818e-03f,
-    3.2294300e-02f,
-   -8.7893249e-03f,
-   -1.3810526e-02f,
-    6.7216273e-03f,
-    4.4205424e-03f,
-   -3.5814943e-03f,
-   -8.3156217e-04f,
-    1.3925596e-03f,
-   -5.3497598e-05f,
-   -3.8510475e-04f,
-    1.0153289e-04f,
-    6.7742808e-05f,
-   -3.7105862e-05f,
-   -4.3761439e-06f,
-    7.2412483e-06f,
-   -1.0119940e-06f,
-   -6.8470796e-07f,
-    2.6339242e-07f,
-    2.0143220e-10f,
-   -1.8148432e-08f,
-    4.0561271e-09f,
-   -2.9988365e-10f },
-
-  // 21 (42)
-  { 5.4882251e-04f,
-    7.7766391e-03f,
-    4.9247772e-02f,
-    1.8135963e-01f,
-    4.1968794e-01f,
-    6.0150609e-01f,
-    4.4459045e-01f,
-   -3.5722920e-02f,
-   -3.3566409e-01f,
-   -1.1239707e-01f,
-    2.1156453e-01f,
-    1.1523330e-01f,
-   -1.3994042e-01f,
-   -8.1775943e-02f,
-    9.6600390e-02f,
-    4.5723406e-02f,
-   -6.4977505e-02f,
-   -1.8653859e-02f,
-    3.9726835e-02f,
-    3.3577564e-03f,
-   -2.0892054e-02f,
-    2.4034709e-03f,
-    8.9888244e-03f,
-   -2.8913343e-03f,
-   -2.9583740e-03f,
-    1.7166070e-03f,
-    6.3941850e-04f,
-   -6.9067112e-04f,
-   -3.1964063e-05f,
-    1.9366465e-04f,
-   -3.6355203e-05f,
-   -3.4996660e-05f,
-    1.5354825e-05f,
-    2.7903305e-06f,
-   -3.0900172e-06f,
-    3.1660954e-07f,
-    2.9921366e-07f,
-   -1.0004009e-07f,
-   -2.2540150e-09f,
-    7.0580335e-09f,
-   -1.4719542e-09f,
-    1.0388056e-10f },
-
-  // 22 (44)
-  { 3.8626323e-04f,
-    5.7218546e-03f,
-    3.8069937e-02f,
-    1.4836754e-01f,
-    3.6772868e-01f,
-    5.7843273e-01f,
-    5.0790109e-01f,
-    7.3724501e-02f,
-   -3.1272658e-01f,
-   -2.0056841e-01f,
-    1.6409319e-01f,
-    1.7997319e-01f,
-   -9.7110798e-02f,
-   -1.3176814e-01f,
-    6.8076314e-02f,
-    8.4557376e-02f,
-   -5.1364254e-02f,
-   -4.6530812e-02f,
-    3.6970847e-02f,
-    2.0586708e-02f,
-   -2.3480001e-02f,
-   -6.2137828e-03f,
-    1.2564725e-02f,
-    3.0013740e-04f,
-   -5.4556920e-03f,
-    1.0442607e-03f,
-    1.8270105e-03f,
-   -7.7069099e-04f,
-   -4.2378740e-04f,
-    3.2860941e-04f,
-    4.3458999e-05f,
-   -9.4052236e-05f,
-    1.1374350e-05f,
-    1.7373757e-05f,
-   -6.1667293e-06f,
-   -1.5651791e-06f,
-    1.2951821e-06f,
-   -8.7798799e-08f,
-   -1.2833362e-07f,
-    3.7612287e-08f,
-    1.6801714e-09f,
-   -2.7296231e-09f,
-    5.3359388e-10f,
-   -3.6021135e-11f },
-
-  // 23 (46)
-  { 2.7190419e-04f,
-    4.2027489e-03f,
-    2.9310004e-02f,
-    1.2051553e-01f,
-    3.1845081e-01f,
-    5.4493115e-01f,
-    5.5101852e-01f,
-    1.8139263e-01f,
-   -2.6139215e-01f,
-   -2.7140210e-01f,
-    9.2125407e-02f,
-    2.2357366e-01f,
-   -3.3037447e-02f,
-   -1.6401132e-01f,
-    2.0283075e-02f,
-    1.1229704e-01f,
-   -2.1126212e-02f,
-   -7.0207392e-02f,
-    2.1765857e-02f,
-    3.8495333e-02f,
-   -1.8523514e-02f,
-   -1.7537101e-02f,
-    1.2751944e-02f,
-    6.0318407e-03f,
-   -7.0753193e-03f,
-   -1.1348655e-03f,
-    3.1228764e-03f,
-   -2.4650140e-04f,
-   -1.0612312e-03f,
-    3.1942049e-04f,
-    2.5676245e-04f,
-   -1.5002185e-04f,
-   -3.3788948e-05f,
-    4.4260712e-05f,
-   -2.6352079e-06f,
-   -8.3478756e-06f,
-    2.3975695e-06f,
-    8.1475748e-07f,
-   -5.3390054e-07f,
-    1.8530918e-08f,
-    5.4175492e-08f,
-   -1.3999355e-08f,
-   -9.4728859e-10f,
-    1.0504465e-09f,
-   -1.9324051e-10f,
-    1.2502033e-11f },
-
-  // 24 (48)
-  { 1.9143580e-04f,
-    3.0820817e-03f,
-    2.2482340e-02f,
-    9.7262236e-02f,
-    2.7290892e-01f,
-    5.0437104e-01f,
-    5.7493922e-01f,
-    2.8098555e-01f,
-   -1.8727141e-01f,
-   -3.1794308e-01f,
-    4.7766137e-03f,
-    2.3923739e-01f,
-    4.2528730e-02f,
-   -1.7117535e-01f,
-   -3.8777174e-02f,
-    1.2101630e-01f,
-    2.0980114e-02f,
-   -8.2161654e-02f,
-   -4.5784362e-03f,
-    5.1301620e-02f,
-   -4.9447094e-03f,
-   -2.8213107e-02f,
-    7.6617219e-03f,
-    1.3049971e-02f,
-   -6.2914354e-03f,
-   -4.7465688e-03f,
-    3.7360462e-03f,
-    1.1537649e-03f,
-   -1.6964568e-03f,
-   -4.4161849e-05f,
-    5.8612706e-04f,
-   -1.1812332e-04f,
-   -1.4600798e-04f,
-    6.5593886e-05f,
-    2.1832415e-05f,
-   -2.0228883e-05f,
-    1.3411578e-08f,
-    3.9011003e-06f,
-   -8.9802531e-07f,
-   -4.0325078e-07f,
-    2.1663397e-07f,
-   -5.0576454e-10f,
-   -2.2557404e-08f,
-    5.1577768e-09f,
-    4.7483758e-10f,
-   -4.0246586e-10f,
-    6.9918012e-11f,
-   -4.3427825e-12f },
-
-  // 25 (50)
-  { 1.3480298e-04f,
-    2.2569596e-03f,
-    1.7186741e-02f,
-    7.8035863e-02f,
-    2.3169351e-01f,
-    4.5968342e-01f,
-    5.8163690e-01f,
-    3.6788507e-01f,
-   -9.7174641e-02f,
-   -3.3647308e-01f,
-   -8.7587615e-02f,
-
-    2.2453782e-01f,
-    1.1815529e-01f,
-   -1.5056021e-01f,
-   -9.8508615e-02f,
-    1.0663381e-01f,
-    6.6752164e-02f,
-   -7.7084111e-02f,
-   -3.7173963e-02f,
-    5.3617909e-02f,
-    1.5542606e-02f,
-   -3.4042320e-02f,
-   -3.0798368e-03f,
-    1.8922804e-02f,
-   -1.9894258e-03f,
-   -8.8607026e-03f,
-    2.7269363e-03f,
-    3.3227078e-03f,
-   -1.8424843e-03f,
-   -8.9997742e-04f,
-    8.7725819e-04f,
-    1.1532124e-04f,
-   -3.0988010e-04f,
-    3.5437145e-05f,
-    7.9046400e-05f,
-   -2.7330481e-05f,
-   -1.2771953e-05f,
-    8.9906614e-06f,
-    5.2328277e-07f,
-   -1.7792013e-06f,
-    3.2120375e-07f,
-    1.9228068e-07f,
-   -8.6569417e-08f,
-   -2.6115986e-09f,
-    9.2792245e-09f,
-   -1.8804158e-09f,
-   -2.2284749e-10f,
-    1.5359016e-10f,
-   -2.5276252e-11f,
-    1.5096921e-12f },
-
-  // 26 (52)
-  { 9.4937958e-05f,
-    1.6505202e-03f,
-    1.3097554e-02f,
-    6.2274744e-02f,
-    1.9503944e-01f,
-    4.1329296e-01f,
-    5.7366904e-01f,
-    4.3915831e-01f,
-    1.7740768e-03f,
-   -3.2638459e-01f,
-   -1.7483996e-01f,
-    1.8129183e-01f,
-    1.8275541e-01f,
-   -1.0432390e-01f,
-   -1.4797719e-01f,
-    6.9823186e-02f,
-    1.0648241e-01f,
-   -5.3448562e-02f,
-   -6.8654760e-02f,
-    4.2232186e-02f,
-    3.8535716e-02f,
-   -3.1378110e-02f,
-   -1.7760904e-02f,
-    2.0734920e-02f,
-    5.8295806e-03f,
-   -1.1785498e-02f,
-   -5.2873840e-04f,
-    5.6019472e-03f,
-   -9.3905825e-04f,
-   -2.1455303e-03f,
-    8.3834881e-04f,
-    6.1613822e-04f,
-   -4.3195571e-04f,
-   -1.0605747e-04f,
-    1.5747952e-04f,
-   -5.2777955e-06f,
-   -4.1096740e-05f,
-    1.0742215e-05f,
-    7.0000787e-06f,
-   -3.8874002e-06f,
-   -4.6504632e-07f,
-    7.9392106e-07f,
-   -1.0790042e-07f,
-   -8.9044664e-08f,
-    3.4077956e-08f,
-    2.1693283e-09f,
-   -3.7760105e-09f,
-    6.7800472e-10f,
-    1.0023032e-10f,
-   -5.8404082e-11f,
-    9.1305100e-12f,
-   -5.2518712e-13f },
-
-  // 27 (54)
-  { 6.6871314e-05f,
-    1.2055312e-03f,
-    9.9525888e-03f,
-    4.9452600e-02f,
-    1.6292203e-01f,
-    3.6711021e-01f,
-    5.5384986e-01f,
-    4.9340612e-01f,
-    1.0284086e-01f,
-   -2.8971680e-01f,
-   -2.4826458e-01f,
-    1.1482302e-01f,
-    2.2727329e-01f,
-   -3.8786419e-02f,
-   -1.7803174e-01f,
-    1.5799397e-02f,
-    1.3119797e-01f,
-   -1.4062752e-02f,
-   -9.1022907e-02f,
-    1.7311018e-02f,
-    5.7969406e-02f,
-   -1.8512494e-02f,
-   -3.2739067e-02f,
-    1.6146967e-02f,
-    1.5665596e-02f,
-   -1.1577186e-02f,
-   -5.8620963e-03f,
-    6.8566356e-03f,
-    1.3426269e-03f,
-   -3.3328545e-03f,
-    1.4575296e-04f,
-    1.3011775e-03f,
-   -3.4183512e-04f,
-   -3.8790186e-04f,
-    2.0197199e-04f,
-    7.6600584e-05f,
-   -7.7111455e-05f,
-   -3.5174836e-06f,
-    2.0634426e-05f,
-   -3.9011641e-06f,
-   -3.6575009e-06f,
-    1.6343696e-06f,
-    3.0508807e-07f,
-   -3.4724681e-07f,
-    3.2865590e-08f,
-    4.0262551e-08f,
-   -1.3213323e-08f,
-   -1.3094656e-09f,
-    1.5216150e-09f,
-   -2.4155269e-10f,
-   -4.3749862e-11f,
-    2.2136621e-11f,
-   -3.2957901e-12f,
-    1.8281884e-13f },
-
-  // 28 (56)
-  { 4.7108078e-05f,
-    8.7949852e-04f,
-    7.5426504e-03f,
-    3.9092608e-02f,
-    1.3513791e-01f,
-    3.2256336e-01f,
-    5.2499823e-01f,
-    5.3051629e-01f,
-    2.0017614e-01f,
-   -2.3049895e-01f,
-   -3.0132781e-01f,
-    3.2857879e-02f,
-    2.4580815e-01f,
-    3.6906885e-02f,
-   -1.8287733e-01f,
-   -4.6838234e-02f,
-    1.3462757e-01f,
-    3.4478631e-02f,
-   -9.7685356e-02f,
-   -1.7341923e-02f,
-    6.7747896e-02f,
-    3.4480190e-03f,
-   -4.3333369e-02f,
-    4.4317329e-03f,
-    2.4688060e-02f,
-   -6.8155498e-03f,
-   -1.2063592e-02f,
-    5.8388166e-03f,
-    4.7848631e-03f,
-   -3.7254612e-03f,
-   -1.3603738e-03f,
-    1.8759987e-03f,
-    1.4156724e-04f,
-   -7.4867496e-04f,
-    1.1546561e-04f,
-    2.2957910e-04f,
-   -8.9039015e-05f,
-   -4.9077134e-05f,
-    3.6414012e-05f,
-    4.6386650e-06f,
-   -1.0043260e-05f,
-    1.2479003e-06f,
-    1.8403637e-06f,
-   -6.6702155e-07f,
-   -1.7574612e-07f,
-    1.4906600e-07f,
-   -8.2623873e-09f,
-   -1.7841387e-08f,
-    5.0440471e-09f,
-    6.9445403e-10f,
-   -6.0770412e-10f,
-    8.4922200e-11f,
-    1.8673673e-11f,
-   -8.3654905e-12f,
-    1.1888505e-12f,
-   -6.3677724e-14f },
-
-  // 29 (58)
-  { 3.3189663e-05f,
-    6.4095168e-04f,
-    5.7021265e-03f,
-    3.0773580e-02f,
-    1.1137012e-01f,
-    2.8065346e-01f,
-    4.8975880e-01f,
-    5.5137443e-01f,
-    2.8910524e-01f,
-   -1.5402873e-01f,
-   -3.3004095e-01f,
-   -5.5706800e-02f,
-    2.3610524e-01f,
-    1.1241917e-01f,
-   -1.6087799e-01f,
-   -1.0784595e-01f,
-    1.1447230e-01f,
-    8.3220747e-02f,
-   -8.5125493e-02f,
-   -5.5027490e-02f,
-    6.3479165e-02f,
-    3.0531543e-02f,
-   -4.5187981e-02f,
-   -1.2917143e-02f,
-    2.9470432e-02f,
-    2.6483273e-03f,
-   -1.7041225e-02f,
-    1.7378803e-03f,
-    8.4697255e-03f,
-   -2.5508071e-03f,
-   -3.4737990e-03f,
-    1.8771209e-03f,
-    1.0870539e-03f,
-   -1.0007783e-03f,
-   -2.0007114e-04f,
-    4.1112835e-04f,
-   -2.2920180e-05f,
-   -1.2930448e-04f,
-    3.6450261e-05f,
-    2.9133448e-05f,
-   -1.6573284e-05f,
-   -3.5936448e-06f,
-    4.7506092e-06f,
-   -3.0290546e-07f,
-   -8.9757018e-07f,
-    2.6338984e-07f,
-    9.3871974e-08f,
-   -6.2861569e-08f,
-    1.0765919e-09f,
-    7.7689789e-09f,
-   -1.8939954e-09f,
-   -3.4268009e-10f,
-    2.4070995e-10f,
-   -2.9405893e-11f,
-   -7.8325097e-12f,
-    3.1527624e-12f,
-   -4.2856549e-13f,
-    2.2191913e-14f },
-
-  // 30 (60)
-  { 2.3386162e-05f,
-    4.6663795e-04f,
-    4.3007972e-03f,
-    2.4130833e-02f,
-    9.1238304e-02f,
-    2.4202067e-01f,
-    4.5048782e-01f,
-    5.5757223e-01f,
-    3.6624268e-01f,
-   -6.6183671e-02f,
-   -3.3296698e-01f,
-   -1.4196851e-01f,
-    1.9946212e-01f,
-    1.7782987e-01f,
-   -1.1455822e-01f,
-   -1.5723682e-01f,
-    7.2778659e-02f,
-    1.2274775e-01f,
-   -5.3806465e-02f,
-   -8.7658690e-02f,
-    4.3801665e-02f,
-    5.6712366e-02f,
-   -3.5673397e-02f,
-   -3.2263759e-02f,
-    2.7078620e-02f,
-    1.5287961e-02f,
-   -1.8399744e-02f,
-   -5.2968597e-03f,
-    1.0915632e-02f,
-    6.1967176e-04f,
-   -5.5307301e-03f,
-    8.4338459e-04f,
-    2.3245201e-03f,
-   -8.6092770e-04f,
-   -7.6787825e-04f,
-    5.0509482e-04f,
-    1.7248258e-04f,
-   -2.1617183e-04f,
-   -8.5483055e-06f,
-    6.9820084e-05f,
-   -1.3397169e-05f,
-   -1.6361525e-05f,
-    7.2521455e-06f,
-    2.3275491e-06f,
-   -2.1872677e-06f,
-    1.0994743e-08f,
-    4.2616623e-07f,
-   -1.0004147e-07f,
-   -4.7643800e-08f,
-    2.6054428e-08f,
-    5.5533979e-10f,
-   -3.3311057e-09f,
-    6.9848627e-10f,
-    1.6136230e-10f,
-   -9.4613880e-11f,
-    1.0001051e-11f,
-    3.2394286e-12f,
-   -1.1852376e-12f,
-    1.5439976e-13f,
-   -7.7379426e-15f },
-
-  // 31 (62)
-  { 1.6480134e-05f,
-    3.3941220e-04f,
-    3.2368841e-03f,
-    1.8853692e-02f,
-    7.4336093e-02f,
-    2.0701287e-01f,
-    4.0919220e-01f,
-    5.5113984e-01f,
-    4.2946881e-01f,
-    2.7169212e-02f,
-   -3.1095512e-01f,
-   -2.1797849e-01f,
-    1.4017829e-01f,
-    2.2496671e-01f,
-   -4.9926349e-02f,
-   -1.8696236e-01f,
-    1.5436988e-02f,
-    1.4508950e-01f,
-   -8.1398323e-03f,
-   -1.0761277e-01f,
-    1.0941297e-02f,
-    7.5353612e-02f,
-   -1.4880027e-02f,
-   -4.8619075e-02f,
-    1.6154172e-02f,
-    2.8047619e-02f,
-   -1.4276275e-02f,
-   -1.3900553e-02f,
-    1.0517639e-02f,
-    5.5161636e-03f,
-   -6.5208524e-03f,
-   -1.4282642e-03f,
-    3.3930668e-03f,
-   -6.3979011e-05f,
-   -1.4590417e-03f,
-    3.4313983e-04f,
-    4.9988162e-04f,
-   -2.3965835e-04f,
-   -1.2434116e-04f,
-    1.0895844e-04f,
-    1.5013357e-05f,
-   -3.6312552e-05f,
-    4.0345202e-06f,
-    8.7953013e-06f,
-   -3.0351424e-06f,
-   -1.3690602e-06f,
-    9.8100154e-07f,
-    5.3272507e-08f,
-   -1.9759251e-07f,
-    3.6168265e-08f,
-    2.3283097e-08f,
-   -1.0615296e-08f,
-   -6.4743117e-10f,
-    1.4085682e-09f,
-   -2.5240440e-10f,
-   -7.3489300e-11f,
-    3.6921088e-11f,
-   -3.3270090e-12f,
-   -1.3243349e-12f,
-    4.4454671e-13f,
-   -5.5594421e-14f,
-    2.6993829e-15f },
-
-  // 32 (64)
-  { 1.1614633e-05f,
-    2.4665669e-04f,
-    2.4312619e-03f,
-    1.4681046e-02f,
-    6.0257499e-02f,
-    1.7575078e-01f,
-    3.6750963e-01f,
-    5.3431792e-01f,
-    4.7780916e-01f,
-    1.2063054e-01f,
-   -2.6669818e-01f,
-   -2.7742158e-01f,
-    6.4713355e-02f,
-    2.4831064e-01f,
-    2.4662445e-02f,
-   -1.9210234e-01f,
-   -4.8995117e-02f,
-    1.4523208e-01f,
-    4.4404908e-02f,
-   -1.0945611e-01f,
-   -2.9627873e-02f,
-    8.0874141e-02f,
-    1.4106152e-02f,
-   -5.6926314e-02f,
-   -2.3802645e-03f,
-    3.7051458e-02f,
-   -4.1459077e-03f,
-   -2.1662823e-02f,
-    6.1675273e-03f,
-    1.1017401e-02f,
-   -5.4115683e-03f,
-   -4.6492168e-03f,
-    3.6272246e-03f,
-    1.4689551e-03f,
-   -1.9647406e-03f,
-   -2.2116787e-04f,
-    8.6730585e-04f,
-   -1.0245373e-04f,
-   -3.0596544e-04f,
-    1.0539155e-04f,
-    8.1036783e-05f,
-   -5.2598093e-05f,
-   -1.2940458e-05f,
-    1.8242684e-05f,
-   -6.3617815e-07f,
-   -4.5583096e-06f,
-    1.2028890e-06f,
-    7.5600476e-07f,
-   -4.2859707e-07f,
-   -5.0033619e-08f,
-    8.9659663e-08f,
-   -1.2199244e-08f,
-   -1.1043830e-08f,
-    4.2504223e-09f,
-    4.3843878e-10f,
-   -5.8810915e-10f,
-    8.9047238e-11f,
-    3.2632707e-11f,
-   -1.4309188e-11f,
-    1.0756107e-12f,
-    5.3614822e-13f,
-   -1.6638005e-13f,
-    2.0007153e-14f,
-   -9.4210191e-16f },
-
-  // 33 (66)
-  { 8.1863583e-06f,
-    1.7910162e-04f,
-    1.8227094e-03f,
-    1.1395943e-02f,
-    4.8614667e-02f,
-    1.4818631e-01f,
-    3.2671813e-01f,
-    5.0937617e-01f,
-    5.1125477e-01f,
-    2.0958235e-01f,
-   -2.0420262e-01f,
-   -3.1599741e-01f,
-   -1.9278339e-02f,
-    2.4542061e-01f,
-    9.9851559e-02f,
-   -1.7142810e-01f,
-   -1.1084413e-01f,
-    1.2196786e-01f,
-    9.4788088e-02f,
-   -9.1146968e-02f,
-   -7.0302485e-02f,
-    7.0191144e-02f,
-    4.5734562e-02f,
-   -5.3471251e-02f,
-   -2.5248583e-02f,
-    3.8687061e-02f,
-    1.0703266e-02f,
-   -2.5728762e-02f,
-   -2.1677586e-03f,
-    1.5316954e-02f,
-   -1.5942888e-03f,
-   -7.9535404e-03f,
-    2.3890624e-03f,
-    3.4808010e-03f,
-   -1.8607182e-03f,
-   -1.2043093e-03f,
-    1.0743807e-03f,
-    2.7273058e-04f,
-   -4.9083290e-04f,
-    4.3931663e-06f,
-    1.7804319e-04f,
-   -4.1604385e-05f,
-   -4.9295644e-05f,
-    2.4233354e-05f,
-    9.0708058e-06f,
-   -8.8661214e-06f,
-   -3.6075161e-07f,
-    2.2883713e-06f,
-   -4.4269234e-07f,
-   -3.9857913e-07f,
-    1.8224433e-07f,
-    3.3779727e-08f,
-   -3.9878382e-08f,
-    3.6728636e-09f,
-    5.1112119e-09f,
-   -1.6713927e-09f,
-   -2.4964021e-10f,
-    2.4268331e-10f,
-   -3.0495745e-11f,
-   -1.4202369e-11f,
-    5.5094147e-12f,
-   -3.3434812e-13f,
-   -2.1524884e-13f,
-    6.2147402e-14f,
-   -7.1965105e-15f,
-    3.2893737e-16f },
-
-  // 34 (68)
-  { 5.7705106e-06f,
-    1.2994762e-04f,
-    1.3640614e-03f,
-    8.8198894e-03f,
-    3.9048841e-02f,
-    1.2415248e-01f,
-    2.8776506e-01f,
-    4.7847875e-01f,
-    5.3055510e-01f,
-    2.9036633e-01f,
-   -1.2824684e-01f,
-   -3.3152530e-01f,
-   -1.0389192e-01f,
-    2.1690722e-01f,
-    1.6660175e-01f,
-   -1.2733736e-01f,
-   -1.6092493e-01f,
-    7.7991847e-02f,
-    1.3412596e-01f,
-   -5.4482968e-02f,
-   -1.0294760e-01f,
-    4.3576095e-02f,
-    7.3185235e-02f,
-   -3.7012838e-02f,
-   -4.7438560e-02f,
-    3.0739747e-02f,
-    2.7228351e-02f,
-   -2.3671738e-02f,
-   -1.3143980e-02f,
-    1.6409374e-02f,
-    4.7136493e-03f,
-   -1.0045507e-02f,
-   -6.1947488e-04f,
-    5.3349508e-03f,
-   -7.6921280e-04f,
-   -2.3994539e-03f,
-    8.5899599e-04f,
-    8.7519991e-04f,
-   -5.5273558e-04f,
-   -2.3267321e-04f,
-    2.6507724e-04f,
-    2.6600500e-05f,
-   -9.9146978e-05f,
-    1.3531172e-05f,
-    2.8449514e-05f,
-   -1.0576575e-05f,
-   -5.7108265e-06f,
-    4.1698718e-06f,
-    4.9797181e-07f,
-   -1.1163065e-06f,
-    1.4481957e-07f,
-    2.0259907e-07f,
-   -7.5267017e-08f,
-   -1.9903465e-08f,
-    1.7404233e-08f,
-   -8.6657443e-10f,
-   -2.3165019e-09f,
-    6.4463782e-10f,
-    1.3004103e-10f,
-   -9.9047745e-11f,
-    1.0042087e-11f,
-    6.0801254e-12f,
-   -2.1078791e-12f,
-    9.7994512e-14f,
-    8.5791941e-14f,
-   -2.3170837e-14f,
-    2.5873384e-15f,
-   -1.1489448e-16f },
-
-  // 35 (70)
-  { 4.0679341e-06f,
-    9.4214695e-05f,
-    1.0191227e-03f,
-    6.8072929e-03f,
-    3.1236289e-02f,
-    1.0340446e-01f,
-    2.5130738e-01f,
-    4.4359274e-01f,
-    5.3700843e-01f,
-    3.6034564e-01f,
-   -4.3883882e-02f,
-   -3.2382286e-01f,
-   -1.8178698e-01f,
-    1.6604136e-01f,
-    2.1729929e-01f,
-   -6.5262871e-02f,
-   -1.9191959e-01f,
-    1.9309545e-02f,
-    1.5529248e-01f,
-   -4.7526808e-03f,
-   -1.2058552e-01f,
-    4.7342292e-03f,
-    8.9913548e-02f,
-   -9.3185589e-03f,
-   -6.3356037e-02f,
-    1.3228550e-02f,
-    4.1254693e-02f,
-   -1.4366840e-02f,
-   -2.4169498e-02f,
-    1.2766457e-02f,
-    1.2289436e-02f,
-   -9.5777979e-03f,
-   -5.0859916e-03f,
-    6.1377546e-03f,
-    1.4280888e-03f,
-   -3.3576444e-03f,
-    7.6159694e-06f,
-    1.5496375e-03f,
-   -3.3466922e-04f,
-   -5.8648103e-04f,
-    2.6483288e-04f,
-    1.7000123e-04f,
-   -1.3658831e-04f,
-   -2.9769960e-05f,
-    5.3041431e-05f,
-   -2.4370015e-06f,
-   -1.5724421e-05f,
-    4.3080479e-06f,
-    3.3533459e-06f,
-   -1.8959296e-06f,
-   -3.9039317e-07f,
-    5.3023686e-07f,
-   -3.7003084e-08f,
-   -9.9903969e-08f,
-    3.0081887e-08f,
-    1.0849027e-08f,
-   -7.4581166e-09f,
-    5.8979513e-11f,
-    1.0308233e-09f,
-   -2.4335456e-10f,
-   -6.4079383e-11f,
-    4.0005366e-11f,
-   -3.1256394e-12f,
-   -2.5670655e-12f,
-    8.0150885e-13f,
-   -2.5979543e-14f,
-   -3.3977209e-14f,
-    8.6240374e-15f,
-   -9.2980125e-16f,
-    4.0146287e-17f },
-
-  // 36 (72)
-  { 2.8679252e-06f,
-    6.8260287e-05f,
-    7.6021511e-04f,
-    5.2402974e-03f,
-    2.4890566e-02f,
-    8.5652093e-02f,
-    2.1775695e-01f,
-    4.0643370e-01f,
-    5.3226690e-01f,
-    4.1787534e-01f,
-    4.3975198e-02f,
-   -2.9442104e-01f,
-   -2.4680704e-01f,
-    9.8114204e-02f,
-    2.4653728e-01f,
-    7.2785151e-03f,
-   -1.9933721e-01f,
-   -4.5861401e-02f,
-    1.5410624e-01f,
-    5.0276180e-02f,
-   -1.1880375e-01f,
-   -3.9880854e-02f,
-    9.1156782e-02f,
-    2.5038721e-02f,
-   -6.8209017e-02f,
-   -1.1319100e-02f,
-    4.8513084e-02f,
-    1.4249727e-03f,
-   -3.1980721e-02f,
-    3.9840402e-03f,
-    1.9063595e-02f,
-   -5.6578132e-03f,
-   -9.9902635e-03f,
-    5.0229891e-03f,
-    4.4134848e-03f,
-   -3.4845414e-03f,
-   -1.5030741e-03f,
-    1.9907938e-03f,
-    2.7768128e-04f,
-   -9.4634038e-04f,
-    8.6145658e-05f,
-    3.6935073e-04f,
-   -1.1551189e-04f,
-   -1.1318995e-04f,
-    6.6947412e-05f,
-    2.3751067e-05f,
-   -2.7313908e-05f,
-   -1.1834711e-06f,
-    8.3722182e-06f,
-   -1.5861458e-06f,
-   -1.8708116e-06f,
-    8.3114213e-07f,
-    2.5484235e-07f,
-   -2.4553777e-07f,
-    2.7532491e-09f,
-    4.7990435e-08f,
-   -1.1560937e-08f,
-   -5.6127843e-09f,
-    3.1388417e-09f,
-    1.0908156e-10f,
-   -4.5125458e-10f,
-    8.9624182e-11f,
-    3.0374291e-11f,
-   -1.5997167e-11f,
-    8.8768463e-13f,
-    1.0709694e-12f,
-   -3.0292850e-13f,
-    5.5422632e-15f,
-    1.3380714e-14f,
-   -3.2046285e-15f,
-    3.3399720e-16f,
-   -1.4032742e-17f },
-
-  // 37 (74)
-  { 2.0220609e-06f,
-    4.9423438e-05f,
-    5.6624184e-04f,
-    4.0241404e-03f,
-    1.9762286e-02f,
-    7.0584826e-02f,
-    1.8732633e-01f,
-    3.6844097e-01f,
-    5.1816704e-01f,
-    4.6220755e-01f,
-    1.3087896e-01f,
-   -2.4618043e-01f,
-   -2.9437592e-01f,
-    1.9671500e-02f,
-    2.5152325e-01f,
-    8.1806028e-02f,
-   -1.8196229e-01f,
-   -1.0845171e-01f,
-    1.2992965e-01f,
-    1.0178030e-01f,
-   -9.6607541e-02f,
-   -8.2330212e-02f,
-    7.5047620e-02f,
-    5.9567411e-02f,
-   -5.9256816e-02f,
-   -3.8253829e-02f,
-    4.5807944e-02f,
-    2.0972801e-02f,
-   -3.3523584e-02f,
-   -8.8334939e-03f,
-    2.2618652e-02f,
-    1.6904724e-03f,
-   -1.3763982e-02f,
-    1.5193058e-03f,
-    7.3877575e-03f,
-   -2.2480532e-03f,
-   -3.3945233e-03f,
-    1.8168713e-03f,
-    1.2639343e-03f,
-   -1.1114849e-03f,
-   -3.2807885e-04f,
-    5.4905328e-04f,
-    1.5344390e-05f,
-   -2.2089440e-04f,
-    4.3367261e-05f,
-    7.0551388e-05f,
-   -3.0986629e-05f,
-   -1.6391625e-05f,
-    1.3543277e-05f,
-    1.8499450e-06f,
-   -4.3099416e-06f,
-    4.8547314e-07f,
-    1.0021214e-06f,
-   -3.4949486e-07f,
-   -1.5098854e-07f,
-    1.1090312e-07f,
-    5.3506575e-09f,
-   -2.2521938e-08f,
-    4.2244857e-09f,
-    2.7939745e-09f,
-   -1.2972050e-09f,
-   -1.0314111e-10f,
-    1.9461649e-10f,
-   -3.2033982e-11f,
-   -1.3984157e-11f,
-    6.3349554e-12f,
-   -2.0963632e-13f,
-   -4.4216124e-13f,
-    1.1380528e-13f,
-   -4.5188896e-16f,
-   -5.2430257e-15f,
-    1.1890124e-15f,
-   -1.1992803e-16f,
-    4.9066151e-18f },
-
-  // 38 (76)
-  { 1.4257766e-06f,
-    3.5762520e-05f,
-    4.2117027e-04f,
-    3.0830881e-03f,
-    1.5637249e-02f,
-    5.7889944e-02f,
-    1.6007199e-01f,
-    3.3077578e-01f,
-    4.9659118e-01f,
-    4.9335608e-01f,
-    2.1305057e-01f,
-   -1.8286767e-01f,
-   -3.2167564e-01f,
-   -6.2266506e-02f,
-    2.3212596e-01f,
-    1.4998512e-01f,
-   -1.4179569e-01f,
-   -1.5991257e-01f,
-    8.5638122e-02f,
-    1.4141473e-01f,
-   -5.6586459e-02f,
-   -1.1473117e-01f,
-    4.3095895e-02f,
-    8.7204398e-02f,
-   -3.6605103e-02f,
-   -6.1766209e-02f,
-    3.1989878e-02f,
-    4.0054981e-02f,
-   -2.6891494e-02f,
-   -2.3114134e-02f,
-    2.0904645e-02f,
-    1.1290497e-02f,
-   -1.4701882e-02f,
-   -4.1313067e-03f,
-    9.2147850e-03f,
-    5.6257157e-04f,
-   -5.0713145e-03f,
-    7.1698218e-04f,
-    2.4006978e-03f,
-   -8.4486267e-04f,
-   -9.4246141e-04f,
-    5.8107598e-04f,
-    2.8176393e-04f,
-   -3.0310205e-04f,
-   -4.5556827e-05f,
-    1.2620434e-04f,
-   -1.1554091e-05f,
-   -4.1751416e-05f,
-    1.3341761e-05f,
-    1.0373592e-05f,
-   -6.4567304e-06f,
-   -1.5508444e-06f,
-    2.1499603e-06f,
-   -8.4870876e-08f,
-   -5.1877337e-07f,
-    1.3963775e-07f,
-    8.4003510e-08f,
-   -4.8847579e-08f,
-   -5.4242748e-09f,
-    1.0347045e-08f,
-   -1.4363295e-09f,
-   -1.3491978e-09f,
-    5.2611326e-10f,
-    6.7323365e-11f,
-   -8.2782565e-11f,
-    1.1016929e-11f,
-    6.2915373e-12f,
-   -2.4847892e-12f,
-    2.6264965e-14f,
-    1.8086612e-13f,
-   -4.2498178e-14f,
-   -4.5633972e-16f,
-    2.0450997e-15f,
-   -4.4053070e-16f,
-    4.3045968e-17f,
-   -1.7161525e-18f }
+#endif
 };
@@ -160,7 +160,19 @@
 #error This file should not be included directly into mid level code
 #endif
 
-extern const double kDaubechiesD[38][76];
-extern const float  kDaubechiesF[38][76];
+#ifndef WAVELET_MAX_ORDER
+#define WAVELET_MAX_ORDER 76
+#endif
+#if WAVELET_MAX_ORDER < 6 || WAVELET_MAX_ORDER % 2 != 0
+#error WAVELET_MAX_ORDER must be an even number not less than 6
+#endif
+
+#define WAVELET_DAUBECHIES_ROWS \
+    (WAVELET_MAX_ORDER > 76 ? 38 : WAVELET_MAX_ORDER / 2)
+#define WAVELET_DAUBECHIES_COLS \
+    (WAVELET_MAX_ORDER > 76 ? 76 : WAVELET_MAX_ORDER)
+
+extern const double kDaubechiesD[WAVELET_DAUBECHIES_ROWS]
+                                [WAVELET_DAUBECHIES_COLS];
 
 #endif  // SRC_DAUBECHIES_H_
@@ -12,35 +12,80 @@
 
 #include "inc/simd/detect_peaks.h"
 #include <assert.h>
+#include <float.h>
 #include <limits.h>
 #include <stdlib.h>
 #include <simd/instruction_set.h>
 
-INLINE void append_peak(int position, float value, int index,
-                        ExtremumPoint **results, size_t *allocatedSize) {
-  int alloc_size = *allocatedSize;
-  if (alloc_size > index) {
-    (*results)[index] = (ExtremumPoint) { .position = position,
-                                          .value = value };
-    return;
+/// @brief The destination of the found extrema: either an array grown with
+/// realloc() (owned != 0) or a fixed caller-provided one, plus the output
+/// filters of detect_peaks_filtered() (disabled for the plain entry points).
+typedef struct {
+  ExtremumPoint *results;
+  size_t length;
+  size_t capacity;
+  int owned;
+  int overflowed;
+  ExtremumType out_type;
+  float min_value;
+  float min_prominence;
+  float last_max;
+  float last_min;
+  int offset;
+} PeaksBuffer;
+
+INLINE void append_peak(PeaksBuffer *buffer, int position, float value) {
+  if (buffer->length >= buffer->capacity) {
+    if (!buffer->owned) {
+      buffer->overflowed = 1;
+      return;
+    }
+    size_t capacity = buffer->capacity;
+    if (capacity == 0) {
+      capacity = 2;
+    } else if (capacity < (INT_MAX >> 1)) {
+      capacity <<= 1;
+    } else {
+      // No more place. This is weird anyway.
+      return;
+    }
+    buffer->capacity = capacity;
+    buffer->results = realloc(buffer->results,
+                              capacity * sizeof(buffer->results[0]));
   }
-  if (alloc_size == 0) {
-    alloc_size = 2;
-  } else if (alloc_size < (INT_MAX >> 1)) {
-    alloc_size <<= 1;
+  buffer->results[buffer->length++] =
+      (ExtremumPoint) { .position = position + buffer->offset,
+                        .value = value };
+}
+
+/// @brief Applies the output filters to a raw extremum and stores it if it
+/// passes. The prominence state is fed by every raw extremum, reported or not.
+INLINE void emit_peak(PeaksBuffer *buffer, int position, float value,
+                      int isMaximum) {
+  float prominence;
+  if (isMaximum) {
+    prominence = value - buffer->last_min;
+    buffer->last_max = value;
+    if ((buffer->out_type & kExtremumTypeMaximum) == 0 ||
+        value < buffer->min_value) {
+      return;
+    }
   } else {
-    // No more place. This is weird anyway.
+    prominence = buffer->last_max - value;
+    buffer->last_min = value;
+    if ((buffer->out_type & kExtremumTypeMinimum) == 0 ||
+        value > -buffer->min_value) {
+      return;
+    }
+  }
+  if (buffer->min_prominence > 0 && prominence < buffer->min_prominence) {
     return;
   }
-  *allocatedSize = alloc_size;
-  *results = realloc(*results, alloc_size * sizeof((*results)[0]));
-  (*results)[index] = (ExtremumPoint) { .position = position,
-                                          .value = value };
+  append_peak(buffer, position, value);
 }
 
 INLINE void check_peak(const float *data, int index, ExtremumType type,
-                       ExtremumPoint **results, size_t *resultsLength,
-                       size_t *allocatedSize) {
+                       PeaksBuffer *buffer) {
   float prev = data[index - 1];
   float curr = data[index];
   float next = data[index + 1];
@@ -49,22 +94,19 @@ INLINE void check_peak(const float *data, int index, ExtremumType type,
   if (delta1 * delta2 > 0) {
     if ((delta1 > 0 && (type & kExtremumTypeMaximum) != 0) ||
         (delta1 < 0 && (type & kExtremumTypeMinimum) != 0)) {
-      append_peak(index, curr, *resultsLength, results, allocatedSize);
-      (*resultsLength)++;
+      emit_peak(buffer, index, curr, delta1 > 0);
     }
   }
 }
 
-void detect_peaks(int simd, const float *data, size_t size, ExtremumType type,
-                  ExtremumPoint **results, size_t *resultsLength) {
-  assert(data);
-  assert(results);
-  assert(resultsLength);
-  assert(size > 2);
-  *resultsLength = 0;
-  *results = NULL;
-  size_t allocated_size = 0;
+static void detect_peaks_scan(int simd, const float *data, size_t size,
+                              ExtremumType type, PeaksBuffer *buffer) {
   int isize = (int)size;
+  // The amplitude threshold may be folded into the SIMD masks only while
+  // the prominence state does not have to see the screened-out extrema
+  int foldAmplitude = buffer->min_prominence <= 0 &&
+      buffer->min_value > -FLT_MAX;
+  (void)foldAmplitude;
 
   if (simd) {
 #ifdef __ARM_NEON__
@@ -82,46 +124,221 @@ void detect_peaks(int simd, const float *data, size_t size, ExtremumType type,
       }
       if (vgetq_lane_u64(cmpvec2_64, 0) == 0x1FFFFFFFE &&
           vgetq_lane_u64(cmpvec2_64, 1) == 0x1FFFFFFFE) {
-        check_peak(data, i + 4, type, results, resultsLength, &allocated_size);
+        check_peak(data, i + 4, type, buffer);
         continue;
       }
       for (int j = i + 1; j < i + 5; j++) {
-        check_peak(data, j, type, results, resultsLength, &allocated_size);
+        check_peak(data, j, type, buffer);
       }
     }
     for (int i = (isize - 1) & ~0x3; i < isize - 1; i++) {
-      check_peak(data, i, type, results, resultsLength, &allocated_size);
+      check_peak(data, i, type, buffer);
+    }
+  } else {
+#elif defined(__AVX512F__)
+    // The peak predicate is evaluated for 16 candidates at once; the
+    // positions and values of the matching ones are then emitted in bulk
+    // with compress stores, so dense peak regions do not serialize into
+    // a per-element scan.
+    const __m512i laneIndex = _mm512_set_epi32(15, 14, 13, 12, 11, 10, 9, 8,
+                                               7, 6, 5, 4, 3, 2, 1, 0);
+    int i = 0;
+    for (; i < isize - 17; i += 16) {
+      __m512 prev = _mm512_loadu_ps(data + i);
+      __m512 curr = _mm512_loadu_ps(data + i + 1);
+      __m512 next = _mm512_loadu_ps(data + i + 2);
+      __m512 delta1 = _mm512_sub_ps(curr, prev);
+      __m512 delta2 = _mm512_sub_ps(curr, next);
+      __mmask16 mask = _mm512_cmp_ps_mask(
+          _mm512_mul_ps(delta1, delta2), _mm512_setzero_ps(), _CMP_GT_OQ);
+      __mmask16 typeMask = 0;
+      if ((type & kExtremumTypeMaximum) != 0) {
+        __mmask16 maxMask = _mm512_cmp_ps_mask(delta1, _mm512_setzero_ps(),
+                                               _CMP_GT_OQ);
+        if (foldAmplitude) {
+          maxMask &= _mm512_cmp_ps_mask(
+              curr, _mm512_set1_ps(buffer->min_value), _CMP_GE_OQ);
+        }
+        typeMask = maxMask;
+      }
+      if ((type & kExtremumTypeMinimum) != 0) {
+        __mmask16 minMask = _mm512_cmp_ps_mask(delta1, _mm512_setzero_ps(),
+                                               _CMP_LT_OQ);
+        if (foldAmplitude) {
+          minMask &= _mm512_cmp_ps_mask(
+              curr, _mm512_set1_ps(-buffer->min_value), _CMP_LE_OQ);
+        }
+        typeMask |= minMask;
+      }
+      mask &= typeMask;
+      if (mask) {
+        int positions[16];
+        float values[16];
+        _mm512_storeu_si512(positions, _mm512_maskz_compress_epi32(
+            mask, _mm512_add_epi32(laneIndex, _mm512_set1_epi32(i + 1))));
+        _mm512_storeu_ps(values, _mm512_maskz_compress_ps(mask, curr));
+        int count = __builtin_popcount(mask);
+        for (int k = 0; k < count; k++) {
+          emit_peak(buffer, positions[k], values[k],
+                    values[k] > data[positions[k] - 1]);
+        }
+      }
+    }
+    for (i++; i < isize - 1; i++) {
+      check_peak(data, i, type, buffer);
     }
   } else {
 #elif defined(__AVX__)
-    for (int i = 0; i < isize - 8; i += 8) {
-      __m256 vec1 = _mm256_loadu_ps(data + i);
-      __m256 vec2 = _mm256_loadu_ps(data + i + 1);
-      __m256 max = _mm256_max_ps(vec1, vec2);
-      __m256 cmpvec = _mm256_cmp_ps(max, vec1, _CMP_EQ_UQ);
-      int cmpres = _mm256_movemask_ps(cmpvec);
-      if (cmpres == 0xFF) {
-        continue;
+    // The peak predicate is evaluated for 8 candidates at once; the
+    // matching lanes are then extracted from the movemask bit by bit, so
+    // dense peak regions do not serialize into a per-element scan
+    int i = 0;
+    for (; i < isize - 9; i += 8) {
+      __m256 prev = _mm256_loadu_ps(data + i);
+      __m256 curr = _mm256_loadu_ps(data + i + 1);
+      __m256 next = _mm256_loadu_ps(data + i + 2);
+      __m256 delta1 = _mm256_sub_ps(curr, prev);
+      __m256 delta2 = _mm256_sub_ps(curr, next);
+      __m256 cmpvec = _mm256_cmp_ps(_mm256_mul_ps(delta1, delta2),
+                                    _mm256_setzero_ps(), _CMP_GT_OQ);
+      __m256 typevec = _mm256_setzero_ps();
+      if ((type & kExtremumTypeMaximum) != 0) {
+        __m256 maxvec = _mm256_cmp_ps(delta1, _mm256_setzero_ps(),
+                                      _CMP_GT_OQ);
+        if (foldAmplitude) {
+          maxvec = _mm256_and_ps(maxvec, _mm256_cmp_ps(
+              curr, _mm256_set1_ps(buffer->min_value), _CMP_GE_OQ));
+        }
+        typevec = maxvec;
       }
-      cmpvec = _mm256_cmp_ps(max, vec2, _CMP_EQ_UQ);
-      cmpres = _mm256_movemask_ps(cmpvec);
-      if (cmpres == 0xFF) {
-        check_peak(data, i + 8, type, results, resultsLength, &allocated_size);
-        continue;
+      if ((type & kExtremumTypeMinimum) != 0) {
+        __m256 minvec = _mm256_cmp_ps(delta1, _mm256_setzero_ps(),
+                                      _CMP_LT_OQ);
+        if (foldAmplitude) {
+          minvec = _mm256_and_ps(minvec, _mm256_cmp_ps(
+              curr, _mm256_set1_ps(-buffer->min_value), _CMP_LE_OQ));
+        }
+        typevec = _mm256_or_ps(typevec, minvec);
       }
-      for (int j = i + 1; j < i + 9; j++) {
-        check_peak(data, j, type, results, resultsLength, &allocated_size);
+      int mask = _mm256_movemask_ps(_mm256_and_ps(cmpvec, typevec));
+      while (mask) {
+        int lane = __builtin_ctz(mask);
+        mask &= mask - 1;
+        emit_peak(buffer, i + 1 + lane, data[i + 1 + lane],
+                  data[i + 1 + lane] > data[i + lane]);
       }
     }
-    for (int i = (isize - 1) & ~0x7; i < isize - 1; i++) {
-      check_peak(data, i, type, results, resultsLength, &allocated_size);
+    for (i++; i < isize - 1; i++) {
+      check_peak(data, i, type, buffer);
     }
   } else {
 #else
   } {
 #endif
     for (int i = 1; i < isize - 1; i++) {
-      check_peak(data, i, type, results, resultsLength, &allocated_size);
+      check_peak(data, i, type, buffer);
     }
   }
 }
+
+void detect_peaks(int simd, const float *data, size_t size, ExtremumType type,
+                  ExtremumPoint **results, size_t *resultsLength) {
+  assert(data);
+  assert(results);
+  assert(resultsLength);
+  assert(size > 2);
+  PeaksBuffer buffer = { .results = NULL, .length = 0, .capacity = 0,
+                         .owned = 1, .overflowed = 0, .out_type = type,
+                         .min_value = -FLT_MAX, .min_prominence = 0,
+                         .last_max = data[0], .last_min = data[0] };
+  detect_peaks_scan(simd, data, size, type, &buffer);
+  *results = buffer.results;
+  *resultsLength = buffer.length;
+}
+
+void detect_peaks_filtered(int simd, const float *data, size_t size,
+                           ExtremumType type, float min_value,
+                           float min_prominence,
+                           ExtremumPoint **results, size_t *resultsLength) {
+  assert(data);
+  assert(results);
+  assert(resultsLength);
+  assert(size > 2);
+  PeaksBuffer buffer = { .results = NULL, .length = 0, .capacity = 0,
+                         .owned = 1, .overflowed = 0, .out_type = type,
+                         .min_value = min_value,
+                         .min_prominence = min_prominence,
+                         .last_max = data[0], .last_min = data[0] };
+  // The prominence of an extremum is measured against the preceding raw
+  // extremum of the opposite kind, so with prominence filtering the scan
+  // must see both kinds regardless of the requested output type
+  ExtremumType scan_type = min_prominence > 0? kExtremumTypeBoth : type;
+  detect_peaks_scan(simd, data, size, scan_type, &buffer);
+  *results = buffer.results;
+  *resultsLength = buffer.length;
+}
+
+int detect_peaks_prealloc(int simd, const float *data, size_t size,
+                          ExtremumType type, ExtremumPoint *results,
+                          size_t capacity, size_t *resultsLength) {
+  assert(data);
+  assert(results);
+  assert(resultsLength);
+  assert(size > 2);
+  assert(capacity > 0);
+  PeaksBuffer buffer = { .results = results, .length = 0,
+                         .capacity = capacity, .owned = 0, .overflowed = 0,
+                         .out_type = type, .min_value = -FLT_MAX,
+                         .min_prominence = 0,
+                         .last_max = data[0], .last_min = data[0] };
+  detect_peaks_scan(simd, data, size, type, &buffer);
+  *resultsLength = buffer.length;
+  return !buffer.overflowed;
+}
+
+void detect_peaks_stream_initialize(PeakDetectionStream *stream,
+                                    ExtremumType type) {
+  assert(stream);
+  stream->type = type;
+  stream->position = 0;
+}
+
+void detect_peaks_stream_feed(int simd, PeakDetectionStream *stream,
+                              const float *data, size_t size,
+                              ExtremumPoint **results,
+                              size_t *resultsLength) {
+  assert(stream);
+  assert(data);
+  assert(results);
+  assert(resultsLength);
+  assert(size >= 2);
+
+  PeaksBuffer buffer = { .results = NULL, .length = 0, .capacity = 0,
+                         .owned = 1, .overflowed = 0,
+                         .out_type = stream->type, .min_value = -FLT_MAX,
+                         .min_prominence = 0,
+                         .last_max = data[0], .last_min = data[0] };
+
+  if (stream->position >= 2) {
+    // The two carried samples stitch the chunks together, so the extrema
+    // sitting on the boundary are found exactly once, without the caller
+    // overlapping the chunks or deduplicating the output
+    float stitched[4] = { stream->last[0], stream->last[1],
+                          data[0], data[1] };
+    buffer.offset = (int)stream->position - 2;
+    check_peak(stitched, 1, stream->type, &buffer);
+    check_peak(stitched, 2, stream->type, &buffer);
+  }
+
+  if (size > 2) {
+    buffer.offset = (int)stream->position;
+    detect_peaks_scan(simd, data, size, stream->type, &buffer);
+  }
+
+  stream->last[0] = data[size - 2];
+  stream->last[1] = data[size - 1];
+  stream->position += size;
+
+  *results = buffer.results;
+  *resultsLength = buffer.length;
+}
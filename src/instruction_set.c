@@ -0,0 +1,127 @@
+/*! @file instruction_set.c
+ *  @brief Runtime CPU instruction set detection.
+ *  @author Markovtsev Vadim <v.markovtsev@samsung.com>
+ *  @version 1.0
+ *
+ *  @section Notes
+ *  This code partially conforms to <a href="http://google-styleguide.googlecode.com/svn/trunk/cppguide.xml">Google C++ Style Guide</a>.
+ *
+ *  @section Copyright
+ *  Copyright © 2013 Samsung R&D Institute Russia
+ *
+ *  @section License
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#define LIBSIMD_IMPLEMENTATION
+#include <simd/instruction_set.h>
+
+#if defined(__i386__) || defined(__x86_64__)
+#include <cpuid.h>
+
+#ifndef bit_AVX2
+#define bit_AVX2 (1 << 5)
+#endif
+#ifndef bit_AVX512F
+#define bit_AVX512F (1 << 16)
+#endif
+
+static SimdInstructionSet detect_instruction_set(void) {
+  unsigned int eax, ebx, ecx, edx;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+    return SIMD_INSTRUCTION_SET_NONE;
+  }
+  if (!(edx & bit_SSE)) {
+    return SIMD_INSTRUCTION_SET_NONE;
+  }
+  SimdInstructionSet set = SIMD_INSTRUCTION_SET_SSE;
+  // AVX needs the cpuid bit plus the OS saving the YMM state (XGETBV,
+  // xcr0 bits 1 and 2)
+  if ((ecx & bit_AVX) && (ecx & bit_OSXSAVE)) {
+    unsigned int xeax, xedx;
+    __asm__ __volatile__("xgetbv" : "=a"(xeax), "=d"(xedx) : "c"(0));
+    if ((xeax & 0x6) == 0x6) {
+      set = SIMD_INSTRUCTION_SET_AVX;
+      unsigned int max_level = __get_cpuid_max(0, NULL);
+      if (max_level >= 7) {
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        if (ebx & bit_AVX2) {
+          set = SIMD_INSTRUCTION_SET_AVX2;
+        }
+        // AVX-512 additionally needs the opmask and upper ZMM state saved
+        // (xcr0 bits 5, 6 and 7)
+        if ((ebx & bit_AVX512F) && (xeax & 0xE6) == 0xE6) {
+          set = SIMD_INSTRUCTION_SET_AVX512;
+        }
+      }
+    }
+  }
+  return set;
+}
+#elif defined(__ARM_NEON__)
+static SimdInstructionSet detect_instruction_set(void) {
+  // The library only builds the NEON kernels when the compiler targets
+  // NEON hardware, so being here means the CPU has it
+  return SIMD_INSTRUCTION_SET_NEON;
+}
+#else
+static SimdInstructionSet detect_instruction_set(void) {
+  return SIMD_INSTRUCTION_SET_NONE;
+}
+#endif
+
+SimdInstructionSet simd_cpu_instruction_set(void) {
+  static int detected = 0;
+  static SimdInstructionSet cached = SIMD_INSTRUCTION_SET_NONE;
+  if (!detected) {
+    cached = detect_instruction_set();
+    detected = 1;
+  }
+  return cached;
+}
+
+static int avx512_enabled = 1;
+
+void simd_avx512_enable(int enabled) {
+  avx512_enabled = enabled;
+}
+
+int simd_avx512_available(void) {
+  return avx512_enabled &&
+      simd_cpu_instruction_set() == SIMD_INSTRUCTION_SET_AVX512;
+}
+
+int simd_runtime_supported(void) {
+  SimdInstructionSet set = simd_cpu_instruction_set();
+#if defined(__ARM_NEON__)
+  return set == SIMD_INSTRUCTION_SET_NEON;
+#elif defined(__AVX512F__)
+  return set == SIMD_INSTRUCTION_SET_AVX512;
+#elif defined(__AVX2__)
+  return set == SIMD_INSTRUCTION_SET_AVX2 ||
+      set == SIMD_INSTRUCTION_SET_AVX512;
+#elif defined(__AVX__)
+  return set >= SIMD_INSTRUCTION_SET_AVX &&
+      set <= SIMD_INSTRUCTION_SET_AVX512;
+#elif defined(__SSE__)
+  return set != SIMD_INSTRUCTION_SET_NONE;
+#else
+  // Compiled without SIMD: the "simd" paths do not exist anyway
+  return 0;
+#endif
+}
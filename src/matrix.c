@@ -31,8 +31,12 @@
 #define LIBSIMD_IMPLEMENTATION
 #include "inc/simd/matrix.h"
 #include <assert.h>
+#include <pthread.h>
+#include <stdlib.h>
 #include "inc/simd/memory.h"
 #include <simd/instruction_set.h>
+#include <simd/parallel.h>
+#include <simd/stats.h>
 
 static void matrix_add_novec(const float *m1, const float *m2,
                       size_t w, size_t h, float *res) {
@@ -79,6 +83,46 @@ static void matrix_multiply_transposed_novec(const float *m1, const float *m2,
   }
 }
 
+static void matrix_vector_multiply_novec(const float *m, const float *v,
+                                         size_t w, size_t h, size_t stride,
+                                         float *res) {
+  for (int j = 0; j < (int)h; j++) {
+    float sum = 0;
+    for (int k = 0; k < (int)w; k++) {
+      sum += m[j * stride + k] * v[k];
+    }
+    res[j] = sum;
+  }
+}
+
+static void matrix_transpose_novec(const float *src, size_t w, size_t h,
+                                   size_t src_stride, size_t dst_stride,
+                                   float *dst) {
+  for (int j = 0; j < (int)h; j++) {
+    for (int i = 0; i < (int)w; i++) {
+      dst[i * dst_stride + j] = src[j * src_stride + i];
+    }
+  }
+}
+
+// Above this many float-s the operands cannot sit in the last level
+// cache, so the strict kernels switch to non-temporal stores.
+#define MATRIX_STREAM_MIN_SIZE (8 * 1024 * 1024 / sizeof(float))
+
+static void matrix_multiply_i16_novec(const int16_t *m1, const int16_t *m2,
+                                      size_t w1, size_t h1, size_t w2,
+                                      int32_t *res) {
+  for (int i = 0; i < (int)w2; i++) {
+    for (int j = 0; j < (int)h1; j++) {
+      int32_t sum = 0;
+      for (int k = 0; k < (int)w1; k++) {
+        sum += (int32_t)m1[j * w1 + k] * m2[k * w2 + i];
+      }
+      res[j * w2 + i] = sum;
+    }
+  }
+}
+
 #ifdef __ARM_NEON__
 static void matrix_add_neon(const float *m1, const float *m2,
                             size_t w, size_t h, float *res) {
@@ -110,6 +154,26 @@ static void matrix_sub_neon(const float *m1, const float *m2,
   }
 }
 
+static void matrix_add_neon_strict(const float *m1, const float *m2,
+                                   size_t w, size_t h, float *res) {
+  int length = (int)w * (int)h;
+  for (int i = 0; i < length; i += 8) {
+    vst1q_f32(res + i, vaddq_f32(vld1q_f32(m1 + i), vld1q_f32(m2 + i)));
+    vst1q_f32(res + i + 4,
+              vaddq_f32(vld1q_f32(m1 + i + 4), vld1q_f32(m2 + i + 4)));
+  }
+}
+
+static void matrix_sub_neon_strict(const float *m1, const float *m2,
+                                   size_t w, size_t h, float *res) {
+  int length = (int)w * (int)h;
+  for (int i = 0; i < length; i += 8) {
+    vst1q_f32(res + i, vsubq_f32(vld1q_f32(m1 + i), vld1q_f32(m2 + i)));
+    vst1q_f32(res + i + 4,
+              vsubq_f32(vld1q_f32(m1 + i + 4), vld1q_f32(m2 + i + 4)));
+  }
+}
+
 static void matrix_multiply_neon(const float *m1, const float *m2,
                                  size_t w1, size_t h1, size_t w2,
                                  size_t h2 UNUSED, float *res) {
@@ -164,6 +228,90 @@ static void matrix_multiply_transposed_neon(const float *m1, const float *m2,
     }
   }
 }
+
+static void matrix_vector_multiply_neon(const float *m, const float *v,
+                                        size_t w, size_t h, size_t stride,
+                                        float *res) {
+  for (int j = 0; j < (int)h; j++) {
+    float32x4_t sum = vdupq_n_f32(0.f);
+    for (int k = 0; k < (int)w - 7; k += 8) {
+      float32x4_t v1 = vld1q_f32(m + j * stride + k);
+      float32x4_t v2 = vld1q_f32(v + k);
+      sum = vmlaq_f32(sum, v1, v2);
+      v1 = vld1q_f32(m + j * stride + k + 4);
+      v2 = vld1q_f32(v + k + 4);
+      sum = vmlaq_f32(sum, v1, v2);
+    }
+    float32x2_t sum2 = vpadd_f32(vget_high_f32(sum),
+                                 vget_low_f32(sum));
+    float rsum = vget_lane_f32(sum2, 0) + vget_lane_f32(sum2, 1);
+    for (int k = (w & ~0x7); k < (int)w; k++) {
+      rsum += m[j * stride + k] * v[k];
+    }
+    res[j] = rsum;
+  }
+}
+
+static void matrix_transpose_neon(const float *src, size_t w, size_t h,
+                                  size_t src_stride, size_t dst_stride,
+                                  float *dst) {
+  int j = 0;
+  for (; j < (int)h - 3; j += 4) {
+    int i = 0;
+    for (; i < (int)w - 3; i += 4) {
+      const float *block = src + j * src_stride + i;
+      float32x4x2_t t01 = vtrnq_f32(vld1q_f32(block),
+                                    vld1q_f32(block + src_stride));
+      float32x4x2_t t23 = vtrnq_f32(vld1q_f32(block + 2 * src_stride),
+                                    vld1q_f32(block + 3 * src_stride));
+      float *out = dst + i * dst_stride + j;
+      vst1q_f32(out, vcombine_f32(vget_low_f32(t01.val[0]),
+                                  vget_low_f32(t23.val[0])));
+      vst1q_f32(out + dst_stride, vcombine_f32(vget_low_f32(t01.val[1]),
+                                               vget_low_f32(t23.val[1])));
+      vst1q_f32(out + 2 * dst_stride, vcombine_f32(vget_high_f32(t01.val[0]),
+                                                   vget_high_f32(t23.val[0])));
+      vst1q_f32(out + 3 * dst_stride, vcombine_f32(vget_high_f32(t01.val[1]),
+                                                   vget_high_f32(t23.val[1])));
+    }
+    for (; i < (int)w; i++) {
+      for (int jj = j; jj < j + 4; jj++) {
+        dst[i * dst_stride + jj] = src[jj * src_stride + i];
+      }
+    }
+  }
+  for (; j < (int)h; j++) {
+    for (int i = 0; i < (int)w; i++) {
+      dst[i * dst_stride + j] = src[j * src_stride + i];
+    }
+  }
+}
+
+static void matrix_multiply_i16_neon(const int16_t *m1, const int16_t *m2,
+                                     size_t w1, size_t h1, size_t w2,
+                                     int32_t *res) {
+  int16_t col2[w1] __attribute__((aligned(64)));
+  for (int i = 0; i < (int)w2; i++) {
+    for (int k = 0; k < (int)w1; k++) {
+      col2[k] = m2[k * w2 + i];
+    }
+    for (int j = 0; j < (int)h1; j++) {
+      int32x4_t sum = vdupq_n_s32(0);
+      for (int k = 0; k < (int)w1 - 7; k += 8) {
+        int16x8_t v1 = vld1q_s16(m1 + j * w1 + k);
+        int16x8_t v2 = vld1q_s16(col2 + k);
+        sum = vmlal_s16(sum, vget_low_s16(v1), vget_low_s16(v2));
+        sum = vmlal_s16(sum, vget_high_s16(v1), vget_high_s16(v2));
+      }
+      int32x2_t sum2 = vpadd_s32(vget_high_s32(sum), vget_low_s32(sum));
+      int32_t rsum = vget_lane_s32(sum2, 0) + vget_lane_s32(sum2, 1);
+      for (int k = (w1 & ~0x7); k < (int)w1; k++) {
+        rsum += (int32_t)m1[j * w1 + k] * col2[k];
+      }
+      res[j * w2 + i] = rsum;
+    }
+  }
+}
 #endif
 
 #ifdef __AVX__
@@ -197,10 +345,53 @@ static void matrix_sub_avx(const float *m1, const float *m2,
   }
 }
 
-static void matrix_multiply_avx(const float *m1, const float *m2,
-                                size_t w1, size_t h1, size_t w2,
-                                size_t h2 UNUSED, float *res) {
-  assert(align_complement_f32(m1) == 0);
+static void matrix_add_avx_strict(const float *m1, const float *m2,
+                                  size_t w, size_t h, float *res) {
+  int length = (int)w * (int)h;
+  if (length >= (int)MATRIX_STREAM_MIN_SIZE) {
+    for (int i = 0; i < length; i += 16) {
+      _mm256_stream_ps(res + i, _mm256_add_ps(_mm256_load_ps(m1 + i),
+                                              _mm256_load_ps(m2 + i)));
+      _mm256_stream_ps(res + i + 8,
+                       _mm256_add_ps(_mm256_load_ps(m1 + i + 8),
+                                     _mm256_load_ps(m2 + i + 8)));
+    }
+    _mm_sfence();
+    return;
+  }
+  for (int i = 0; i < length; i += 16) {
+    _mm256_store_ps(res + i, _mm256_add_ps(_mm256_load_ps(m1 + i),
+                                           _mm256_load_ps(m2 + i)));
+    _mm256_store_ps(res + i + 8, _mm256_add_ps(_mm256_load_ps(m1 + i + 8),
+                                               _mm256_load_ps(m2 + i + 8)));
+  }
+}
+
+static void matrix_sub_avx_strict(const float *m1, const float *m2,
+                                  size_t w, size_t h, float *res) {
+  int length = (int)w * (int)h;
+  if (length >= (int)MATRIX_STREAM_MIN_SIZE) {
+    for (int i = 0; i < length; i += 16) {
+      _mm256_stream_ps(res + i, _mm256_sub_ps(_mm256_load_ps(m1 + i),
+                                              _mm256_load_ps(m2 + i)));
+      _mm256_stream_ps(res + i + 8,
+                       _mm256_sub_ps(_mm256_load_ps(m1 + i + 8),
+                                     _mm256_load_ps(m2 + i + 8)));
+    }
+    _mm_sfence();
+    return;
+  }
+  for (int i = 0; i < length; i += 16) {
+    _mm256_store_ps(res + i, _mm256_sub_ps(_mm256_load_ps(m1 + i),
+                                           _mm256_load_ps(m2 + i)));
+    _mm256_store_ps(res + i + 8, _mm256_sub_ps(_mm256_load_ps(m1 + i + 8),
+                                               _mm256_load_ps(m2 + i + 8)));
+  }
+}
+
+static void matrix_multiply_avx_small(const float *m1, const float *m2,
+                                      size_t w1, size_t h1, size_t w2,
+                                      size_t h2 UNUSED, float *res) {
   float col2[w1] __attribute__((aligned(64)));
   for (int i = 0; i < (int)w2; i++) {
     for (int k = 0; k < (int)w1; k++) {
@@ -225,12 +416,170 @@ static void matrix_multiply_avx(const float *m1, const float *m2,
   }
 }
 
+// Cache blocking parameters of the packed matrix_multiply implementation.
+// The micro-kernel updates a GEMM_MR x GEMM_NR tile of the result from
+// panels repacked into contiguous aligned buffers, so the innermost loop
+// streams through memory with unit stride regardless of the matrix widths.
+#define GEMM_MR 6
+#define GEMM_NR 16
+#define GEMM_KC 256
+#define GEMM_MC 132
+#define GEMM_NC 1024
+
+// Repacks an mc x kc panel of a into strips of GEMM_MR rows laid out
+// k-major, padding the last strip with zero rows
+static void gemm_pack_a(const float *a, size_t lda, int mc, int kc,
+                        float *ap) {
+  for (int i0 = 0; i0 < mc; i0 += GEMM_MR) {
+    int mr = mc - i0 < GEMM_MR? mc - i0 : GEMM_MR;
+    for (int k = 0; k < kc; k++) {
+      int r = 0;
+      for (; r < mr; r++) {
+        ap[r] = a[(i0 + r) * lda + k];
+      }
+      for (; r < GEMM_MR; r++) {
+        ap[r] = 0.f;
+      }
+      ap += GEMM_MR;
+    }
+  }
+}
+
+// Repacks a kc x nc panel of b into strips of GEMM_NR columns laid out
+// k-major, padding the last strip with zero columns
+static void gemm_pack_b(const float *b, size_t ldb, int kc, int nc,
+                        float *bp) {
+  for (int j0 = 0; j0 < nc; j0 += GEMM_NR) {
+    int nr = nc - j0 < GEMM_NR? nc - j0 : GEMM_NR;
+    for (int k = 0; k < kc; k++) {
+      int j = 0;
+      for (; j < nr; j++) {
+        bp[j] = b[k * ldb + j0 + j];
+      }
+      for (; j < GEMM_NR; j++) {
+        bp[j] = 0.f;
+      }
+      bp += GEMM_NR;
+    }
+  }
+}
+
+static void gemm_kernel(const float *ap, const float *bp, int kc,
+                        float alpha, float beta, float *c, size_t ldc) {
+  __m256 acc[GEMM_MR][2];
+  for (int r = 0; r < GEMM_MR; r++) {
+    acc[r][0] = _mm256_setzero_ps();
+    acc[r][1] = _mm256_setzero_ps();
+  }
+  for (int k = 0; k < kc; k++) {
+    __m256 b0 = _mm256_load_ps(bp);
+    __m256 b1 = _mm256_load_ps(bp + 8);
+    bp += GEMM_NR;
+    for (int r = 0; r < GEMM_MR; r++) {
+      __m256 a = _mm256_broadcast_ss(ap + r);
+#ifdef __FMA__
+      acc[r][0] = _mm256_fmadd_ps(a, b0, acc[r][0]);
+      acc[r][1] = _mm256_fmadd_ps(a, b1, acc[r][1]);
+#else
+      acc[r][0] = _mm256_add_ps(acc[r][0], _mm256_mul_ps(a, b0));
+      acc[r][1] = _mm256_add_ps(acc[r][1], _mm256_mul_ps(a, b1));
+#endif
+    }
+    ap += GEMM_MR;
+  }
+  const __m256 alphavec = _mm256_set1_ps(alpha);
+  const __m256 betavec = _mm256_set1_ps(beta);
+  for (int r = 0; r < GEMM_MR; r++) {
+    float *row = c + r * ldc;
+    if (alpha != 1.f) {
+      acc[r][0] = _mm256_mul_ps(acc[r][0], alphavec);
+      acc[r][1] = _mm256_mul_ps(acc[r][1], alphavec);
+    }
+    if (beta == 1.f) {
+      acc[r][0] = _mm256_add_ps(acc[r][0], _mm256_loadu_ps(row));
+      acc[r][1] = _mm256_add_ps(acc[r][1], _mm256_loadu_ps(row + 8));
+    } else if (beta != 0.f) {
+      acc[r][0] = _mm256_add_ps(acc[r][0],
+                                _mm256_mul_ps(_mm256_loadu_ps(row), betavec));
+      acc[r][1] = _mm256_add_ps(
+          acc[r][1], _mm256_mul_ps(_mm256_loadu_ps(row + 8), betavec));
+    }
+    _mm256_storeu_ps(row, acc[r][0]);
+    _mm256_storeu_ps(row + 8, acc[r][1]);
+  }
+}
+
+// The border tiles go through a full-size temporary so that the
+// micro-kernel never stores past the result matrix
+static void gemm_kernel_edge(const float *ap, const float *bp, int kc,
+                             int mr, int nr, float alpha, float beta,
+                             float *c, size_t ldc) {
+  float tmp[GEMM_MR * GEMM_NR] __attribute__((aligned(32)));
+  gemm_kernel(ap, bp, kc, alpha, 0.f, tmp, GEMM_NR);
+  for (int r = 0; r < mr; r++) {
+    for (int j = 0; j < nr; j++) {
+      if (beta == 0.f) {
+        c[r * ldc + j] = tmp[r * GEMM_NR + j];
+      } else {
+        c[r * ldc + j] = tmp[r * GEMM_NR + j] + beta * c[r * ldc + j];
+      }
+    }
+  }
+}
+
+static void matrix_multiply_blocked(const float *m1, const float *m2,
+                                    size_t w1, size_t h1, size_t w2,
+                                    float alpha, float beta, float *res) {
+  int M = (int)h1, N = (int)w2, K = (int)w1;
+  float *bp = malloc_aligned(GEMM_KC * GEMM_NC * sizeof(float));
+  float *ap = malloc_aligned(GEMM_MC * GEMM_KC * sizeof(float));
+  for (int jc = 0; jc < N; jc += GEMM_NC) {
+    int nc = N - jc < GEMM_NC? N - jc : GEMM_NC;
+    for (int pc = 0; pc < K; pc += GEMM_KC) {
+      int kc = K - pc < GEMM_KC? K - pc : GEMM_KC;
+      gemm_pack_b(m2 + pc * N + jc, N, kc, nc, bp);
+      // The first slice of K applies beta, the rest accumulate on top
+      float slice_beta = pc > 0? 1.f : beta;
+      for (int ic = 0; ic < M; ic += GEMM_MC) {
+        int mc = M - ic < GEMM_MC? M - ic : GEMM_MC;
+        gemm_pack_a(m1 + ic * K + pc, K, mc, kc, ap);
+        for (int j = 0; j < nc; j += GEMM_NR) {
+          int nr = nc - j < GEMM_NR? nc - j : GEMM_NR;
+          const float *bpt = bp + (j / GEMM_NR) * kc * GEMM_NR;
+          for (int i = 0; i < mc; i += GEMM_MR) {
+            int mr = mc - i < GEMM_MR? mc - i : GEMM_MR;
+            const float *apt = ap + (i / GEMM_MR) * kc * GEMM_MR;
+            float *ct = res + (size_t)(ic + i) * N + jc + j;
+            if (mr == GEMM_MR && nr == GEMM_NR) {
+              gemm_kernel(apt, bpt, kc, alpha, slice_beta, ct, N);
+            } else {
+              gemm_kernel_edge(apt, bpt, kc, mr, nr, alpha, slice_beta,
+                               ct, N);
+            }
+          }
+        }
+      }
+    }
+  }
+  free(ap);
+  free(bp);
+}
+
+static void matrix_multiply_avx(const float *m1, const float *m2,
+                                size_t w1, size_t h1, size_t w2,
+                                size_t h2, float *res) {
+  // The packing overhead does not pay off while everything fits in L1
+  if (h1 * w2 < 4096) {
+    matrix_multiply_avx_small(m1, m2, w1, h1, w2, h2, res);
+    return;
+  }
+  matrix_multiply_blocked(m1, m2, w1, h1, w2, 1.f, 0.f, res);
+}
+
 static void matrix_multiply_transposed_avx(const float *m1, const float *m2,
                                            size_t w1, size_t h1,
                                            size_t w2 UNUSED,  size_t h2,
                                            float *res) {
-  assert(align_complement_f32(m1) == 0);
-  assert(align_complement_f32(m2) == 0);
   for (int j = 0; j < (int)h1; j++) {
     for (int i = 0; i < (int)h2; i++) {
       __m256 sum = _mm256_setzero_ps();
@@ -250,6 +599,129 @@ static void matrix_multiply_transposed_avx(const float *m1, const float *m2,
     }
   }
 }
+
+static void matrix_vector_multiply_avx(const float *m, const float *v,
+                                       size_t w, size_t h, size_t stride,
+                                       float *res) {
+  for (int j = 0; j < (int)h; j++) {
+    __m256 sum = _mm256_setzero_ps();
+    for (int k = 0; k < (int)w - 7; k += 8) {
+      __m256 v1 = _mm256_loadu_ps(m + j * stride + k);
+      __m256 v2 = _mm256_loadu_ps(v + k);
+#ifdef __FMA__
+      sum = _mm256_fmadd_ps(v1, v2, sum);
+#else
+      sum = _mm256_add_ps(sum, _mm256_mul_ps(v1, v2));
+#endif
+    }
+    sum = _mm256_hadd_ps(sum, sum);
+    sum = _mm256_hadd_ps(sum, sum);
+    float rsum = _mm256_get_ps(sum, 0) + _mm256_get_ps(sum, 4);
+    for (int k = (w & ~0x7); k < (int)w; k++) {
+      rsum += m[j * stride + k] * v[k];
+    }
+    res[j] = rsum;
+  }
+}
+
+static void matrix_transpose_avx(const float *src, size_t w, size_t h,
+                                 size_t src_stride, size_t dst_stride,
+                                 float *dst) {
+  int j = 0;
+  for (; j < (int)h - 7; j += 8) {
+    int i = 0;
+    for (; i < (int)w - 7; i += 8) {
+      const float *block = src + j * src_stride + i;
+      __m256 r0 = _mm256_loadu_ps(block);
+      __m256 r1 = _mm256_loadu_ps(block + src_stride);
+      __m256 r2 = _mm256_loadu_ps(block + 2 * src_stride);
+      __m256 r3 = _mm256_loadu_ps(block + 3 * src_stride);
+      __m256 r4 = _mm256_loadu_ps(block + 4 * src_stride);
+      __m256 r5 = _mm256_loadu_ps(block + 5 * src_stride);
+      __m256 r6 = _mm256_loadu_ps(block + 6 * src_stride);
+      __m256 r7 = _mm256_loadu_ps(block + 7 * src_stride);
+      __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+      __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+      __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+      __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+      __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+      __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+      __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+      __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+      r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+      r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+      r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+      r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+      r4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+      r5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+      r6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+      r7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+      float *out = dst + i * dst_stride + j;
+      _mm256_storeu_ps(out, _mm256_permute2f128_ps(r0, r4, 0x20));
+      _mm256_storeu_ps(out + dst_stride, _mm256_permute2f128_ps(r1, r5, 0x20));
+      _mm256_storeu_ps(out + 2 * dst_stride,
+                       _mm256_permute2f128_ps(r2, r6, 0x20));
+      _mm256_storeu_ps(out + 3 * dst_stride,
+                       _mm256_permute2f128_ps(r3, r7, 0x20));
+      _mm256_storeu_ps(out + 4 * dst_stride,
+                       _mm256_permute2f128_ps(r0, r4, 0x31));
+      _mm256_storeu_ps(out + 5 * dst_stride,
+                       _mm256_permute2f128_ps(r1, r5, 0x31));
+      _mm256_storeu_ps(out + 6 * dst_stride,
+                       _mm256_permute2f128_ps(r2, r6, 0x31));
+      _mm256_storeu_ps(out + 7 * dst_stride,
+                       _mm256_permute2f128_ps(r3, r7, 0x31));
+    }
+    for (; i < (int)w; i++) {
+      for (int jj = j; jj < j + 8; jj++) {
+        dst[i * dst_stride + jj] = src[jj * src_stride + i];
+      }
+    }
+  }
+  for (; j < (int)h; j++) {
+    for (int i = 0; i < (int)w; i++) {
+      dst[i * dst_stride + j] = src[j * src_stride + i];
+    }
+  }
+}
+
+static void matrix_multiply_i16_sse(const int16_t *m1, const int16_t *m2,
+                                    size_t w1, size_t h1, size_t w2,
+                                    int32_t *res) {
+  int16_t col2[w1] __attribute__((aligned(64)));
+  for (int i = 0; i < (int)w2; i++) {
+    for (int k = 0; k < (int)w1; k++) {
+      col2[k] = m2[k * w2 + i];
+    }
+    for (int j = 0; j < (int)h1; j++) {
+      int k = 0;
+#ifdef __AVX2__
+      __m256i sum = _mm256_setzero_si256();
+      for (; k < (int)w1 - 15; k += 16) {
+        __m256i v1 = _mm256_loadu_si256((const __m256i *)(m1 + j * w1 + k));
+        __m256i v2 = _mm256_load_si256((const __m256i *)(col2 + k));
+        sum = _mm256_add_epi32(sum, _mm256_madd_epi16(v1, v2));
+      }
+      __m128i sum128 = _mm_add_epi32(_mm256_castsi256_si128(sum),
+                                     _mm256_extracti128_si256(sum, 1));
+#else
+      __m128i sum128 = _mm_setzero_si128();
+#endif
+      for (; k < (int)w1 - 7; k += 8) {
+        __m128i v1 = _mm_loadu_si128((const __m128i *)(m1 + j * w1 + k));
+        __m128i v2 = _mm_load_si128((const __m128i *)(col2 + k));
+        sum128 = _mm_add_epi32(sum128, _mm_madd_epi16(v1, v2));
+      }
+      sum128 = _mm_hadd_epi32(sum128, sum128);
+      sum128 = _mm_hadd_epi32(sum128, sum128);
+      int32_t rsum = _mm_cvtsi128_si32(sum128);
+      for (; k < (int)w1; k++) {
+        rsum += (int32_t)m1[j * w1 + k] * col2[k];
+      }
+      res[j * w2 + i] = rsum;
+    }
+  }
+}
 #endif
 
 void matrix_add(int simd, const float *m1, const float *m2,
@@ -294,9 +766,107 @@ void matrix_sub(int simd, const float *m1, const float *m2,
   }
 }
 
-void matrix_multiply(int simd, const float *m1, const float *m2,
-                     size_t w1, size_t h1, size_t w2, size_t h2,
-                     float *res) {
+void matrix_add_strict(int simd, const float *m1, const float *m2,
+                       size_t w, size_t h, float *res) {
+  assert(m1);
+  assert(m2);
+  assert(res);
+  assert(w > 0);
+  assert(h > 0);
+  assert(w * h % 16 == 0);
+#ifdef __AVX__
+  assert(align_complement_f32(m1) == 0);
+  assert(align_complement_f32(m2) == 0);
+  assert(align_complement_f32(res) == 0);
+#endif
+  if (simd) {
+#ifdef __ARM_NEON__
+    matrix_add_neon_strict(m1, m2, w, h, res);
+  } else {
+#elif defined(__AVX__)
+    matrix_add_avx_strict(m1, m2, w, h, res);
+  } else {
+#else
+  } {
+#endif
+    matrix_add_novec(m1, m2, w, h, res);
+  }
+}
+
+void matrix_sub_strict(int simd, const float *m1, const float *m2,
+                       size_t w, size_t h, float *res) {
+  assert(m1);
+  assert(m2);
+  assert(res);
+  assert(w > 0);
+  assert(h > 0);
+  assert(w * h % 16 == 0);
+#ifdef __AVX__
+  assert(align_complement_f32(m1) == 0);
+  assert(align_complement_f32(m2) == 0);
+  assert(align_complement_f32(res) == 0);
+#endif
+  if (simd) {
+#ifdef __ARM_NEON__
+    matrix_sub_neon_strict(m1, m2, w, h, res);
+  } else {
+#elif defined(__AVX__)
+    matrix_sub_avx_strict(m1, m2, w, h, res);
+  } else {
+#else
+  } {
+#endif
+    matrix_sub_novec(m1, m2, w, h, res);
+  }
+}
+
+void matrix_vector_multiply(int simd, const float *m, const float *v,
+                            size_t w, size_t h, size_t stride, float *res) {
+  assert(m);
+  assert(v);
+  assert(res);
+  assert(w > 0);
+  assert(h > 0);
+  assert(stride >= w);
+  if (simd) {
+#ifdef __ARM_NEON__
+    matrix_vector_multiply_neon(m, v, w, h, stride, res);
+  } else {
+#elif defined(__AVX__)
+    matrix_vector_multiply_avx(m, v, w, h, stride, res);
+  } else {
+#else
+  } {
+#endif
+    matrix_vector_multiply_novec(m, v, w, h, stride, res);
+  }
+}
+
+void matrix_transpose(int simd, const float *src, size_t w, size_t h,
+                      size_t src_stride, size_t dst_stride, float *dst) {
+  assert(src);
+  assert(dst);
+  assert(w > 0);
+  assert(h > 0);
+  assert(src_stride >= w);
+  assert(dst_stride >= h);
+  if (simd) {
+#ifdef __ARM_NEON__
+    matrix_transpose_neon(src, w, h, src_stride, dst_stride, dst);
+  } else {
+#elif defined(__AVX__)
+    matrix_transpose_avx(src, w, h, src_stride, dst_stride, dst);
+  } else {
+#else
+  } {
+#endif
+    matrix_transpose_novec(src, w, h, src_stride, dst_stride, dst);
+  }
+}
+
+void matrix_multiply_i16(int simd, const int16_t *m1, const int16_t *m2,
+                         size_t w1, size_t h1, size_t w2, size_t h2,
+                         int32_t *res) {
   assert(w1 == h2);
   assert(m1);
   assert(m2);
@@ -305,6 +875,60 @@ void matrix_multiply(int simd, const float *m1, const float *m2,
   assert(h1 > 0);
   assert(w2 > 0);
   if (simd) {
+#ifdef __ARM_NEON__
+    matrix_multiply_i16_neon(m1, m2, w1, h1, w2, res);
+  } else {
+#elif defined(__AVX__)
+    matrix_multiply_i16_sse(m1, m2, w1, h1, w2, res);
+  } else {
+#else
+  } {
+#endif
+    matrix_multiply_i16_novec(m1, m2, w1, h1, w2, res);
+  }
+}
+
+static void matrix_multiply_accumulate_novec(const float *m1,
+                                             const float *m2,
+                                             size_t w1, size_t h1, size_t w2,
+                                             float alpha, float beta,
+                                             float *res) {
+  for (int i = 0; i < (int)w2; i++) {
+    for (int j = 0; j < (int)h1; j++) {
+      float sum = 0;
+      for (int k = 0; k < (int)w1; k++) {
+        sum += m1[j * w1 + k] * m2[k * w2 + i];
+      }
+      if (beta == 0.f) {
+        res[j * w2 + i] = alpha * sum;
+      } else {
+        res[j * w2 + i] = alpha * sum + beta * res[j * w2 + i];
+      }
+    }
+  }
+}
+
+static void matrix_multiply_accumulate_serial(int simd, const float *m1,
+                                              const float *m2,
+                                              size_t w1, size_t h1, size_t w2,
+                                              float alpha, float beta,
+                                              float *res) {
+#ifdef __AVX__
+  // The packed path folds alpha and beta into the micro-kernel stores
+  if (simd && h1 * w2 >= 4096) {
+    matrix_multiply_blocked(m1, m2, w1, h1, w2, alpha, beta, res);
+    return;
+  }
+#else
+  (void)simd;
+#endif
+  matrix_multiply_accumulate_novec(m1, m2, w1, h1, w2, alpha, beta, res);
+}
+
+static void matrix_multiply_serial(int simd, const float *m1, const float *m2,
+                                   size_t w1, size_t h1, size_t w2, size_t h2,
+                                   float *res) {
+  if (simd) {
 #ifdef __ARM_NEON__
     matrix_multiply_neon(m1, m2, w1, h1, w2, h2, res);
   } else {
@@ -313,21 +937,16 @@ void matrix_multiply(int simd, const float *m1, const float *m2,
   } else {
 #else
   } {
-#endif    
+#endif
     matrix_multiply_novec(m1, m2, w1, h1, w2, h2, res);
   }
 }
 
-void matrix_multiply_transposed(int simd, const float *m1, const float *m2,
-                                size_t w1, size_t h1, size_t w2, size_t h2,
-                                float *res) {
-  assert(w1 == w2);
-  assert(m1);
-  assert(m2);
-  assert(res);
-  assert(w1 > 0);
-  assert(h1 > 0);
-  assert(h2 > 0);
+static void matrix_multiply_transposed_serial(int simd, const float *m1,
+                                              const float *m2,
+                                              size_t w1, size_t h1,
+                                              size_t w2, size_t h2,
+                                              float *res) {
   if (simd) {
 #ifdef __ARM_NEON__
     matrix_multiply_transposed_neon(m1, m2, w1, h1, w2, h2, res);
@@ -342,3 +961,153 @@ void matrix_multiply_transposed(int simd, const float *m1, const float *m2,
   }
 }
 
+// Every multiplication kernel handles the rows of m1 independently, so
+// the threaded mode simply hands each worker a horizontal panel of the
+// result. The count is a process-wide setting to keep the signatures
+// unchanged.
+static int matrix_threads = 1;
+
+// A worker panel narrower than this is not worth a thread
+#define MATRIX_THREAD_MIN_ROWS 32
+
+void matrix_set_threads(int threads) {
+  assert(threads >= 1);
+  matrix_threads = threads;
+}
+
+typedef enum {
+  MATRIX_MULTIPLY_PLAIN,
+  MATRIX_MULTIPLY_TRANSPOSED,
+  MATRIX_MULTIPLY_ACCUMULATE
+} MatrixMultiplyMode;
+
+typedef struct {
+  int simd;
+  MatrixMultiplyMode mode;
+  const float *m1;
+  const float *m2;
+  size_t w1;
+  size_t rows;
+  size_t w2;
+  size_t h2;
+  float alpha;
+  float beta;
+  float *res;
+} MatrixMultiplyWorker;
+
+static void *matrix_multiply_worker(void *arg) {
+  const MatrixMultiplyWorker *ctx = arg;
+  switch (ctx->mode) {
+    case MATRIX_MULTIPLY_TRANSPOSED:
+      matrix_multiply_transposed_serial(ctx->simd, ctx->m1, ctx->m2, ctx->w1,
+                                        ctx->rows, ctx->w2, ctx->h2,
+                                        ctx->res);
+      break;
+    case MATRIX_MULTIPLY_ACCUMULATE:
+      matrix_multiply_accumulate_serial(ctx->simd, ctx->m1, ctx->m2, ctx->w1,
+                                        ctx->rows, ctx->w2, ctx->alpha,
+                                        ctx->beta, ctx->res);
+      break;
+    default:
+      matrix_multiply_serial(ctx->simd, ctx->m1, ctx->m2, ctx->w1,
+                             ctx->rows, ctx->w2, ctx->h2, ctx->res);
+      break;
+  }
+  return NULL;
+}
+
+static void matrix_multiply_task(size_t index, void *user) {
+  matrix_multiply_worker(&((MatrixMultiplyWorker *)user)[index]);
+}
+
+static void matrix_multiply_threaded(int simd, MatrixMultiplyMode mode,
+                                     const float *m1, const float *m2,
+                                     size_t w1, size_t h1, size_t w2,
+                                     size_t h2, float alpha, float beta,
+                                     float *res) {
+  size_t res_width = mode == MATRIX_MULTIPLY_TRANSPOSED? h2 : w2;
+  int threads = matrix_threads;
+  if ((size_t)threads > h1 / MATRIX_THREAD_MIN_ROWS) {
+    threads = (int)(h1 / MATRIX_THREAD_MIN_ROWS);
+  }
+  if (threads <= 1) {
+    switch (mode) {
+      case MATRIX_MULTIPLY_TRANSPOSED:
+        matrix_multiply_transposed_serial(simd, m1, m2, w1, h1, w2, h2, res);
+        break;
+      case MATRIX_MULTIPLY_ACCUMULATE:
+        matrix_multiply_accumulate_serial(simd, m1, m2, w1, h1, w2,
+                                          alpha, beta, res);
+        break;
+      default:
+        matrix_multiply_serial(simd, m1, m2, w1, h1, w2, h2, res);
+        break;
+    }
+    return;
+  }
+  MatrixMultiplyWorker *contexts =
+      malloc(threads * sizeof(MatrixMultiplyWorker));
+  size_t slice = (h1 + threads - 1) / threads;
+  for (int t = 0; t < threads; t++) {
+    size_t start = t * slice;
+    size_t rows = h1 - start < slice? h1 - start : slice;
+    contexts[t].simd = simd;
+    contexts[t].mode = mode;
+    contexts[t].m1 = m1 + start * w1;
+    contexts[t].m2 = m2;
+    contexts[t].w1 = w1;
+    contexts[t].rows = rows;
+    contexts[t].w2 = w2;
+    contexts[t].h2 = h2;
+    contexts[t].alpha = alpha;
+    contexts[t].beta = beta;
+    contexts[t].res = res + start * res_width;
+  }
+  simd_parallel_for(matrix_multiply_task, threads, contexts);
+  free(contexts);
+}
+
+void matrix_multiply(int simd, const float *m1, const float *m2,
+                     size_t w1, size_t h1, size_t w2, size_t h2,
+                     float *res) {
+  assert(w1 == h2);
+  assert(m1);
+  assert(m2);
+  assert(res);
+  assert(w1 > 0);
+  assert(h1 > 0);
+  assert(w2 > 0);
+  SIMD_STATS_START();
+  matrix_multiply_threaded(simd, MATRIX_MULTIPLY_PLAIN, m1, m2, w1, h1,
+                           w2, h2, 1.f, 0.f, res);
+  SIMD_STATS_FINISH(SIMD_KERNEL_MATRIX, w2 * h1);
+}
+
+void matrix_multiply_accumulate(int simd, const float *m1, const float *m2,
+                                size_t w1, size_t h1, size_t w2, size_t h2,
+                                float alpha, float beta, float *res) {
+  assert(w1 == h2);
+  assert(m1);
+  assert(m2);
+  assert(res);
+  assert(w1 > 0);
+  assert(h1 > 0);
+  assert(w2 > 0);
+  matrix_multiply_threaded(simd, MATRIX_MULTIPLY_ACCUMULATE, m1, m2, w1, h1,
+                           w2, h2, alpha, beta, res);
+}
+
+void matrix_multiply_transposed(int simd, const float *m1, const float *m2,
+                                size_t w1, size_t h1, size_t w2, size_t h2,
+                                float *res) {
+  assert(w1 == w2);
+  assert(m1);
+  assert(m2);
+  assert(res);
+  assert(w1 > 0);
+  assert(h1 > 0);
+  assert(h2 > 0);
+  matrix_multiply_threaded(simd, MATRIX_MULTIPLY_TRANSPOSED, m1, m2, w1, h1,
+                           w2, h2, 1.f, 0.f, res);
+}
+
@@ -37,6 +37,19 @@
 #endif
 #include <stdlib.h>
 #include <stdint.h>
+#ifdef __linux__
+#ifndef __USE_MISC
+#define __USE_MISC
+#endif
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#else
+#include <stdio.h>
+#endif
+#include <simd/parallel.h>
 
 #ifdef __AVX__
 static int align_offset_internal(const void *ptr) {
@@ -86,11 +99,337 @@ void *malloc_aligned(size_t size) {
   return ptr;
 }
 
+void *malloc_aligned_huge(size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  const size_t kHugePageSize = (size_t)2 << 20;
+  if (size >= kHugePageSize) {
+    // A 2 MB aligned block covering whole huge pages lets the kernel back
+    // it with them; the pointer is still disposed with the usual free().
+    void *ptr;
+    size_t rounded = (size + kHugePageSize - 1) & ~(kHugePageSize - 1);
+#ifndef __ANDROID__
+    if (posix_memalign(&ptr, kHugePageSize, rounded) != 0) {
+      return malloc_aligned(size);
+    }
+#else
+    ptr = memalign(kHugePageSize, rounded);
+    if (ptr == NULL) {
+      return malloc_aligned(size);
+    }
+#endif
+    // Advisory only: without THP support the block simply stays on
+    // normal pages
+    madvise(ptr, rounded, MADV_HUGEPAGE);
+    return ptr;
+  }
+#endif
+  return malloc_aligned(size);
+}
+
+void *malloc_aligned_numa(size_t size, int node UNUSED) {
+  void *ptr = malloc_aligned(size);
+#if defined(__linux__) && defined(SYS_mbind)
+  if (ptr != NULL && node >= 0 &&
+      node < (int)(sizeof(unsigned long) * 8)) {
+    // Bind only the fully owned interior pages; the allocator's metadata
+    // may share the boundary pages with neighbouring blocks
+    unsigned long page = (unsigned long)sysconf(_SC_PAGESIZE);
+    unsigned long begin = ((unsigned long)(uintptr_t)ptr + page - 1) &
+        ~(page - 1);
+    unsigned long end = ((unsigned long)(uintptr_t)ptr + size) &
+        ~(page - 1);
+    if (end > begin) {
+      unsigned long nodemask = 1UL << node;
+      // MPOL_PREFERRED (1): advisory, like the madvise() of
+      // malloc_aligned_huge() - when the node is full the pages spill
+      // over instead of failing the allocation
+      syscall(SYS_mbind, begin, end - begin, 1, &nodemask,
+              sizeof(nodemask) * 8, 0);
+    }
+  }
+#endif
+  return ptr;
+}
+
+const float *simd_mmap_signal(const char *path, size_t *length) {
+  assert(path);
+  assert(length);
+#ifdef __linux__
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return NULL;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(float)) {
+    close(fd);
+    return NULL;
+  }
+  size_t size = (size_t)st.st_size;
+  void *ptr = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  // The mapping survives the close
+  close(fd);
+  if (ptr == MAP_FAILED) {
+    return NULL;
+  }
+  madvise(ptr, size, MADV_SEQUENTIAL);
+  *length = size / sizeof(float);
+  return ptr;
+#else
+  FILE *file = fopen(path, "rb");
+  if (file == NULL) {
+    return NULL;
+  }
+  if (fseek(file, 0, SEEK_END) != 0) {
+    fclose(file);
+    return NULL;
+  }
+  long size = ftell(file);
+  if (size < (long)sizeof(float)) {
+    fclose(file);
+    return NULL;
+  }
+  rewind(file);
+  size_t count = (size_t)size / sizeof(float);
+  float *ptr = malloc_aligned(count * sizeof(float));
+  if (ptr == NULL || fread(ptr, sizeof(float), count, file) != count) {
+    free(ptr);
+    fclose(file);
+    return NULL;
+  }
+  fclose(file);
+  *length = count;
+  return ptr;
+#endif
+}
+
+void simd_munmap_signal(const float *ptr, size_t length UNUSED) {
+  if (ptr == NULL) {
+    return;
+  }
+#ifdef __linux__
+  munmap((void *)ptr, length * sizeof(float));
+#else
+  free((void *)ptr);
+#endif
+}
+
+void simd_madvise_sequential(const void *ptr, size_t size UNUSED) {
+  assert(ptr);
+#if defined(__linux__) && defined(MADV_SEQUENTIAL)
+  // madvise() wants a page aligned start; round the range outwards
+  unsigned long page = (unsigned long)sysconf(_SC_PAGESIZE);
+  unsigned long begin = (unsigned long)(uintptr_t)ptr & ~(page - 1);
+  unsigned long end = ((unsigned long)(uintptr_t)ptr + size + page - 1) &
+      ~(page - 1);
+  madvise((void *)(uintptr_t)begin, end - begin, MADV_SEQUENTIAL);
+#endif
+}
+
+/// @brief One cache line in float-s, the software prefetch stride of
+/// frame_extract().
+#define FRAME_PREFETCH_STRIDE 16
+
+size_t frame_extract_count(size_t length, size_t frameSize, size_t hopSize) {
+  assert(frameSize > 0);
+  assert(hopSize > 0);
+  if (length < frameSize) {
+    return 0;
+  }
+  return (length - frameSize) / hopSize + 1;
+}
+
+void frame_extract(const float *__restrict src, size_t length,
+                   size_t frameSize, size_t hopSize,
+                   float *__restrict dst) {
+  assert(src);
+  assert(dst);
+  assert(hopSize <= frameSize);
+  size_t count = frame_extract_count(length, frameSize, hopSize);
+  if (count == 0) {
+    return;
+  }
+  size_t used = (count - 1) * hopSize + frameSize;
+  // The source is swept once, hop segment by hop segment; each segment is
+  // scattered to every frame containing it while it is still in L1, so no
+  // source cache line is fetched from memory twice
+  for (size_t pos = 0; pos < used; pos += hopSize) {
+    size_t seg = used - pos < hopSize? used - pos : hopSize;
+    for (size_t p = pos + hopSize; p < used && p < pos + 2 * hopSize;
+         p += FRAME_PREFETCH_STRIDE) {
+      __builtin_prefetch(src + p);
+    }
+    // The frames overlapping [pos, pos + seg): the first one may end in
+    // the middle of the segment when hopSize does not divide frameSize
+    size_t flo = pos < frameSize? 0 : (pos - frameSize) / hopSize + 1;
+    size_t fhi = pos / hopSize < count - 1? pos / hopSize : count - 1;
+    for (size_t f = flo; f <= fhi; f++) {
+      size_t tail = f * hopSize + frameSize - pos;
+      size_t copy = tail < seg? tail : seg;
+      memcpy(dst + f * frameSize + (pos - f * hopSize), src + pos,
+             copy * sizeof(float));
+    }
+  }
+}
+
+int frame_extract_views(const float *src, size_t length,
+                        size_t frameSize, size_t hopSize,
+                        const float **frames) {
+  assert(src);
+  assert(frames);
+  assert(hopSize <= frameSize);
+#ifdef __AVX__
+  if (hopSize % 8 != 0) {
+    return 0;
+  }
+#elif defined(__ARM_NEON__)
+  if (hopSize % 4 != 0) {
+    return 0;
+  }
+#endif
+  size_t count = frame_extract_count(length, frameSize, hopSize);
+  for (size_t f = 0; f < count; f++) {
+    frames[f] = src + f * hopSize;
+  }
+  return 1;
+}
+
+/// @brief The header prepended to every pooled block. It occupies a whole
+/// alignment unit so that the user part keeps the malloc_aligned()
+/// guarantees.
+typedef struct PoolBlock {
+  /// The next cached block of the same bucket (valid while in the list).
+  struct PoolBlock *next;
+  /// The size class of the block, or -1 if it is too big to be cached.
+  int bucket;
+  /// Catches blocks which were not allocated through the pool.
+  uint32_t magic;
+} PoolBlock;
+
+#define POOL_HEADER_SIZE 64
+#define POOL_MIN_LOG 6
+#define POOL_MAX_LOG 28
+#define POOL_BUCKET_COUNT (POOL_MAX_LOG - POOL_MIN_LOG + 1)
+#define POOL_MAGIC 0x6c6f6f70u
+
+static int pool_enabled = 0;
+static __thread PoolBlock *pool_free_lists[POOL_BUCKET_COUNT];
+
+void mallocf_pool_enable(int enabled) {
+  pool_enabled = enabled;
+}
+
+static int pool_bucket(size_t size) {
+  int log = POOL_MIN_LOG;
+  while (log <= POOL_MAX_LOG && ((size_t)1 << log) < size) {
+    log++;
+  }
+  return log > POOL_MAX_LOG? -1 : log - POOL_MIN_LOG;
+}
+
 float *mallocf(size_t length) {
-  return malloc_aligned(length * sizeof(float));
+  size_t size = length * sizeof(float);
+  if (!pool_enabled) {
+    return malloc_aligned(size);
+  }
+  int bucket = pool_bucket(size);
+  PoolBlock *block;
+  if (bucket >= 0 && (block = pool_free_lists[bucket]) != NULL) {
+    pool_free_lists[bucket] = block->next;
+    return (float *)((char *)block + POOL_HEADER_SIZE);
+  }
+  block = malloc_aligned(
+      POOL_HEADER_SIZE +
+      (bucket >= 0? (size_t)1 << (bucket + POOL_MIN_LOG) : size));
+  if (block == NULL) {
+    return NULL;
+  }
+  block->bucket = bucket;
+  block->magic = POOL_MAGIC;
+  return (float *)((char *)block + POOL_HEADER_SIZE);
+}
+
+void freef(float *ptr) {
+  if (ptr == NULL) {
+    return;
+  }
+  if (!pool_enabled) {
+    free(ptr);
+    return;
+  }
+  PoolBlock *block = (PoolBlock *)((char *)ptr - POOL_HEADER_SIZE);
+  assert(block->magic == POOL_MAGIC);
+  if (block->bucket < 0) {
+    free(block);
+    return;
+  }
+  block->next = pool_free_lists[block->bucket];
+  pool_free_lists[block->bucket] = block;
+}
+
+void mallocf_pool_drain(void) {
+  for (int i = 0; i < POOL_BUCKET_COUNT; i++) {
+    PoolBlock *block = pool_free_lists[i];
+    while (block != NULL) {
+      PoolBlock *next = block->next;
+      free(block);
+      block = next;
+    }
+    pool_free_lists[i] = NULL;
+  }
+}
+
+SimdArena simd_arena_create(size_t size) {
+  SimdArena arena;
+  arena.base = malloc_aligned(size);
+  arena.size = size;
+  arena.used = 0;
+  return arena;
+}
+
+void *simd_arena_alloc(SimdArena *arena, size_t size) {
+  assert(arena->base != NULL);
+  // Every block starts at a multiple of 64 bytes, the same alignment
+  // malloc_aligned() guarantees.
+  size = (size + 63) & ~(size_t)63;
+  assert(arena->used + size <= arena->size);
+  void *ptr = arena->base + arena->used;
+  arena->used += size;
+  return ptr;
+}
+
+void simd_arena_reset(SimdArena *arena) {
+  arena->used = 0;
+}
+
+void simd_arena_destroy(SimdArena *arena) {
+  free(arena->base);
+  arena->base = NULL;
+  arena->size = 0;
+  arena->used = 0;
 }
 
+#ifdef __AVX__
+/// @brief Fills larger than this (in float-s) are written with non-temporal
+/// stores: such buffers do not fit in the last level cache anyway, and
+/// regular stores would evict everything else from it.
+#define STREAM_STORE_THRESHOLD (1 << 20)
+#endif
+
 void memsetf(float *ptr, float value, size_t length) {
+#ifdef __AVX512F__
+  if (simd_avx512_available() && length < STREAM_STORE_THRESHOLD) {
+    const __m512 fillvec512 = _mm512_set1_ps(value);
+    size_t i;
+    for (i = 0; i + 16 <= length; i += 16) {
+      _mm512_storeu_ps(ptr + i, fillvec512);
+    }
+    if (i < length) {
+      __mmask16 mask = (__mmask16)((1u << (length - i)) - 1);
+      _mm512_mask_storeu_ps(ptr + i, mask, fillvec512);
+    }
+    return;
+  }
+#endif
 #ifdef __AVX__
   const __m256 fillvec = _mm256_set1_ps(value);
   size_t startIndex = align_complement_f32(ptr);
@@ -99,8 +438,15 @@ void memsetf(float *ptr, float value, size_t length) {
     ptr[i] = value;
   }
 
-  for (int i = (int)startIndex; i < (int)length - 7; i += 8) {
-    _mm256_store_ps(ptr + i, fillvec);
+  if (length - startIndex >= STREAM_STORE_THRESHOLD) {
+    for (int i = (int)startIndex; i < (int)length - 7; i += 8) {
+      _mm256_stream_ps(ptr + i, fillvec);
+    }
+    _mm_sfence();
+  } else {
+    for (int i = (int)startIndex; i < (int)length - 7; i += 8) {
+      _mm256_store_ps(ptr + i, fillvec);
+    }
   }
 
   for (size_t i = startIndex + ((length - startIndex) & ~0x7);
@@ -122,6 +468,74 @@ void memsetf(float *ptr, float value, size_t length) {
 #endif
 }
 
+/// @brief The shared state of a memsetf_parallel() dispatch: each task
+/// derives its own slice from the index it receives.
+typedef struct {
+  float *ptr;
+  float value;
+  size_t length;
+  size_t slices;
+} MemsetfParallelContext;
+
+/// @brief One page in float-s: the slice boundaries are rounded to it so
+/// that no two threads fault the same page (first-touch placement).
+#define MEMSETF_PAGE_FLOATS 1024
+
+static void memsetf_parallel_task(size_t index, void *user) {
+  MemsetfParallelContext *ctx = user;
+  size_t pages = (ctx->length + MEMSETF_PAGE_FLOATS - 1) /
+      MEMSETF_PAGE_FLOATS;
+  size_t begin = pages * index / ctx->slices * MEMSETF_PAGE_FLOATS;
+  size_t end = pages * (index + 1) / ctx->slices * MEMSETF_PAGE_FLOATS;
+  if (end > ctx->length) {
+    end = ctx->length;
+  }
+  if (end > begin) {
+    memsetf(ctx->ptr + begin, ctx->value, end - begin);
+  }
+}
+
+void memsetf_parallel(float *ptr, float value, size_t length, int threads) {
+  assert(ptr != NULL);
+  if (threads <= 0) {
+    threads = simd_get_num_threads();
+  }
+  if (threads == 1 || length <= MEMSETF_PAGE_FLOATS) {
+    memsetf(ptr, value, length);
+    return;
+  }
+  MemsetfParallelContext ctx = { ptr, value, length, (size_t)threads };
+  simd_parallel_for(memsetf_parallel_task, ctx.slices, &ctx);
+}
+
+float *memcpyf_stream(float *__restrict dest,
+                      const float *__restrict src, size_t length) {
+#ifdef __AVX__
+  size_t startIndex = align_complement_f32(dest);
+  if (startIndex > length) {
+    startIndex = length;
+  }
+
+  for (size_t i = 0; i < startIndex; i++) {
+    dest[i] = src[i];
+  }
+
+  for (int i = (int)startIndex; i < (int)length - 7; i += 8) {
+    _mm256_stream_ps(dest + i, _mm256_loadu_ps(src + i));
+  }
+  _mm_sfence();
+
+  for (size_t i = startIndex + ((length - startIndex) & ~0x7);
+      i < length; i++) {
+    dest[i] = src[i];
+  }
+#else
+  // No non-temporal stores before ARMv8, so this degenerates to memcpy()
+  memcpy(dest, src, length * sizeof(float));
+#endif
+  return dest;
+}
+
 float *zeropadding(const float *ptr, size_t length, size_t *newLength) {
   return zeropaddingex(ptr, length, newLength, 0);
 }
@@ -141,6 +555,14 @@ float *zeropaddingex(const float *ptr, size_t length, size_t *newLength,
   return ret;
 }
 
+float *zeropadding_to(float *dst, size_t dstLength,
+                      const float *src, size_t srcLength) {
+  assert(srcLength <= dstLength);
+  memcpy(dst, src, srcLength * sizeof(float));
+  memsetf(dst + srcLength, 0.f, dstLength - srcLength);
+  return dst;
+}
+
 float *rmemcpyf(float *__restrict dest,
                 const float *__restrict src, size_t length) {
 #ifdef __AVX__
@@ -175,9 +597,37 @@ float *rmemcpyf(float *__restrict dest,
 
 float *crmemcpyf(float *__restrict dest,
                  const float *__restrict src, size_t length) {
+#ifdef __AVX__
+  for (int i = 0; i < (int)length - 7; i += 8) {
+    __m256 vec = _mm256_loadu_ps(src + i);
+    // Swap the 128-bit halves, then the complex pairs inside each half,
+    // keeping the (re, im) order within every pair
+    vec = _mm256_permute2f128_ps(vec, vec, 1);
+    vec = _mm256_permute_ps(vec, 0x4E);
+    _mm256_storeu_ps(dest + length - i - 8, vec);
+  }
+
+  for (size_t i = (length & ~0x7); i < length; i += 2) {
+    dest[length - i - 2] = src[i];
+    dest[length - i - 1] = src[i + 1];
+  }
+#elif defined(__ARM_NEON__)
+  for (int i = 0; i < (int)length - 3; i += 4) {
+    float32x4_t vec = vld1q_f32(src + i);
+    // Swapping the 64-bit halves swaps the two complex pairs
+    vec = vcombine_f32(vget_high_f32(vec), vget_low_f32(vec));
+    vst1q_f32(dest + length - i - 4, vec);
+  }
+
+  for (size_t i = (length & ~0x3); i < length; i += 2) {
+    dest[length - i - 2] = src[i];
+    dest[length - i - 1] = src[i + 1];
+  }
+#else
   for (size_t i = 0; i < length; i += 2) {
     dest[i] = src[length - i - 2];
     dest[i + 1] = src[length - i - 1];
   }
+#endif
   return dest;
 }
@@ -30,10 +30,18 @@
 
 #define IMPLEMENTATION
 #include "inc/simd/normalize.h"
+#ifndef __USE_XOPEN2K
+#define __USE_XOPEN2K
+#endif
 #include <assert.h>
 #include <float.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
 #include <simd/instruction_set.h>
 #include <simd/memory.h>
+#include <simd/parallel.h>
+#include <simd/stats.h>
 
 #ifdef __ARM_NEON__
 
@@ -99,6 +107,95 @@ static void normalize2D_minmax_neon(uint8_t min, uint8_t max,
   }
 }
 
+static void normalize2D_minmax_i16_neon(uint8_t min, uint8_t max,
+                                        const uint8_t* src, int src_stride,
+                                        int width, int height,
+                                        int16_t* dst, int dst_stride) {
+  if (max == min) {
+    for (int y = 0; y < height; y++) {
+      memset(dst + y * dst_stride, 0, width * sizeof(int16_t));
+    }
+    return;
+  }
+  const uint8x16_t min_vec = vdupq_n_u8(min);
+  float diff = (max - min) / 2.f;
+  const float32x4_t diff_vec = vdupq_n_f32(32767.f / diff);
+  const float32x4_t sub_vec = vdupq_n_f32(32767.f);
+  const uint32x4_t sign_mask = vdupq_n_u32(0x80000000u);
+  const uint32x4_t half_bits = vdupq_n_u32(0x3F000000u);  // 0.5f
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width - 15; x += 16) {
+      uint8x16_t vec = vld1q_u8(src + y * src_stride + x);
+      vec = vsubq_u8(vec, min_vec);
+      uint16x8_t vec16lo = vmovl_u8(vget_low_u8(vec));
+      uint16x8_t vec16hi = vmovl_u8(vget_high_u8(vec));
+      int16_t* dst_ptr = dst + y * dst_stride + x;
+      uint16x8_t halves[2] = { vec16lo, vec16hi };
+      for (int part = 0; part < 2; part++) {
+        float32x4_t flo = vcvtq_f32_u32(vmovl_u16(vget_low_u16(
+            halves[part])));
+        float32x4_t fhi = vcvtq_f32_u32(vmovl_u16(vget_high_u16(
+            halves[part])));
+        flo = vsubq_f32(vmulq_f32(flo, diff_vec), sub_vec);
+        fhi = vsubq_f32(vmulq_f32(fhi, diff_vec), sub_vec);
+        // Round half away from zero: add copysign(0.5f, x) and truncate
+        float32x4_t rlo = vreinterpretq_f32_u32(vorrq_u32(
+            vandq_u32(vreinterpretq_u32_f32(flo), sign_mask), half_bits));
+        float32x4_t rhi = vreinterpretq_f32_u32(vorrq_u32(
+            vandq_u32(vreinterpretq_u32_f32(fhi), sign_mask), half_bits));
+        int32x4_t ilo = vcvtq_s32_f32(vaddq_f32(flo, rlo));
+        int32x4_t ihi = vcvtq_s32_f32(vaddq_f32(fhi, rhi));
+        vst1q_s16(dst_ptr + part * 8,
+                  vcombine_s16(vqmovn_s32(ilo), vqmovn_s32(ihi)));
+      }
+    }
+    for (int x = width & ~0xF; x < width; x++) {
+      float val = ((src[y * src_stride + x] - min) / diff - 1.f) * 32767.f;
+      val += val >= 0? 0.5f : -0.5f;
+      if (val > 32767.f) {
+        val = 32767.f;
+      } else if (val < -32768.f) {
+        val = -32768.f;
+      }
+      dst[y * dst_stride + x] = (int16_t)val;
+    }
+  }
+}
+
+static void deinterleave_rgb_neon(const uint8_t* src, size_t pixels,
+                                  uint8_t* r, uint8_t* g, uint8_t* b) {
+  size_t i = 0;
+  for (; i + 16 <= pixels; i += 16) {
+    uint8x16x3_t rgb = vld3q_u8(src + i * 3);
+    vst1q_u8(r + i, rgb.val[0]);
+    vst1q_u8(g + i, rgb.val[1]);
+    vst1q_u8(b + i, rgb.val[2]);
+  }
+  for (; i < pixels; i++) {
+    r[i] = src[i * 3];
+    g[i] = src[i * 3 + 1];
+    b[i] = src[i * 3 + 2];
+  }
+}
+
+static void interleave_rgb_neon(const uint8_t* r, const uint8_t* g,
+                                const uint8_t* b, size_t pixels,
+                                uint8_t* dst) {
+  size_t i = 0;
+  for (; i + 16 <= pixels; i += 16) {
+    uint8x16x3_t rgb;
+    rgb.val[0] = vld1q_u8(r + i);
+    rgb.val[1] = vld1q_u8(g + i);
+    rgb.val[2] = vld1q_u8(b + i);
+    vst3q_u8(dst + i * 3, rgb);
+  }
+  for (; i < pixels; i++) {
+    dst[i * 3] = r[i];
+    dst[i * 3 + 1] = g[i];
+    dst[i * 3 + 2] = b[i];
+  }
+}
+
 static void minmax2D_neon(const uint8_t* src, int src_stride,
                           int width, int height,
                           uint8_t* min_ptr, uint8_t* max_ptr) {
@@ -203,6 +300,72 @@ static void minmax1D_neon(const float* src, int length,
   }
 }
 
+static void argminmax1D_neon(const float* src, int length,
+                             float* min_ptr, int* min_idx_ptr,
+                             float* max_ptr, int* max_idx_ptr) {
+  float32x4_t min_vec = vdupq_n_f32(src[0]), max_vec = min_vec;
+  uint32x4_t min_idx_vec = vdupq_n_u32(0), max_idx_vec = vdupq_n_u32(0);
+  const uint32x4_t step = vdupq_n_u32(4);
+  uint32x4_t idx_vec = { 0, 1, 2, 3 };
+  for (int i = 0; i < length - 3; i += 4) {
+    float32x4_t vec = vld1q_f32(src + i);
+    uint32x4_t less = vcltq_f32(vec, min_vec);
+    min_vec = vminq_f32(vec, min_vec);
+    min_idx_vec = vbslq_u32(less, idx_vec, min_idx_vec);
+    uint32x4_t greater = vcgtq_f32(vec, max_vec);
+    max_vec = vmaxq_f32(vec, max_vec);
+    max_idx_vec = vbslq_u32(greater, idx_vec, max_idx_vec);
+    idx_vec = vaddq_u32(idx_vec, step);
+  }
+
+  // Gather the results, breaking value ties in favor of the lower index
+  float min_arr[4] __attribute__((aligned(64))),
+      max_arr[4] __attribute__((aligned(64)));
+  uint32_t min_idx_arr[4] __attribute__((aligned(64))),
+      max_idx_arr[4] __attribute__((aligned(64)));
+  vst1q_f32(min_arr, min_vec);
+  vst1q_f32(max_arr, max_vec);
+  vst1q_u32(min_idx_arr, min_idx_vec);
+  vst1q_u32(max_idx_arr, max_idx_vec);
+  float min = min_arr[0], max = max_arr[0];
+  int min_idx = min_idx_arr[0], max_idx = max_idx_arr[0];
+  for (int i = 1; i < 4; i++) {
+    if (min_arr[i] < min ||
+        (min_arr[i] == min && (int)min_idx_arr[i] < min_idx)) {
+      min = min_arr[i];
+      min_idx = min_idx_arr[i];
+    }
+    if (max_arr[i] > max ||
+        (max_arr[i] == max && (int)max_idx_arr[i] < max_idx)) {
+      max = max_arr[i];
+      max_idx = max_idx_arr[i];
+    }
+  }
+  for (int i = length & ~0x3; i < length; i++) {
+    if (src[i] < min) {
+      min = src[i];
+      min_idx = i;
+    }
+    if (src[i] > max) {
+      max = src[i];
+      max_idx = i;
+    }
+  }
+
+  if (min_ptr) {
+    *min_ptr = min;
+  }
+  if (min_idx_ptr) {
+    *min_idx_ptr = min_idx;
+  }
+  if (max_ptr) {
+    *max_ptr = max;
+  }
+  if (max_idx_ptr) {
+    *max_idx_ptr = max_idx;
+  }
+}
+
 #endif
 
 
@@ -261,6 +424,153 @@ static void normalize2D_minmax_sse(uint8_t min, uint8_t max,
   }
 }
 
+static void normalize2D_minmax_i16_sse(uint8_t min, uint8_t max,
+                                       const uint8_t* src, int src_stride,
+                                       int width, int height,
+                                       int16_t* dst, int dst_stride) {
+  if (max == min) {
+    for (int y = 0; y < height; y++) {
+      memset(dst + y * dst_stride, 0, width * sizeof(int16_t));
+    }
+    return;
+  }
+  const __m128i min_vec = _mm_set1_epi8(min);
+  float diff = (max - min) / 2.f;
+  const __m128 diff_vec = _mm_set1_ps(32767.f / diff);
+  const __m128 sub_vec = _mm_set1_ps(32767.f);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width - 15; x += 16) {
+      __m128i vec = _mm_loadu_si128((const __m128i*)(src + y * src_stride + x));
+      vec = _mm_subs_epu8(vec, min_vec);
+      __m128i intlo = _mm_unpacklo_epi8(vec, _mm_set1_epi8(0));
+      __m128i inthi = _mm_unpackhi_epi8(vec, _mm_set1_epi8(0));
+      __m128i intlolo = _mm_unpacklo_epi16(intlo, _mm_set1_epi16(0));
+      __m128i intlohi = _mm_unpackhi_epi16(intlo, _mm_set1_epi16(0));
+      __m128i inthilo = _mm_unpacklo_epi16(inthi, _mm_set1_epi16(0));
+      __m128i inthihi = _mm_unpackhi_epi16(inthi, _mm_set1_epi16(0));
+
+      __m128 flolo = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(intlolo),
+                                           diff_vec), sub_vec);
+      __m128 flohi = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(intlohi),
+                                           diff_vec), sub_vec);
+      __m128 fhilo = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(inthilo),
+                                           diff_vec), sub_vec);
+      __m128 fhihi = _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(inthihi),
+                                           diff_vec), sub_vec);
+
+      // _mm_cvtps_epi32 rounds to nearest; _mm_packs_epi32 saturates
+      __m128i packedlo = _mm_packs_epi32(_mm_cvtps_epi32(flolo),
+                                         _mm_cvtps_epi32(flohi));
+      __m128i packedhi = _mm_packs_epi32(_mm_cvtps_epi32(fhilo),
+                                         _mm_cvtps_epi32(fhihi));
+      int16_t* dst_ptr = dst + y * dst_stride + x;
+      _mm_storeu_si128((__m128i*)dst_ptr, packedlo);
+      _mm_storeu_si128((__m128i*)(dst_ptr + 8), packedhi);
+    }
+    for (int x = width & ~0xF; x < width; x++) {
+      float val = ((src[y * src_stride + x] - min) / diff - 1.f) * 32767.f;
+      val = rintf(val);
+      if (val > 32767.f) {
+        val = 32767.f;
+      } else if (val < -32768.f) {
+        val = -32768.f;
+      }
+      dst[y * dst_stride + x] = (int16_t)val;
+    }
+  }
+}
+
+static void deinterleave_rgb_sse(const uint8_t* src, size_t pixels,
+                                 uint8_t* r, uint8_t* g, uint8_t* b) {
+  const __m128i r0m = _mm_setr_epi8(0, 3, 6, 9, 12, 15, -1, -1,
+                                    -1, -1, -1, -1, -1, -1, -1, -1);
+  const __m128i r1m = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, 2, 5,
+                                    8, 11, 14, -1, -1, -1, -1, -1);
+  const __m128i r2m = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+                                    -1, -1, -1, 1, 4, 7, 10, 13);
+  const __m128i g0m = _mm_setr_epi8(1, 4, 7, 10, 13, -1, -1, -1,
+                                    -1, -1, -1, -1, -1, -1, -1, -1);
+  const __m128i g1m = _mm_setr_epi8(-1, -1, -1, -1, -1, 0, 3, 6,
+                                    9, 12, 15, -1, -1, -1, -1, -1);
+  const __m128i g2m = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+                                    -1, -1, -1, 2, 5, 8, 11, 14);
+  const __m128i b0m = _mm_setr_epi8(2, 5, 8, 11, 14, -1, -1, -1,
+                                    -1, -1, -1, -1, -1, -1, -1, -1);
+  const __m128i b1m = _mm_setr_epi8(-1, -1, -1, -1, -1, 1, 4, 7,
+                                    10, 13, -1, -1, -1, -1, -1, -1);
+  const __m128i b2m = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+                                    -1, -1, 0, 3, 6, 9, 12, 15);
+  size_t i = 0;
+  for (; i + 16 <= pixels; i += 16) {
+    __m128i v0 = _mm_loadu_si128((const __m128i*)(src + i * 3));
+    __m128i v1 = _mm_loadu_si128((const __m128i*)(src + i * 3 + 16));
+    __m128i v2 = _mm_loadu_si128((const __m128i*)(src + i * 3 + 32));
+    __m128i rv = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(v0, r0m),
+                                           _mm_shuffle_epi8(v1, r1m)),
+                              _mm_shuffle_epi8(v2, r2m));
+    __m128i gv = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(v0, g0m),
+                                           _mm_shuffle_epi8(v1, g1m)),
+                              _mm_shuffle_epi8(v2, g2m));
+    __m128i bv = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(v0, b0m),
+                                           _mm_shuffle_epi8(v1, b1m)),
+                              _mm_shuffle_epi8(v2, b2m));
+    _mm_storeu_si128((__m128i*)(r + i), rv);
+    _mm_storeu_si128((__m128i*)(g + i), gv);
+    _mm_storeu_si128((__m128i*)(b + i), bv);
+  }
+  for (; i < pixels; i++) {
+    r[i] = src[i * 3];
+    g[i] = src[i * 3 + 1];
+    b[i] = src[i * 3 + 2];
+  }
+}
+
+static void interleave_rgb_sse(const uint8_t* r, const uint8_t* g,
+                               const uint8_t* b, size_t pixels,
+                               uint8_t* dst) {
+  const __m128i r0m = _mm_setr_epi8(0, -1, -1, 1, -1, -1, 2, -1,
+                                    -1, 3, -1, -1, 4, -1, -1, 5);
+  const __m128i g0m = _mm_setr_epi8(-1, 0, -1, -1, 1, -1, -1, 2,
+                                    -1, -1, 3, -1, -1, 4, -1, -1);
+  const __m128i b0m = _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1,
+                                    2, -1, -1, 3, -1, -1, 4, -1);
+  const __m128i r1m = _mm_setr_epi8(-1, -1, 6, -1, -1, 7, -1, -1,
+                                    8, -1, -1, 9, -1, -1, 10, -1);
+  const __m128i g1m = _mm_setr_epi8(5, -1, -1, 6, -1, -1, 7, -1,
+                                    -1, 8, -1, -1, 9, -1, -1, 10);
+  const __m128i b1m = _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7,
+                                    -1, -1, 8, -1, -1, 9, -1, -1);
+  const __m128i r2m = _mm_setr_epi8(-1, 11, -1, -1, 12, -1, -1, 13,
+                                    -1, -1, 14, -1, -1, 15, -1, -1);
+  const __m128i g2m = _mm_setr_epi8(-1, -1, 11, -1, -1, 12, -1, -1,
+                                    13, -1, -1, 14, -1, -1, 15, -1);
+  const __m128i b2m = _mm_setr_epi8(10, -1, -1, 11, -1, -1, 12, -1,
+                                    -1, 13, -1, -1, 14, -1, -1, 15);
+  size_t i = 0;
+  for (; i + 16 <= pixels; i += 16) {
+    __m128i rv = _mm_loadu_si128((const __m128i*)(r + i));
+    __m128i gv = _mm_loadu_si128((const __m128i*)(g + i));
+    __m128i bv = _mm_loadu_si128((const __m128i*)(b + i));
+    __m128i v0 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(rv, r0m),
+                                           _mm_shuffle_epi8(gv, g0m)),
+                              _mm_shuffle_epi8(bv, b0m));
+    __m128i v1 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(rv, r1m),
+                                           _mm_shuffle_epi8(gv, g1m)),
+                              _mm_shuffle_epi8(bv, b1m));
+    __m128i v2 = _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(rv, r2m),
+                                           _mm_shuffle_epi8(gv, g2m)),
+                              _mm_shuffle_epi8(bv, b2m));
+    _mm_storeu_si128((__m128i*)(dst + i * 3), v0);
+    _mm_storeu_si128((__m128i*)(dst + i * 3 + 16), v1);
+    _mm_storeu_si128((__m128i*)(dst + i * 3 + 32), v2);
+  }
+  for (; i < pixels; i++) {
+    dst[i * 3] = r[i];
+    dst[i * 3 + 1] = g[i];
+    dst[i * 3 + 2] = b[i];
+  }
+}
+
 static void minmax2D_sse(const uint8_t* src, int src_stride,
                          int width, int height,
                          uint8_t* min_ptr, uint8_t* max_ptr) {
@@ -375,6 +685,75 @@ static void minmax1D_avx(const float* src, int length,
     *max_ptr = max;
   }
 }
+static void argminmax1D_avx(const float* src, int length,
+                            float* min_ptr, int* min_idx_ptr,
+                            float* max_ptr, int* max_idx_ptr) {
+  assert(length > 0);
+  // Lane indices are carried as float-s (exact up to 2^24), which keeps
+  // the blends inside AVX1
+  assert(length < (1 << 24));
+  __m256 min_vec = _mm256_set1_ps(src[0]), max_vec = min_vec;
+  __m256 min_idx_vec = _mm256_setzero_ps(), max_idx_vec = min_idx_vec;
+  const __m256 step = _mm256_set1_ps(8.f);
+  __m256 idx_vec = _mm256_set_ps(7.f, 6.f, 5.f, 4.f, 3.f, 2.f, 1.f, 0.f);
+  for (int i = 0; i < length - 7; i += 8) {
+    __m256 vec = _mm256_loadu_ps(src + i);
+    __m256 less = _mm256_cmp_ps(vec, min_vec, _CMP_LT_OQ);
+    min_vec = _mm256_min_ps(vec, min_vec);
+    min_idx_vec = _mm256_blendv_ps(min_idx_vec, idx_vec, less);
+    __m256 greater = _mm256_cmp_ps(vec, max_vec, _CMP_GT_OQ);
+    max_vec = _mm256_max_ps(vec, max_vec);
+    max_idx_vec = _mm256_blendv_ps(max_idx_vec, idx_vec, greater);
+    idx_vec = _mm256_add_ps(idx_vec, step);
+  }
+
+  // Gather the results, breaking value ties in favor of the lower index
+  float min_arr[8] __attribute__((aligned(64))),
+      max_arr[8] __attribute__((aligned(64))),
+      min_idx_arr[8] __attribute__((aligned(64))),
+      max_idx_arr[8] __attribute__((aligned(64)));
+  _mm256_store_ps(min_arr, min_vec);
+  _mm256_store_ps(max_arr, max_vec);
+  _mm256_store_ps(min_idx_arr, min_idx_vec);
+  _mm256_store_ps(max_idx_arr, max_idx_vec);
+  float min = min_arr[0], max = max_arr[0];
+  int min_idx = (int)min_idx_arr[0], max_idx = (int)max_idx_arr[0];
+  for (int i = 1; i < 8; i++) {
+    if (min_arr[i] < min ||
+        (min_arr[i] == min && (int)min_idx_arr[i] < min_idx)) {
+      min = min_arr[i];
+      min_idx = (int)min_idx_arr[i];
+    }
+    if (max_arr[i] > max ||
+        (max_arr[i] == max && (int)max_idx_arr[i] < max_idx)) {
+      max = max_arr[i];
+      max_idx = (int)max_idx_arr[i];
+    }
+  }
+  for (int i = length & ~0x7; i < length; i++) {
+    if (src[i] < min) {
+      min = src[i];
+      min_idx = i;
+    }
+    if (src[i] > max) {
+      max = src[i];
+      max_idx = i;
+    }
+  }
+
+  if (min_ptr) {
+    *min_ptr = min;
+  }
+  if (min_idx_ptr) {
+    *min_idx_ptr = min_idx;
+  }
+  if (max_ptr) {
+    *max_ptr = max;
+  }
+  if (max_idx_ptr) {
+    *max_idx_ptr = max_idx;
+  }
+}
 #endif  // __AVX__
 
 #endif  // __SSE2__
@@ -399,6 +778,52 @@ static void normalize2D_minmax_novec(uint8_t min, uint8_t max,
   }
 }
 
+static void normalize2D_minmax_i16_novec(uint8_t min, uint8_t max,
+                                         const uint8_t* src, int src_stride,
+                                         int width, int height,
+                                         int16_t* dst, int dst_stride) {
+  if (max == min) {
+    for (int y = 0; y < height; y++) {
+      for (int x = 0; x < width; x++) {
+        dst[y * dst_stride + x] = 0;
+      }
+    }
+    return;
+  }
+  float diff = (max - min) / 2.f;
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      float val = ((src[y * src_stride + x] - min) / diff - 1.f) * 32767.f;
+      val = rintf(val);
+      if (val > 32767.f) {
+        val = 32767.f;
+      } else if (val < -32768.f) {
+        val = -32768.f;
+      }
+      dst[y * dst_stride + x] = (int16_t)val;
+    }
+  }
+}
+
+static void deinterleave_rgb_novec(const uint8_t* src, size_t pixels,
+                                   uint8_t* r, uint8_t* g, uint8_t* b) {
+  for (size_t i = 0; i < pixels; i++) {
+    r[i] = src[i * 3];
+    g[i] = src[i * 3 + 1];
+    b[i] = src[i * 3 + 2];
+  }
+}
+
+static void interleave_rgb_novec(const uint8_t* r, const uint8_t* g,
+                                 const uint8_t* b, size_t pixels,
+                                 uint8_t* dst) {
+  for (size_t i = 0; i < pixels; i++) {
+    dst[i * 3] = r[i];
+    dst[i * 3 + 1] = g[i];
+    dst[i * 3 + 2] = b[i];
+  }
+}
+
 static void minmax2D_novec(const uint8_t* src, int src_stride,
                            int width, int height,
                            uint8_t* min_ptr, uint8_t* max_ptr) {
@@ -442,35 +867,365 @@ static void minmax1D_novec(const float* src, int length,
   }
 }
 
+static void minmax2D_serial(int simd, const uint8_t* src, int src_stride,
+                            int width, int height,
+                            uint8_t* min, uint8_t* max) {
+  if (simd) {
+#ifdef __ARM_NEON__
+    minmax2D_neon(src, src_stride, width, height, min, max);
+  } else {
+#elif defined(__SSE2__)
+    minmax2D_sse(src, src_stride, width, height, min, max);
+  } else {
+#else
+  } {
+#endif
+    minmax2D_novec(src, src_stride, width, height, min, max);
+  }
+}
+
+static void normalize2D_minmax_serial(int simd, uint8_t min, uint8_t max,
+                                      const uint8_t* src, int src_stride,
+                                      int width, int height,
+                                      float* dst, int dst_stride) {
+  if (simd) {
+#ifdef __ARM_NEON__
+    normalize2D_minmax_neon(min, max, src, src_stride, width, height,
+                            dst, dst_stride);
+  } else {
+#elif defined(__SSE2__)
+    normalize2D_minmax_sse(min, max, src, src_stride, width, height,
+                           dst, dst_stride);
+  } else {
+#else
+  } {
+#endif
+    normalize2D_minmax_novec(min, max, src, src_stride, width, height,
+                             dst, dst_stride);
+  }
+}
+
+// The threaded mode hands each worker a horizontal panel of rows. The
+// count is a process-wide setting like matrix_set_threads().
+static int normalize_threads = 1;
+
+// A panel shorter than this is not worth a thread
+#define NORMALIZE_THREAD_MIN_ROWS 64
+
+void normalize_set_threads(int threads) {
+  assert(threads >= 1);
+  normalize_threads = threads;
+}
+
+typedef struct NormalizeWorker {
+  int simd;
+  const uint8_t *src;
+  int src_stride;
+  int width;
+  int rows;
+  float *dst;  ///< NULL means scan the panel for min/max only.
+  int dst_stride;
+  uint8_t min;
+  uint8_t max;
+  const struct NormalizeWorker *peers;
+  int peer_count;
+  pthread_barrier_t *barrier;
+} NormalizeWorker;
+
+static void *normalize2D_worker(void *arg) {
+  NormalizeWorker *ctx = arg;
+  minmax2D_serial(ctx->simd, ctx->src, ctx->src_stride, ctx->width,
+                  ctx->rows, &ctx->min, &ctx->max);
+  if (!ctx->dst) {
+    return NULL;
+  }
+  // After the barrier every panel minimum and maximum is published, so
+  // each worker reduces them on its own and proceeds to the scaling pass
+  pthread_barrier_wait(ctx->barrier);
+  uint8_t min = ctx->peers[0].min, max = ctx->peers[0].max;
+  for (int i = 1; i < ctx->peer_count; i++) {
+    if (ctx->peers[i].min < min) {
+      min = ctx->peers[i].min;
+    }
+    if (ctx->peers[i].max > max) {
+      max = ctx->peers[i].max;
+    }
+  }
+  normalize2D_minmax_serial(ctx->simd, min, max, ctx->src, ctx->src_stride,
+                            ctx->width, ctx->rows, ctx->dst, ctx->dst_stride);
+  return NULL;
+}
+
+static void normalize2D_task(size_t index, void *user) {
+  normalize2D_worker(&((NormalizeWorker *)user)[index]);
+}
+
+// Cuts the plane into threads panels and runs them on the shared worker
+// pool; returns after every panel finished.
+static void normalize2D_distribute(int simd, const uint8_t* src,
+                                   int src_stride, int width, int height,
+                                   float* dst, int dst_stride,
+                                   pthread_barrier_t *barrier,
+                                   NormalizeWorker *contexts, int threads) {
+  int slice = (height + threads - 1) / threads;
+  for (int t = 0; t < threads; t++) {
+    int start = t * slice;
+    int rows = height - start < slice? height - start : slice;
+    contexts[t].simd = simd;
+    contexts[t].src = src + start * src_stride;
+    contexts[t].src_stride = src_stride;
+    contexts[t].width = width;
+    contexts[t].rows = rows;
+    contexts[t].dst = dst? dst + start * dst_stride : NULL;
+    contexts[t].dst_stride = dst_stride;
+    contexts[t].peers = contexts;
+    contexts[t].peer_count = threads;
+    contexts[t].barrier = barrier;
+  }
+  simd_parallel_for(normalize2D_task, threads, contexts);
+}
+
+static void argminmax1D_novec(const float* src, int length,
+                              float* min_ptr, int* min_idx_ptr,
+                              float* max_ptr, int* max_idx_ptr) {
+  float min = src[0], max = src[0];
+  int min_idx = 0, max_idx = 0;
+  for (int i = 1; i < length; i++) {
+    if (src[i] < min) {
+      min = src[i];
+      min_idx = i;
+    }
+    if (src[i] > max) {
+      max = src[i];
+      max_idx = i;
+    }
+  }
+  if (min_ptr) {
+    *min_ptr = min;
+  }
+  if (min_idx_ptr) {
+    *min_idx_ptr = min_idx;
+  }
+  if (max_ptr) {
+    *max_ptr = max;
+  }
+  if (max_idx_ptr) {
+    *max_idx_ptr = max_idx;
+  }
+}
+
 void normalize2D(int simd, const uint8_t* src, int src_stride,
                  int width, int height, float* dst, int dst_stride) {
-  uint8_t min, max;
-  minmax2D(simd, src, src_stride, width, height, &min, &max);
-  normalize2D_minmax(simd, min, max, src, src_stride, width, height,
-                     dst, dst_stride);
+  SIMD_STATS_START();
+  int threads = normalize_threads;
+  if (threads > height / NORMALIZE_THREAD_MIN_ROWS) {
+    threads = height / NORMALIZE_THREAD_MIN_ROWS;
+  }
+  if (threads <= 1) {
+    uint8_t min, max;
+    minmax2D(simd, src, src_stride, width, height, &min, &max);
+    normalize2D_minmax(simd, min, max, src, src_stride, width, height,
+                       dst, dst_stride);
+    SIMD_STATS_FINISH(SIMD_KERNEL_NORMALIZE, (uint64_t)width * height);
+    return;
+  }
+  assert(src);
+  assert(dst);
+  assert(src_stride >= width);
+  assert(dst_stride >= width);
+  NormalizeWorker *contexts = malloc(threads * sizeof(NormalizeWorker));
+  pthread_barrier_t barrier;
+  pthread_barrier_init(&barrier, NULL, threads);
+  normalize2D_distribute(simd, src, src_stride, width, height, dst,
+                         dst_stride, &barrier, contexts, threads);
+  pthread_barrier_destroy(&barrier);
+  free(contexts);
+  SIMD_STATS_FINISH(SIMD_KERNEL_NORMALIZE, (uint64_t)width * height);
 }
 
-void minmax2D(int simd, const uint8_t* src, int src_stride,
-              int width, int height, uint8_t* min, uint8_t* max) {
+// A tile of this many source bytes stays resident in the L2 cache
+// between the min/max scan and the scaling pass over it.
+#define NORMALIZE_TILE_SIZE (256 * 1024)
+
+void normalize2D_fused(int simd, const uint8_t* src, int src_stride,
+                       int width, int height, float* dst, int dst_stride,
+                       uint8_t* min, uint8_t* max) {
   assert(src);
+  assert(dst);
+  assert(min);
+  assert(max);
   assert(width > 0);
   assert(height > 0);
   assert(src_stride >= width);
-  if (!min && !max) {
-    return;
+  assert(dst_stride >= width);
+  assert(*min <= *max);
+  int tile_rows = NORMALIZE_TILE_SIZE / src_stride;
+  if (tile_rows < 1) {
+    tile_rows = 1;
   }
+  uint8_t range_min = *min, range_max = *max;
+  uint8_t found_min = src[0], found_max = src[0];
+  for (int y = 0; y < height; y += tile_rows) {
+    int rows = height - y < tile_rows? height - y : tile_rows;
+    uint8_t tile_min, tile_max;
+    minmax2D_serial(simd, src + y * src_stride, src_stride, width, rows,
+                    &tile_min, &tile_max);
+    if (tile_min < found_min) {
+      found_min = tile_min;
+    }
+    if (tile_max > found_max) {
+      found_max = tile_max;
+    }
+    // The tile is still cached, so this second traversal of it does not
+    // touch DRAM again
+    normalize2D_minmax_serial(simd, range_min, range_max,
+                              src + y * src_stride, src_stride, width, rows,
+                              dst + y * dst_stride, dst_stride);
+  }
+  *min = found_min;
+  *max = found_max;
+}
+
+void normalize2D_i16(int simd, const uint8_t* src, int src_stride,
+                     int width, int height, int16_t* dst, int dst_stride) {
+  assert(src);
+  assert(dst);
+  assert(width > 0);
+  assert(height > 0);
+  assert(src_stride >= width);
+  assert(dst_stride >= width);
+  uint8_t min, max;
+  minmax2D(simd, src, src_stride, width, height, &min, &max);
   if (simd) {
 #ifdef __ARM_NEON__
-    minmax2D_neon(src, src_stride, width, height, min, max);
+    normalize2D_minmax_i16_neon(min, max, src, src_stride, width, height,
+                                dst, dst_stride);
   } else {
 #elif defined(__SSE2__)
-    minmax2D_sse(src, src_stride, width, height, min, max);
+    normalize2D_minmax_i16_sse(min, max, src, src_stride, width, height,
+                               dst, dst_stride);
   } else {
 #else
   } {
 #endif
-    minmax2D_novec(src, src_stride, width, height, min, max);
+    normalize2D_minmax_i16_novec(min, max, src, src_stride, width, height,
+                                 dst, dst_stride);
+  }
+}
+
+void deinterleave_rgb(int simd, const uint8_t* src, size_t pixels,
+                      uint8_t* r, uint8_t* g, uint8_t* b) {
+  assert(src);
+  assert(r);
+  assert(g);
+  assert(b);
+  assert(pixels > 0);
+  if (simd) {
+#ifdef __ARM_NEON__
+    deinterleave_rgb_neon(src, pixels, r, g, b);
+  } else {
+#elif defined(__SSE2__)
+    deinterleave_rgb_sse(src, pixels, r, g, b);
+  } else {
+#else
+  } {
+#endif
+    deinterleave_rgb_novec(src, pixels, r, g, b);
+  }
+}
+
+void interleave_rgb(int simd, const uint8_t* r, const uint8_t* g,
+                    const uint8_t* b, size_t pixels, uint8_t* dst) {
+  assert(r);
+  assert(g);
+  assert(b);
+  assert(dst);
+  assert(pixels > 0);
+  if (simd) {
+#ifdef __ARM_NEON__
+    interleave_rgb_neon(r, g, b, pixels, dst);
+  } else {
+#elif defined(__SSE2__)
+    interleave_rgb_sse(r, g, b, pixels, dst);
+  } else {
+#else
+  } {
+#endif
+    interleave_rgb_novec(r, g, b, pixels, dst);
+  }
+}
+
+NormalizeStreamHandle normalize_stream_initialize(int rescan_interval,
+                                                  int decay) {
+  assert(rescan_interval >= 1);
+  assert(decay >= 0);
+  NormalizeStreamHandle handle;
+  handle.min = 0;
+  handle.max = 255;
+  handle.frames_left = 0;
+  handle.rescan_interval = rescan_interval;
+  handle.decay = decay;
+  return handle;
+}
+
+void normalize_stream_feed(NormalizeStreamHandle *handle, int simd,
+                           const uint8_t *src, int src_stride,
+                           int width, int height,
+                           float *dst, int dst_stride) {
+  assert(handle);
+  if (handle->frames_left <= 0) {
+    minmax2D(simd, src, src_stride, width, height,
+             &handle->min, &handle->max);
+    handle->frames_left = handle->rescan_interval;
+  } else {
+    // Widen the cached range so content drifting beyond it clips less
+    // until the next exact rescan
+    int min = handle->min - handle->decay;
+    int max = handle->max + handle->decay;
+    handle->min = min < 0? 0 : (uint8_t)min;
+    handle->max = max > 255? 255 : (uint8_t)max;
+  }
+  handle->frames_left--;
+  normalize2D_minmax(simd, handle->min, handle->max, src, src_stride,
+                     width, height, dst, dst_stride);
+}
+
+void minmax2D(int simd, const uint8_t* src, int src_stride,
+              int width, int height, uint8_t* min, uint8_t* max) {
+  assert(src);
+  assert(width > 0);
+  assert(height > 0);
+  assert(src_stride >= width);
+  if (!min && !max) {
+    return;
+  }
+  int threads = normalize_threads;
+  if (threads > height / NORMALIZE_THREAD_MIN_ROWS) {
+    threads = height / NORMALIZE_THREAD_MIN_ROWS;
   }
+  if (threads > 1) {
+    NormalizeWorker *contexts = malloc(threads * sizeof(NormalizeWorker));
+    normalize2D_distribute(simd, src, src_stride, width, height, NULL, 0,
+                           NULL, contexts, threads);
+    uint8_t rmin = contexts[0].min, rmax = contexts[0].max;
+    for (int t = 1; t < threads; t++) {
+      if (contexts[t].min < rmin) {
+        rmin = contexts[t].min;
+      }
+      if (contexts[t].max > rmax) {
+        rmax = contexts[t].max;
+      }
+    }
+    free(contexts);
+    if (min) {
+      *min = rmin;
+    }
+    if (max) {
+      *max = rmax;
+    }
+    return;
+  }
+  minmax2D_serial(simd, src, src_stride, width, height, min, max);
 }
 
 void normalize2D_minmax(int simd, uint8_t min, uint8_t max,
@@ -483,39 +1238,47 @@ void normalize2D_minmax(int simd, uint8_t min, uint8_t max,
   assert(src_stride >= width);
   assert(dst_stride >= width);
   assert(min <= max);
+  normalize2D_minmax_serial(simd, min, max, src, src_stride, width, height,
+                            dst, dst_stride);
+}
+
+void minmax1D(int simd, const float *src, int length, float *min, float *max) {
+  assert(src);
+  assert(length > 0);
+  if (!min && !max) {
+    return;
+  }
   if (simd) {
 #ifdef __ARM_NEON__
-    normalize2D_minmax_neon(min, max, src, src_stride, width, height,
-                            dst, dst_stride);
+    minmax1D_neon(src, length, min, max);
   } else {
 #elif defined(__SSE2__)
-    normalize2D_minmax_sse(min, max, src, src_stride, width, height,
-                           dst, dst_stride);
+    minmax1D_avx(src, length, min, max);
   } else {
 #else
   } {
 #endif
-    normalize2D_minmax_novec(min, max, src, src_stride, width, height,
-                             dst, dst_stride);
+    minmax1D_novec(src, length, min, max);
   }
 }
 
-void minmax1D(int simd, const float *src, int length, float *min, float *max) {
+void argminmax1D(int simd, const float *src, int length,
+                 float *min, int *min_idx, float *max, int *max_idx) {
   assert(src);
   assert(length > 0);
-  if (!min && !max) {
+  if (!min && !min_idx && !max && !max_idx) {
     return;
   }
   if (simd) {
 #ifdef __ARM_NEON__
-    minmax1D_neon(src, length, min, max);
+    argminmax1D_neon(src, length, min, min_idx, max, max_idx);
   } else {
 #elif defined(__SSE2__)
-    minmax1D_avx(src, length, min, max);
+    argminmax1D_avx(src, length, min, min_idx, max, max_idx);
   } else {
 #else
   } {
 #endif
-    minmax1D_novec(src, length, min, max);
+    argminmax1D_novec(src, length, min, min_idx, max, max_idx);
   }
 }
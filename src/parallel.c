@@ -0,0 +1,213 @@
+/*! @file parallel.c
+ *  @brief Library-wide persistent worker pool.
+ *  @author Markovtsev Vadim <v.markovtsev@samsung.com>
+ *  @version 1.0
+ *
+ *  @section Notes
+ *  This code partially conforms to <a href="http://google-styleguide.googlecode.com/svn/trunk/cppguide.xml">Google C++ Style Guide</a>.
+ *
+ *  @section Copyright
+ *  Copyright © 2013 Samsung R&D Institute Russia
+ *
+ *  @section License
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#define LIBSIMD_IMPLEMENTATION
+#ifdef __linux__
+// For the affinity API (cpu_set_t, pthread_setaffinity_np); this must
+// precede the first libc include
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <sched.h>
+#endif
+#include <simd/parallel.h>
+#include <assert.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+static pthread_mutex_t pool_mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_wakeup = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t pool_done = PTHREAD_COND_INITIALIZER;
+// Serializes the dispatches from different application threads, so only
+// one simd_parallel_for() at a time owns the job state below
+static pthread_mutex_t dispatch_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+static pthread_t *pool_threads = NULL;
+static int pool_size = 0;
+static int pool_shutdown = 0;
+static int num_threads = 0;  // 0 = not queried yet
+
+// The current job; valid while job_pending > 0
+static simd_parallel_func job_func;
+static void *job_user;
+static size_t job_count;
+static size_t job_next;
+static size_t job_pending;
+static unsigned job_generation = 0;
+
+static int default_num_threads(void) {
+#ifdef _SC_NPROCESSORS_ONLN
+  long count = sysconf(_SC_NPROCESSORS_ONLN);
+  return count > 0? (int)count : 1;
+#else
+  return 1;
+#endif
+}
+
+static void *pool_worker(void *arg) {
+  int worker_index = (int)(intptr_t)arg;
+#ifdef __linux__
+  // Pin each worker to its own CPU, so the warm threads do not migrate
+  // between frames. The caller keeps whatever affinity the application
+  // chose for it.
+  cpu_set_t cpuset;
+  CPU_ZERO(&cpuset);
+  CPU_SET((worker_index + 1) % default_num_threads(), &cpuset);
+  pthread_setaffinity_np(pthread_self(), sizeof(cpuset), &cpuset);
+#endif
+  unsigned seen_generation = 0;
+  pthread_mutex_lock(&pool_mutex);
+  for (;;) {
+    while (!pool_shutdown && job_generation == seen_generation) {
+      pthread_cond_wait(&pool_wakeup, &pool_mutex);
+    }
+    if (pool_shutdown) {
+      break;
+    }
+    seen_generation = job_generation;
+    if (job_next < job_count) {
+      size_t index = job_next++;
+      pthread_mutex_unlock(&pool_mutex);
+      job_func(index, job_user);
+      pthread_mutex_lock(&pool_mutex);
+      if (--job_pending == 0) {
+        pthread_cond_signal(&pool_done);
+      }
+    }
+  }
+  pthread_mutex_unlock(&pool_mutex);
+  return NULL;
+}
+
+// Joins every pool thread; called with dispatch_mutex held and no job
+// in flight.
+static void pool_stop(void) {
+  pthread_mutex_lock(&pool_mutex);
+  if (pool_size == 0) {
+    pthread_mutex_unlock(&pool_mutex);
+    return;
+  }
+  pool_shutdown = 1;
+  pthread_cond_broadcast(&pool_wakeup);
+  pthread_mutex_unlock(&pool_mutex);
+  for (int t = 0; t < pool_size; t++) {
+    pthread_join(pool_threads[t], NULL);
+  }
+  free(pool_threads);
+  pool_threads = NULL;
+  pool_size = 0;
+  pool_shutdown = 0;
+}
+
+static void pool_atexit(void) {
+  pthread_mutex_lock(&dispatch_mutex);
+  pool_stop();
+  pthread_mutex_unlock(&dispatch_mutex);
+}
+
+// Grows the pool to at least workers threads; called with dispatch_mutex
+// held and no job in flight.
+static void pool_ensure(int workers) {
+  if (pool_size >= workers) {
+    return;
+  }
+  if (pool_size == 0) {
+    static int atexit_registered = 0;
+    if (!atexit_registered) {
+      atexit(pool_atexit);
+      atexit_registered = 1;
+    }
+  }
+  pool_threads = realloc(pool_threads, workers * sizeof(pthread_t));
+  assert(pool_threads);
+  for (int t = pool_size; t < workers; t++) {
+    pthread_create(&pool_threads[t], NULL, pool_worker,
+                   (void *)(intptr_t)t);
+  }
+  pool_size = workers;
+}
+
+void simd_set_num_threads(int threads) {
+  assert(threads >= 1);
+  pthread_mutex_lock(&dispatch_mutex);
+  num_threads = threads;
+  if (threads - 1 < pool_size) {
+    // Shrink by restarting: the excess warm threads would otherwise hold
+    // on to their pinned CPUs forever
+    pool_stop();
+  }
+  if (threads > 1) {
+    pool_ensure(threads - 1);
+  }
+  pthread_mutex_unlock(&dispatch_mutex);
+}
+
+int simd_get_num_threads(void) {
+  pthread_mutex_lock(&dispatch_mutex);
+  if (num_threads == 0) {
+    num_threads = default_num_threads();
+  }
+  int result = num_threads;
+  pthread_mutex_unlock(&dispatch_mutex);
+  return result;
+}
+
+void simd_parallel_for(simd_parallel_func func, size_t count, void *user) {
+  assert(func);
+  if (count == 0) {
+    return;
+  }
+  if (count == 1) {
+    func(0, user);
+    return;
+  }
+  pthread_mutex_lock(&dispatch_mutex);
+  pool_ensure((int)count - 1);
+  pthread_mutex_lock(&pool_mutex);
+  job_func = func;
+  job_user = user;
+  job_count = count;
+  job_next = 1;  // the caller runs index 0 itself
+  job_pending = count;
+  job_generation++;
+  pthread_cond_broadcast(&pool_wakeup);
+  pthread_mutex_unlock(&pool_mutex);
+  func(0, user);
+  pthread_mutex_lock(&pool_mutex);
+  if (--job_pending > 0) {
+    do {
+      pthread_cond_wait(&pool_done, &pool_mutex);
+    } while (job_pending > 0);
+  }
+  pthread_mutex_unlock(&pool_mutex);
+  pthread_mutex_unlock(&dispatch_mutex);
+}
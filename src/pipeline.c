@@ -0,0 +1,347 @@
+/*! @file pipeline.c
+ *  @brief Fused kernel pipelines executed tile by tile.
+ *  @author Markovtsev Vadim <v.markovtsev@samsung.com>
+ *  @version 1.0
+ *
+ *  @section Notes
+ *  This code partially conforms to <a href="http://google-styleguide.googlecode.com/svn/trunk/cppguide.xml">Google C++ Style Guide</a>.
+ *
+ *  @section Copyright
+ *  Copyright © 2013 Samsung R&D Institute Russia
+ */
+
+#define LIBSIMD_IMPLEMENTATION
+#include "inc/simd/pipeline.h"
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+#include "inc/simd/arithmetic.h"
+#include <simd/memory.h>
+
+/// @brief The default tile length in float-s: two tiles (the ping-pong
+/// buffers) fit in half of a typical 256 KB L2, leaving the rest to the
+/// windows, FIR scratches and the input itself.
+#define PIPELINE_DEFAULT_TILE_SIZE 16384
+
+#define PIPELINE_MAX_STAGES 8
+
+typedef enum {
+  kPipelineStageInt16ToFloat,
+  kPipelineStageWindow,
+  kPipelineStageFir,
+  kPipelineStageScale,
+  kPipelineStageDetectPeaks
+} PipelineStageKind;
+
+typedef struct {
+  PipelineStageKind kind;
+  union {
+    struct {
+      const float *coeffs;
+      size_t length;
+    } window;
+    struct {
+      /// The filter coefficients in reversed order, so every output sample
+      /// is a plain dot_product() against the input history.
+      float *reversed;
+      size_t length;
+      /// The last (length - 1) input samples seen so far.
+      float *history;
+      /// history followed by the current tile.
+      float *scratch;
+    } fir;
+    struct {
+      float multiplier;
+      float offset;
+    } scale;
+    struct {
+      PeakDetectionStream stream;
+      ExtremumType type;
+    } peaks;
+  } params;
+} PipelineStage;
+
+struct SimdPipeline {
+  int simd;
+  size_t tile_size;
+  int stage_count;
+  PipelineStage stages[PIPELINE_MAX_STAGES];
+  /// The ping-pong tile buffers the stages read from and write to.
+  float *tiles[2];
+  ExtremumPoint *peaks;
+  size_t peaks_length;
+};
+
+static PipelineStage *pipeline_add_stage(SimdPipeline *pipeline,
+                                         PipelineStageKind kind) {
+  assert(pipeline);
+  assert(pipeline->stage_count < PIPELINE_MAX_STAGES);
+  // Nothing may follow the terminal peak detection stage
+  assert(pipeline->stage_count == 0 ||
+         pipeline->stages[pipeline->stage_count - 1].kind !=
+             kPipelineStageDetectPeaks);
+  PipelineStage *stage = &pipeline->stages[pipeline->stage_count++];
+  stage->kind = kind;
+  return stage;
+}
+
+SimdPipeline *simd_pipeline_initialize(int simd, size_t tileSize) {
+  // At least 3: with a cap of 2 an odd signal length cannot be tiled
+  // without a single trailing sample, which the peak carry cannot take
+  assert(tileSize == 0 || tileSize >= 3);
+  if (tileSize == 0) {
+    tileSize = PIPELINE_DEFAULT_TILE_SIZE;
+  }
+  SimdPipeline *pipeline = calloc(1, sizeof(*pipeline));
+  pipeline->simd = simd;
+  pipeline->tile_size = tileSize;
+  pipeline->tiles[0] = mallocf(tileSize);
+  pipeline->tiles[1] = mallocf(tileSize);
+  return pipeline;
+}
+
+void simd_pipeline_add_int16_to_float(SimdPipeline *pipeline) {
+  assert(pipeline);
+  // The conversion defines the input type, so it must come first
+  assert(pipeline->stage_count == 0);
+  pipeline_add_stage(pipeline, kPipelineStageInt16ToFloat);
+}
+
+void simd_pipeline_add_window(SimdPipeline *pipeline, const float *window,
+                              size_t length) {
+  assert(window);
+  assert(length > 0);
+  PipelineStage *stage = pipeline_add_stage(pipeline, kPipelineStageWindow);
+  stage->params.window.coeffs = window;
+  stage->params.window.length = length;
+}
+
+void simd_pipeline_add_fir(SimdPipeline *pipeline, const float *h,
+                           size_t hLength) {
+  assert(h);
+  assert(hLength >= 1);
+  PipelineStage *stage = pipeline_add_stage(pipeline, kPipelineStageFir);
+  stage->params.fir.reversed = mallocf(hLength);
+  for (size_t i = 0; i < hLength; i++) {
+    stage->params.fir.reversed[i] = h[hLength - 1 - i];
+  }
+  stage->params.fir.length = hLength;
+  // hLength floats instead of hLength - 1 to stay valid for hLength == 1
+  stage->params.fir.history = mallocf(hLength);
+  memsetf(stage->params.fir.history, 0.f, hLength);
+  stage->params.fir.scratch = mallocf(pipeline->tile_size + hLength - 1);
+}
+
+void simd_pipeline_add_scale(SimdPipeline *pipeline, float multiplier,
+                             float offset) {
+  PipelineStage *stage = pipeline_add_stage(pipeline, kPipelineStageScale);
+  stage->params.scale.multiplier = multiplier;
+  stage->params.scale.offset = offset;
+}
+
+void simd_pipeline_add_detect_peaks(SimdPipeline *pipeline,
+                                    ExtremumType type) {
+  PipelineStage *stage = pipeline_add_stage(pipeline,
+                                            kPipelineStageDetectPeaks);
+  stage->params.peaks.type = type;
+  detect_peaks_stream_initialize(&stage->params.peaks.stream, type);
+}
+
+static float pipeline_dot(int simd UNUSED, const float *a, const float *b,
+                          size_t length) {
+#ifdef SIMD
+  if (simd) {
+    return dot_product(a, b, length);
+  }
+#endif
+  return dot_product_na(a, b, length);
+}
+
+/// @brief Runs the FIR stage over one tile: prepends the carried history to
+/// the tile, slides the reversed filter over it and saves the new history.
+static void pipeline_run_fir(const SimdPipeline *pipeline,
+                             PipelineStage *stage, const float *input,
+                             size_t length, float *output) {
+  size_t history = stage->params.fir.length - 1;
+  float *scratch = stage->params.fir.scratch;
+  memcpy(scratch, stage->params.fir.history, history * sizeof(float));
+  memcpy(scratch + history, input, length * sizeof(float));
+  for (size_t i = 0; i < length; i++) {
+    output[i] = pipeline_dot(pipeline->simd, stage->params.fir.reversed,
+                             scratch + i, stage->params.fir.length);
+  }
+  // The last history samples of history + tile become the next carry; the
+  // tile itself may be shorter than the history
+  memcpy(stage->params.fir.history, scratch + length,
+         history * sizeof(float));
+}
+
+static void pipeline_append_peaks(SimdPipeline *pipeline,
+                                  const ExtremumPoint *points,
+                                  size_t length) {
+  if (length == 0) {
+    return;
+  }
+  pipeline->peaks = realloc(pipeline->peaks,
+                            (pipeline->peaks_length + length) *
+                                sizeof(pipeline->peaks[0]));
+  memcpy(pipeline->peaks + pipeline->peaks_length, points,
+         length * sizeof(points[0]));
+  pipeline->peaks_length += length;
+}
+
+void simd_pipeline_execute(SimdPipeline *pipeline, const void *input,
+                           size_t length, float *output) {
+  assert(pipeline);
+  assert(input);
+  assert(length >= 2);
+  int int16_input = pipeline->stage_count > 0 &&
+      pipeline->stages[0].kind == kPipelineStageInt16ToFloat;
+  assert(output != NULL || (pipeline->stage_count > 0 &&
+      pipeline->stages[pipeline->stage_count - 1].kind ==
+          kPipelineStageDetectPeaks));
+
+  size_t offset = 0;
+  while (offset < length) {
+    size_t tile = length - offset;
+    if (tile > pipeline->tile_size) {
+      tile = pipeline->tile_size;
+      if (length - offset - tile == 1) {
+        // Never leave a single trailing sample: the peak detection carry
+        // needs chunks of at least two
+        tile--;
+      }
+    }
+    // cur tracks the newest values; the transforming stages ping-pong
+    // between the two tile buffers so nothing is copied in between
+    const float *cur = int16_input ? NULL : (const float *)input + offset;
+    int next = 0;
+    for (int s = 0; s < pipeline->stage_count; s++) {
+      PipelineStage *stage = &pipeline->stages[s];
+      switch (stage->kind) {
+        case kPipelineStageInt16ToFloat: {
+          const int16_t *data = (const int16_t *)input + offset;
+#ifdef SIMD
+          // int16_to_float() requires compatible input/output alignments
+          if (pipeline->simd && align_complement_i16(data) % 8 ==
+              align_complement_f32(pipeline->tiles[next]) % 8) {
+            int16_to_float(data, tile, pipeline->tiles[next]);
+          } else
+#endif
+          {
+            int16_to_float_na(data, tile, pipeline->tiles[next]);
+          }
+          cur = pipeline->tiles[next];
+          next ^= 1;
+          break;
+        }
+        case kPipelineStageWindow: {
+          assert(length <= stage->params.window.length);
+          const float *window = stage->params.window.coeffs + offset;
+#ifdef SIMD
+          if (pipeline->simd) {
+            real_multiply_array(cur, window, tile, pipeline->tiles[next]);
+          } else
+#endif
+          {
+            real_multiply_array_na(cur, window, tile,
+                                   pipeline->tiles[next]);
+          }
+          cur = pipeline->tiles[next];
+          next ^= 1;
+          break;
+        }
+        case kPipelineStageFir:
+          pipeline_run_fir(pipeline, stage, cur, tile,
+                           pipeline->tiles[next]);
+          cur = pipeline->tiles[next];
+          next ^= 1;
+          break;
+        case kPipelineStageScale: {
+          float multiplier = stage->params.scale.multiplier;
+          float alpha = stage->params.scale.offset;
+#ifdef SIMD
+          if (pipeline->simd) {
+            real_multiply_scalar(cur, tile, multiplier,
+                                 pipeline->tiles[next]);
+          } else
+#endif
+          {
+            real_multiply_scalar_na(cur, tile, multiplier,
+                                    pipeline->tiles[next]);
+          }
+          if (alpha != 0.f) {
+            float *values = pipeline->tiles[next];
+            for (size_t i = 0; i < tile; i++) {
+              values[i] += alpha;
+            }
+          }
+          cur = pipeline->tiles[next];
+          next ^= 1;
+          break;
+        }
+        case kPipelineStageDetectPeaks: {
+          ExtremumPoint *points;
+          size_t points_length;
+          detect_peaks_stream_feed(pipeline->simd,
+                                   &stage->params.peaks.stream, cur, tile,
+                                   &points, &points_length);
+          pipeline_append_peaks(pipeline, points, points_length);
+          free(points);
+          break;
+        }
+      }
+    }
+    if (output != NULL) {
+      memcpy(output + offset, cur, tile * sizeof(float));
+    }
+    offset += tile;
+  }
+}
+
+void simd_pipeline_get_peaks(const SimdPipeline *pipeline,
+                             ExtremumPoint **results,
+                             size_t *resultsLength) {
+  assert(pipeline);
+  assert(results);
+  assert(resultsLength);
+  *results = pipeline->peaks;
+  *resultsLength = pipeline->peaks_length;
+}
+
+void simd_pipeline_reset(SimdPipeline *pipeline) {
+  assert(pipeline);
+  for (int s = 0; s < pipeline->stage_count; s++) {
+    PipelineStage *stage = &pipeline->stages[s];
+    switch (stage->kind) {
+      case kPipelineStageFir:
+        memsetf(stage->params.fir.history, 0.f, stage->params.fir.length);
+        break;
+      case kPipelineStageDetectPeaks:
+        detect_peaks_stream_initialize(&stage->params.peaks.stream,
+                                       stage->params.peaks.type);
+        break;
+      default:
+        break;
+    }
+  }
+  free(pipeline->peaks);
+  pipeline->peaks = NULL;
+  pipeline->peaks_length = 0;
+}
+
+void simd_pipeline_finalize(SimdPipeline *pipeline) {
+  assert(pipeline);
+  for (int s = 0; s < pipeline->stage_count; s++) {
+    PipelineStage *stage = &pipeline->stages[s];
+    if (stage->kind == kPipelineStageFir) {
+      freef(stage->params.fir.reversed);
+      freef(stage->params.fir.history);
+      freef(stage->params.fir.scratch);
+    }
+  }
+  free(pipeline->peaks);
+  freef(pipeline->tiles[0]);
+  freef(pipeline->tiles[1]);
+  free(pipeline);
+}
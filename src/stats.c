@@ -0,0 +1,56 @@
+/*! @file stats.c
+ *  @brief Opt-in per-kernel instrumentation counters.
+ *  @author Markovtsev Vadim <v.markovtsev@samsung.com>
+ *  @version 1.0
+ *
+ *  @section Notes
+ *  This code partially conforms to <a href="http://google-styleguide.googlecode.com/svn/trunk/cppguide.xml">Google C++ Style Guide</a>.
+ *
+ *  @section Copyright
+ *  Copyright © 2013 Samsung R&D Institute Russia
+ *
+ *  @section License
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#define LIBSIMD_IMPLEMENTATION
+#include <simd/stats.h>
+#include <assert.h>
+
+static SimdKernelStats stats[SIMD_KERNEL_COUNT];
+
+void simd_stats_account(SimdKernel kernel, uint64_t elements,
+                        uint64_t cycles) {
+  assert(kernel >= 0 && kernel < SIMD_KERNEL_COUNT);
+  __sync_fetch_and_add(&stats[kernel].invocations, (uint64_t)1);
+  __sync_fetch_and_add(&stats[kernel].elements, elements);
+  __sync_fetch_and_add(&stats[kernel].cycles, cycles);
+}
+
+void simd_stats_snapshot(SimdKernelStats snapshot[]) {
+  assert(snapshot);
+  for (int i = 0; i < SIMD_KERNEL_COUNT; i++) {
+    // fetch-and-and with zero atomically reads and resets each counter,
+    // so no call is lost between the copy and the reset
+    snapshot[i].invocations = __sync_fetch_and_and(&stats[i].invocations,
+                                                   (uint64_t)0);
+    snapshot[i].elements = __sync_fetch_and_and(&stats[i].elements,
+                                                (uint64_t)0);
+    snapshot[i].cycles = __sync_fetch_and_and(&stats[i].cycles, (uint64_t)0);
+  }
+}
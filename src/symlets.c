@@ -31,17 +31,22 @@
 #define WAVELET_INTERNAL_USE
 #include "src/symlets.h"
 
-const double kSymletsD[38][76] = {
+const double kSymletsD[WAVELET_SYMLETS_ROWS][WAVELET_SYMLETS_COLS] = {
+#if WAVELET_MAX_ORDER >= 2
   // 1 (2)
     { 0.5,
       0.5 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 4
   // 2 (4)
   {  3.415063509462200e-01,
      5.915063509458700e-01,
      1.584936490537800e-01,
     -9.150635094586999e-02 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 6
   // 3 (6)
   {  2.352336038927000e-01,
      5.705584579173100e-01,
@@ -49,7 +54,9 @@ const double kSymletsD[38][76] = {
     -9.546720778426000e-02,
     -6.041610415535000e-02,
      2.490874986589000e-02 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 8
   // 4 (8)
   {  2.278517294800000e-02,
     -8.912350720850001e-03,
@@ -59,7 +66,9 @@ const double kSymletsD[38][76] = {
      3.518695343280000e-01,
     -2.095548256255000e-02,
     -5.357445070900000e-02 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 10
   // 5 (10)
   {  1.381607647893000e-02,
     -1.492124993438000e-02,
@@ -71,7 +80,9 @@ const double kSymletsD[38][76] = {
     -2.767209305836000e-02,
      2.087343221079000e-02,
      1.932739797744000e-02 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 12
   // 6 (12)
   { -5.515933754690000e-03,
      1.249961046390000e-03,
@@ -85,7 +96,9 @@ const double kSymletsD[38][76] = {
     -8.343160770584000e-02,
      2.468306185920000e-03,
      1.089235016328000e-02 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 14
   // 7 (14)
   {  7.260697381010000e-03,
      2.835671342880000e-03,
@@ -101,7 +114,9 @@ const double kSymletsD[38][76] = {
     -8.935215825569999e-03,
     -7.406129573000000e-04,
      1.896329267100000e-03 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 16
   // 8 (16)
   {  1.336396696400000e-03,
     -2.141971501200000e-04,
@@ -119,7 +134,9 @@ const double kSymletsD[38][76] = {
      2.241181152181000e-02,
     -3.833454481100000e-04,
     -2.391729255750000e-03 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 18
   // 9 (18)
   {  7.562436546810931e-04,
     -3.345707545656016e-04,
@@ -139,7 +156,9 @@ const double kSymletsD[38][76] = {
     -9.384698418212253e-03,
      4.382512694515118e-04,
      9.905968682437781e-04 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 20
   // 10 (20)
   { -3.247949483908787e-04,
      4.033060149896469e-05,
@@ -161,7 +180,9 @@ const double kSymletsD[38][76] = {
     -6.110321317044863e-03,
      6.762250997113808e-05,
      5.445852236221847e-04 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 22
   // 11 (22)
   {  3.459616166040179e-04,
      7.816011710229956e-05,
@@ -185,7 +206,9 @@ const double kSymletsD[38][76] = {
     -1.226382148667494e-03,
     -2.743267125161877e-05,
      1.214257558180884e-04 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 24
   // 12 (24)
   { -1.266191979340108e-04,
     -1.283970069706689e-05,
@@ -211,7 +234,9 @@ const double kSymletsD[38][76] = {
     -9.544214477102665e-04,
     -8.028439511261475e-06,
      7.917276232218168e-05 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 26
   // 13 (26)
   {  4.980143648796826e-05,
      2.609603980976824e-05,
@@ -239,7 +264,9 @@ const double kSymletsD[38][76] = {
     -8.033181615241826e-04,
     -2.527102313226435e-05,
      4.822698243418468e-05 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 28
   // 14 (28)
   {  3.155038190739735e-05,
      1.366767897001262e-05,
@@ -269,7 +296,9 @@ const double kSymletsD[38][76] = {
      2.817365662280872e-04,
      7.927279236449717e-06,
     -1.829928021760973e-05 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 30
   // 15 (30)
   {  2.026618135187328e-05,
      1.535686739869793e-05,
@@ -301,7 +330,9 @@ const double kSymletsD[38][76] = {
     -1.136050951918606e-04,
     -5.204070300795476e-06,
      6.867717858445659e-06 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 32
   // 16 (32)
   { -7.635326369100278e-06,
     -3.815889850668213e-06,
@@ -335,7 +366,9 @@ const double kSymletsD[38][76] = {
     -7.737974108497493e-05,
     -2.201616849456764e-06,
      4.405279985266950e-06 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 34
   // 17 (34)
   {  2.680820842903412e-06,
     -1.734332358172868e-06,
@@ -371,7 +404,9 @@ const double kSymletsD[38][76] = {
     -4.450319785498648e-05,
      1.965846437781149e-06,
      3.038680607852918e-06 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 36
   // 18 (36)
   { -1.069960796228225e-06,
      5.548877669031676e-07,
@@ -409,7 +444,9 @@ const double kSymletsD[38][76] = {
     -3.199428931879830e-05,
      9.580701229228587e-07,
      1.847396055208554e-06 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 38
   // 19 (38)
   {  1.238099284413472e-06,
      1.458278380500544e-06,
@@ -449,7 +486,9 @@ const double kSymletsD[38][76] = {
     -8.400795032381557e-06,
     -4.570491667968555e-07,
      3.880413053636296e-07 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 40
   // 20 (40)
   { -4.475370066899557e-07,
     -2.302836523067074e-07,
@@ -491,7 +530,9 @@ const double kSymletsD[38][76] = {
     -5.599834157312889e-06,
     -1.344611337171996e-07,
      2.613139608698177e-07 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 42
   // 21 (42)
   {  1.634611974375198e-07,
     -5.233360375519924e-08,
@@ -535,7 +576,9 @@ const double kSymletsD[38][76] = {
     -3.604965707552858e-06,
      5.583255208126564e-08,
      1.743899744012027e-07 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 44
   // 22 (44)
   {  1.110230938338023e-07,
      7.047109562981162e-08,
@@ -581,7 +624,9 @@ const double kSymletsD[38][76] = {
      1.489935258232465e-06,
      3.977362160166864e-08,
     -6.266101702730341e-08 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 46
   // 23 (46)
   {  7.237541709973460e-08,
      8.448017332806580e-08,
@@ -629,7 +674,9 @@ const double kSymletsD[38][76] = {
     -5.967165360925407e-07,
     -2.741190321537223e-08,
      2.348418392805387e-08 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 48
   // 24 (48)
   { -2.661474832668549e-08,
     -9.757377109276728e-09,
@@ -679,7 +726,9 @@ const double kSymletsD[38][76] = {
     -3.823265004375023e-07,
     -5.725977052424754e-09,
      1.561848415740091e-08 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 50
   // 25 (50)
   {  1.002248217177791e-08,
     -9.092270743484262e-10,
@@ -731,7 +780,9 @@ const double kSymletsD[38][76] = {
     -2.615388740908856e-07,
      9.210424515706967e-10,
      1.015272401223316e-08 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 52
   // 26 (52)
   { -3.843629106565530e-09,
      1.407310205440268e-09,
@@ -785,7 +836,9 @@ const double kSymletsD[38][76] = {
     -1.712384986775817e-07,
      2.374821000626566e-09,
      6.486082863276796e-09 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 54
   // 27 (54)
   {  1.417647269737359e-09,
     -1.595620136349497e-09,
@@ -841,7 +894,9 @@ const double kSymletsD[38][76] = {
     -1.077093860874948e-07,
      4.853152458949276e-09,
      4.311839752028904e-09 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 56
   // 28 (56)
   { -1.582797990184050e-09,
     -5.714416070679209e-10,
@@ -899,7 +954,9 @@ const double kSymletsD[38][76] = {
     -2.708381423437176e-08,
     -3.421163067982663e-10,
      9.476052098047903e-10 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 58
   // 29 (58)
   {  6.145755032387424e-10,
      5.432388904928338e-11,
@@ -959,7 +1016,9 @@ const double kSymletsD[38][76] = {
     -1.832173426924599e-08,
     -5.296731354425605e-11,
      5.992283311493082e-10 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 60
   // 30 (60)
   {  3.920123163869876e-10,
      1.793461992104416e-10,
@@ -1021,7 +1080,9 @@ const double kSymletsD[38][76] = {
      7.175788072253800e-09,
      1.055959373465054e-10,
     -2.308100655756114e-10 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 62
   // 31 (62)
   {  8.692731338136870e-11,
     -8.047652346412072e-11,
@@ -1085,7 +1146,9 @@ const double kSymletsD[38][76] = {
     -7.838514510782323e-09,
      2.368928230152579e-10,
      2.558815388345046e-10 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 64
   // 32 (64)
   {  5.691442863510695e-11,
     -1.941312471686417e-11,
@@ -1151,7 +1214,9 @@ const double kSymletsD[38][76] = {
      3.186897356304272e-09,
     -3.278869262122993e-11,
     -9.612825000929717e-11 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 66
   // 33 (66)
   {  3.752885611145117e-11,
      9.183860814789920e-12,
@@ -1219,7 +1284,9 @@ const double kSymletsD[38][76] = {
     -1.269733387253168e-09,
     -8.779478709648006e-12,
      3.587639227849655e-11 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 68
   // 34 (68)
   { -1.402594352407934e-11,
      4.761501623102157e-12,
@@ -1289,7 +1356,9 @@ const double kSymletsD[38][76] = {
     -8.299799344762604e-10,
      8.023449969979470e-12,
      2.363473004196925e-11 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 70
   // 35 (70)
   {  5.352091367169250e-12,
     -4.456227377539422e-12,
@@ -1361,7 +1430,9 @@ const double kSymletsD[38][76] = {
     -5.367619137101874e-10,
      1.270309708409095e-11,
      1.525688221887981e-11 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 72
   // 36 (72)
   {  3.494858941853880e-12,
     -9.278033982178619e-13,
@@ -1435,7 +1506,9 @@ const double kSymletsD[38][76] = {
      2.156428723879057e-10,
     -1.528540252161891e-12,
     -5.757720416339470e-12 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 74
   // 37 (74)
   {  2.187123594466119e-12,
     -4.672302681375004e-13,
@@ -1511,7 +1584,9 @@ const double kSymletsD[38][76] = {
     -8.155553025058490e-11,
      4.845425378107512e-13,
      2.268163022030228e-12 },
+#endif
 
+#if WAVELET_MAX_ORDER >= 76
   // 38 (76)
   { -8.532807061985451e-13,
      3.790348921196607e-13,
@@ -1589,1564 +1664,5 @@ const double kSymletsD[38][76] = {
     -5.444622933293538e-11,
      6.366970868309261e-13,
      1.433630654002215e-12 }
-};
-
-const float kSymletsF[38][76] = {
-  // 1 (2)
-  { 0.5f,
-    0.5f },
-
-  // 2 (4)
-  { 3.4150635e-01f,
-    5.9150635e-01f,
-    1.5849365e-01f,
-   -9.1506351e-02f },
-
-  // 3 (6)
-  { 2.3523360e-01f,
-    5.7055846e-01f,
-    3.2518250e-01f,
-   -9.5467208e-02f,
-   -6.0416104e-02f,
-    2.4908750e-02f },
-
-  // 4 (8)
-  { 2.2785173e-02f,
-   -8.9123507e-03f,
-   -7.0158812e-02f,
-    2.1061727e-01f,
-    5.6832912e-01f,
-    3.5186953e-01f,
-   -2.0955483e-02f,
-   -5.3574451e-02f },
-
-  // 5 (10)
-  { 1.3816076e-02f,
-   -1.4921250e-02f,
-   -1.2397568e-01f,
-    1.1739462e-02f,
-    4.4829082e-01f,
-    5.1152648e-01f,
-    1.4099535e-01f,
-   -2.7672093e-02f,
-    2.0873432e-02f,
-    1.9327398e-02f },
-
-  // 6 (12)
-  {-5.5159338e-03f,
-    1.2499610e-03f,
-    3.1625281e-02f,
-   -1.4891876e-02f,
-   -5.1362485e-02f,
-    2.3895219e-01f,
-    5.5694639e-01f,
-    3.4722899e-01f,
-   -3.4161561e-02f,
-   -8.3431608e-02f,
-    2.4683062e-03f,
-    1.0892350e-02f },
-
-  // 7 (14)
-  { 7.2606974e-03f,
-    2.8356713e-03f,
-   -7.6231936e-02f,
-   -9.9028353e-02f,
-    2.0409197e-01f,
-    5.4289135e-01f,
-    3.7908130e-01f,
-    1.2332830e-02f,
-   -3.5039146e-02f,
-    4.8007384e-02f,
-    2.1577726e-02f,
-   -8.9352158e-03f,
-   -7.4061296e-04f,
-    1.8963293e-03f },
-
-  // 8 (16)
-  { 1.3363967e-03f,
-   -2.1419715e-04f,
-   -1.0572843e-02f,
-    2.6931944e-03f,
-    3.4745233e-02f,
-   -1.9246761e-02f,
-   -3.6731254e-02f,
-    2.5769934e-01f,
-    5.4955332e-01f,
-    3.4037267e-01f,
-   -4.3326808e-02f,
-   -1.0132433e-01f,
-    5.3793059e-03f,
-    2.2411812e-02f,
-   -3.8334545e-04f,
-   -2.3917293e-03f },
-
-  // 9 (18)
-  { 7.5624365e-04f,
-   -3.3457075e-04f,
-   -7.2577893e-03f,
-    6.2644481e-03f,
-    4.3895626e-02f,
-   -1.2893223e-02f,
-   -1.3544689e-01f,
-    2.4941415e-02f,
-    4.3652420e-01f,
-    5.0762990e-01f,
-    1.6882946e-01f,
-   -3.8586081e-02f,
-    4.1257046e-04f,
-    2.1372217e-02f,
-   -8.1516756e-03f,
-   -9.3846984e-03f,
-    4.3825127e-04f,
-    9.9059687e-04f },
-
-  // 10 (20)
-  {-3.2479495e-04f,
-    4.0330601e-05f,
-    3.2478642e-03f,
-   -5.6876766e-04f,
-   -1.4393116e-02f,
-    4.0764084e-03f,
-    3.5351784e-02f,
-   -2.2620386e-02f,
-   -2.5128270e-02f,
-    2.7140651e-01f,
-    5.4412577e-01f,
-    3.3353567e-01f,
-   -5.0120108e-02f,
-   -1.1277949e-01f,
-    8.2094347e-03f,
-    3.2475462e-02f,
-   -1.0361820e-03f,
-   -6.1103213e-03f,
-    6.7622510e-05f,
-    5.4458522e-04f },
-
-  // 11 (22)
-  { 3.4596162e-04f,
-    7.8160117e-05f,
-   -4.5181321e-03f,
-   -1.4166686e-03f,
-    3.0405726e-02f,
-    2.4937365e-02f,
-   -1.0224930e-01f,
-   -1.4471279e-01f,
-    1.6807215e-01f,
-    5.1643088e-01f,
-    4.0448133e-01f,
-    6.8729644e-02f,
-   -1.6145122e-02f,
-    4.9481070e-02f,
-    2.6189408e-02f,
-   -1.7027726e-02f,
-   -6.9706126e-03f,
-    4.6050299e-03f,
-    4.1602821e-04f,
-   -1.2263821e-03f,
-   -2.7432671e-05f,
-    1.2142576e-04f },
-
-  // 12 (24)
-  {-1.2661920e-04f,
-   -1.2839701e-05f,
-    1.6619114e-03f,
-    2.1753984e-04f,
-   -1.0316572e-02f,
-   -1.8415826e-03f,
-    4.0873727e-02f,
-    1.0819965e-02f,
-   -1.2047028e-01f,
-   -5.5389528e-02f,
-    3.2720732e-01f,
-    5.3986125e-01f,
-    2.8205498e-01f,
-   -1.5671117e-02f,
-   -2.5348951e-02f,
-    3.4775029e-02f,
-    5.3413295e-03f,
-   -1.7126637e-02f,
-   -9.9624928e-04f,
-    5.2431724e-03f,
-    1.2743061e-04f,
-   -9.5442145e-04f,
-   -8.0284395e-06f,
-    7.9172762e-05f },
-
-  // 13 (26)
-  { 4.9801436e-05f,
-    2.6096040e-05f,
-   -5.1008165e-04f,
-    2.9221980e-04f,
-    4.0127276e-03f,
-   -1.0553196e-03f,
-   -1.4672244e-02f,
-    1.2458017e-02f,
-    6.5708627e-02f,
-    6.2365105e-03f,
-   -9.9341498e-02f,
-    7.7944538e-02f,
-    4.5577585e-01f,
-    4.9196187e-01f,
-    1.3979842e-01f,
-   -8.7937539e-02f,
-   -4.2250074e-02f,
-    9.8022659e-03f,
-   -1.2170469e-02f,
-   -1.4295414e-02f,
-    3.7450919e-03f,
-    5.3218450e-03f,
-   -1.2087485e-04f,
-   -8.0331816e-04f,
-   -2.5271023e-05f,
-    4.8226982e-05f },
-
-  // 14 (28)
-  { 3.1550382e-05f,
-    1.3667679e-05f,
-   -4.2833713e-04f,
-   -5.1770267e-05f,
-    3.2050870e-03f,
-    7.1639957e-04f,
-   -1.3745671e-02f,
-   -1.6723421e-03f,
-    4.9375581e-02f,
-    1.8313067e-02f,
-   -1.1313525e-01f,
-   -4.1091264e-02f,
-    3.3611314e-01f,
-    5.3738435e-01f,
-    2.7803546e-01f,
-   -2.4973677e-02f,
-   -4.0753745e-02f,
-    2.6469191e-02f,
-    3.0267851e-03f,
-   -2.0644844e-02f,
-   -1.9472128e-03f,
-    7.0977213e-03f,
-    2.5913807e-04f,
-   -1.8239407e-03f,
-   -4.4452568e-05f,
-    2.8173657e-04f,
-    7.9272792e-06f,
-   -1.8299280e-05f },
-
-  // 15 (30)
-  { 2.0266181e-05f,
-    1.5356867e-05f,
-   -2.8437610e-04f,
-   -7.6476711e-05f,
-    2.4614590e-03f,
-    1.0791427e-03f,
-   -1.2141909e-02f,
-   -6.1834995e-03f,
-    4.8061927e-02f,
-    4.8361373e-02f,
-   -9.4792118e-02f,
-   -1.3903583e-01f,
-    1.7250768e-01f,
-    5.1042010e-01f,
-    4.0916056e-01f,
-    7.8866232e-02f,
-   -2.9049832e-02f,
-    2.8804334e-02f,
-    1.5512256e-02f,
-   -2.7489990e-02f,
-   -1.3721415e-02f,
-    7.1276202e-03f,
-    2.4207452e-03f,
-   -2.5386303e-03f,
-   -1.8902127e-04f,
-    7.5700534e-04f,
-    3.8977527e-05f,
-   -1.1360510e-04f,
-   -5.2040703e-06f,
-    6.8677179e-06f },
-
-  // 16 (32)
-  {-7.6353264e-06f,
-   -3.8158899e-06f,
-    1.1699562e-04f,
-    2.5856013e-05f,
-   -9.4661842e-04f,
-   -1.5706007e-04f,
-    4.9057379e-03f,
-    9.6155544e-04f,
-   -1.7644264e-02f,
-   -2.4821393e-03f,
-    5.5181095e-02f,
-    2.1723126e-02f,
-   -1.1284872e-01f,
-   -3.8212476e-02f,
-    3.3611812e-01f,
-    5.3494395e-01f,
-    2.8080832e-01f,
-   -2.4447671e-02f,
-   -4.7364168e-02f,
-    2.2862948e-02f,
-    3.4430970e-03f,
-   -2.1956516e-02f,
-   -2.2107815e-03f,
-    8.9567319e-03f,
-    5.0785256e-04f,
-   -2.7442194e-03f,
-   -7.6682635e-05f,
-    6.0270580e-04f,
-    1.9854556e-05f,
-   -7.7379741e-05f,
-   -2.2016168e-06f,
-    4.4052800e-06f },
-
-  // 17 (34)
-  { 2.6808208e-06f,
-   -1.7343324e-06f,
-   -5.3790493e-05f,
-    1.7824700e-05f,
-    5.0899460e-04f,
-    4.1295339e-05f,
-   -2.7805739e-03f,
-   -1.3473267e-03f,
-    8.7659945e-03f,
-    7.0378214e-03f,
-   -1.2755427e-02f,
-   -5.1347512e-03f,
-    1.1426003e-02f,
-   -6.0861299e-02f,
-   -1.0965529e-01f,
-    1.2766076e-01f,
-    4.8188549e-01f,
-    4.6012614e-01f,
-    1.0069084e-01f,
-   -8.3839482e-02f,
-    1.2212567e-02f,
-    7.4072699e-02f,
-    1.2660006e-02f,
-   -2.3540563e-02f,
-   -3.4076981e-03f,
-    7.4121527e-03f,
-    6.0582793e-04f,
-   -1.9386577e-03f,
-   -9.8034912e-05f,
-    3.3658027e-04f,
-   -9.5504553e-06f,
-   -4.4503198e-05f,
-    1.9658464e-06f,
-    3.0386806e-06f },
-
-  // 18 (36)
-  {-1.0699608e-06f,
-    5.5488777e-07f,
-    2.0900265e-05f,
-   -6.9712357e-06f,
-   -1.8797027e-04f,
-    3.3528278e-05f,
-    1.0098095e-03f,
-   -1.3348496e-04f,
-   -3.7050908e-03f,
-    7.6918000e-04f,
-    1.0615339e-02f,
-   -2.3056943e-03f,
-   -2.2424254e-02f,
-    4.4391772e-03f,
-    2.0173472e-02f,
-   -5.2183920e-02f,
-   -2.2967234e-02f,
-    2.8389196e-01f,
-    5.3289628e-01f,
-    3.3514674e-01f,
-   -3.6790171e-02f,
-   -1.1309335e-01f,
-    2.4038567e-02f,
-    5.9552484e-02f,
-   -3.5900413e-03f,
-   -2.1443078e-02f,
-    1.1617668e-03f,
-    6.7190449e-03f,
-   -2.9098937e-04f,
-   -1.6361545e-03f,
-    4.9647901e-05f,
-    2.8013337e-04f,
-   -9.9143389e-06f,
-   -3.1994289e-05f,
-    9.5807012e-07f,
-    1.8473961e-06f },
-
-  // 19 (38)
-  { 1.2380993e-06f,
-    1.4582784e-06f,
-   -1.9905861e-05f,
-   -1.1894517e-05f,
-    1.9531617e-04f,
-    9.1434335e-05f,
-   -1.2055890e-03f,
-   -4.3693707e-04f,
-    5.8422838e-03f,
-    3.0542430e-03f,
-   -1.9593856e-02f,
-   -1.1955928e-02f,
-    5.9448360e-02f,
-    6.6207004e-02f,
-   -8.2195316e-02f,
-   -1.2487284e-01f,
-    1.8262176e-01f,
-    5.0880259e-01f,
-    4.0881021e-01f,
-    7.7092900e-02f,
-   -4.7747426e-02f,
-    6.3318521e-03f,
-    4.9607598e-03f,
-   -3.2976620e-02f,
-   -1.6017378e-02f,
-    1.1170476e-02f,
-    5.6345368e-03f,
-   -3.6219459e-03f,
-   -8.2074114e-04f,
-    1.5000740e-03f,
-    1.1254173e-04f,
-   -4.4955340e-04f,
-   -3.2612045e-05f,
-    8.1698575e-05f,
-    6.2743792e-06f,
-   -8.4007950e-06f,
-   -4.5704917e-07f,
-    3.8804131e-07f },
-
-  // 20 (40)
-  {-4.4753701e-07f,
-   -2.3028365e-07f,
-    8.6883998e-06f,
-    3.1999567e-06f,
-   -8.3008209e-05f,
-   -1.8820036e-05f,
-    5.2864071e-04f,
-    8.8700123e-05f,
-   -2.4548257e-03f,
-   -4.3213161e-04f,
-    8.5963261e-03f,
-    1.3707951e-03f,
-   -2.5012726e-02f,
-   -4.8392281e-03f,
-    6.2875700e-02f,
-    2.5633294e-02f,
-   -1.1354600e-01f,
-   -3.6124914e-02f,
-    3.3374837e-01f,
-    5.3115226e-01f,
-    2.8696617e-01f,
-   -2.1085478e-02f,
-   -5.5857437e-02f,
-    1.8087331e-02f,
-    5.7439899e-03f,
-   -2.2365389e-02f,
-   -2.3432510e-03f,
-    1.2023678e-02f,
-    1.0062747e-03f,
-   -4.6715616e-03f,
-   -2.1585342e-04f,
-    1.4771423e-03f,
-    5.1024763e-05f,
-   -3.4982771e-04f,
-   -1.3635934e-05f,
-    5.6518818e-05f,
-    2.1394690e-06f,
-   -5.5998342e-06f,
-   -1.3446113e-07f,
-    2.6131396e-07f },
-
-  // 21 (42)
-  { 1.6346120e-07f,
-   -5.2333604e-08f,
-   -3.6497941e-06f,
-    1.3003683e-06f,
-    4.1159175e-05f,
-   -7.4627979e-06f,
-   -2.9238556e-04f,
-   -1.4571670e-05f,
-    1.4362643e-03f,
-    4.9208670e-04f,
-   -4.7722515e-03f,
-   -2.8959079e-03f,
-    1.0258613e-02f,
-    7.9115747e-03f,
-   -1.0664210e-02f,
-    4.4226988e-03f,
-    1.9740499e-02f,
-   -6.1588183e-02f,
-   -1.0699288e-01f,
-    1.3578364e-01f,
-    4.8195219e-01f,
-    4.5692250e-01f,
-    1.0191096e-01f,
-   -8.7373991e-02f,
-    5.2095310e-03f,
-    7.1759394e-02f,
-    7.5449254e-03f,
-   -3.3349464e-02f,
-   -6.3583249e-03f,
-    1.0890035e-02f,
-    1.2487236e-03f,
-   -3.7858196e-03f,
-   -3.0628748e-04f,
-    1.0050253e-03f,
-    4.3901838e-05f,
-   -2.0256854e-04f,
-    4.2985943e-06f,
-    3.3197094e-05f,
-   -1.2948316e-06f,
-   -3.6049657e-06f,
-    5.5832552e-08f,
-    1.7438997e-07f },
-
-  // 22 (44)
-  { 1.1102309e-07f,
-    7.0471096e-08f,
-   -2.3222652e-06f,
-   -1.0343395e-06f,
-    2.4339340e-05f,
-    7.6104869e-06f,
-   -1.6698828e-04f,
-   -3.3870831e-05f,
-    8.5432465e-04f,
-    1.5344736e-04f,
-   -3.3297151e-03f,
-   -5.5050344e-04f,
-    1.0506485e-02f,
-    1.8066383e-03f,
-   -2.7739535e-02f,
-   -5.3213515e-03f,
-    6.6561779e-02f,
-    2.9222368e-02f,
-   -1.0904175e-01f,
-   -2.9154376e-02f,
-    3.3717199e-01f,
-    5.2961799e-01f,
-    2.8487682e-01f,
-   -2.5873418e-02f,
-   -6.4072268e-02f,
-    1.3544128e-02f,
-    5.9545382e-03f,
-   -2.2479115e-02f,
-   -2.5168580e-03f,
-    1.3184774e-02f,
-    1.1901662e-03f,
-   -5.6574106e-03f,
-   -3.3048235e-04f,
-    1.9944068e-03f,
-    7.8343627e-05f,
-   -5.6153297e-04f,
-   -2.3768333e-05f,
-    1.1642699e-04f,
-    5.4477110e-06f,
-   -1.6671010e-05f,
-   -6.9755971e-07f,
-    1.4899353e-06f,
-    3.9773622e-08f,
-   -6.2661017e-08f },
-
-  // 23 (46)
-  { 7.2375417e-08f,
-    8.4480173e-08f,
-   -1.4707595e-06f,
-   -1.1941812e-06f,
-    1.6045043e-05f,
-    9.4578748e-06f,
-   -1.1678063e-04f,
-   -4.8729543e-05f,
-    6.5099806e-04f,
-    2.5279823e-04f,
-   -2.7845529e-03f,
-   -1.1304164e-03f,
-    9.8134718e-03f,
-    5.3165155e-03f,
-   -2.7258400e-02f,
-   -1.9514959e-02f,
-    6.5012737e-02f,
-    7.6308609e-02f,
-   -7.8853651e-02f,
-   -1.2654116e-01f,
-    1.7578215e-01f,
-    5.0156452e-01f,
-    4.1473698e-01f,
-    8.8719960e-02f,
-   -4.9701265e-02f,
-   -3.2129239e-03f,
-    1.8046164e-03f,
-   -3.2835374e-02f,
-   -1.5463268e-02f,
-    1.4689975e-02f,
-    8.0856669e-03f,
-   -5.0707414e-03f,
-   -1.9912476e-03f,
-    2.1538166e-03f,
-    3.2009533e-04f,
-   -8.7175392e-04f,
-   -6.9223292e-05f,
-    2.5719843e-04f,
-    2.0967323e-05f,
-   -5.2227165e-05f,
-   -4.4375150e-06f,
-    7.1179045e-06f,
-    5.2695754e-07f,
-   -5.9671654e-07f,
-   -2.7411903e-08f,
-    2.3484184e-08f },
-
-  // 24 (48)
-  {-2.6614748e-08f,
-   -9.7573771e-09f,
-    6.5140602e-07f,
-    2.4970085e-07f,
-   -7.6648117e-06f,
-   -3.3310449e-06f,
-    5.6246316e-05f,
-    2.5136433e-05f,
-   -2.9054762e-04f,
-   -1.0829396e-04f,
-    1.1727536e-03f,
-    2.5833245e-04f,
-   -4.0936707e-03f,
-   -5.0115911e-04f,
-    1.2667485e-02f,
-    2.9892692e-03f,
-   -3.0273537e-02f,
-   -1.0661122e-02f,
-    5.7293016e-02f,
-    1.6914754e-02f,
-   -1.1376485e-01f,
-   -2.1130189e-02f,
-    3.4564069e-01f,
-    5.2812664e-01f,
-    2.7780893e-01f,
-   -3.0966627e-02f,
-   -6.2066998e-02f,
-    2.4353814e-02f,
-    1.8205207e-02f,
-   -1.7156384e-02f,
-   -2.2799228e-03f,
-    1.2902232e-02f,
-    1.9678229e-04f,
-   -7.1368280e-03f,
-   -4.3337179e-04f,
-    2.7586755e-03f,
-    2.2803052e-04f,
-   -8.2876687e-04f,
-   -7.2670709e-05f,
-    1.9395383e-04f,
-    1.5285627e-05f,
-   -3.4471876e-05f,
-   -1.9522851e-06f,
-    4.4911259e-06f,
-    1.4655470e-07f,
-   -3.8232650e-07f,
-   -5.7259771e-09f,
-    1.5618484e-08f },
-
-  // 25 (50)
-  { 1.0022482e-08f,
-   -9.0922707e-10f,
-   -2.5373330e-07f,
-    5.9753936e-08f,
-    3.2541064e-06f,
-   -7.5416894e-07f,
-   -2.7308833e-05f,
-    3.7150498e-06f,
-    1.6537515e-04f,
-    4.1089906e-06f,
-   -7.5205817e-04f,
-   -1.7440970e-04f,
-    2.5726507e-03f,
-    1.1904900e-03f,
-   -6.3595422e-03f,
-   -4.1857817e-03f,
-    1.0592625e-02f,
-    7.0271527e-03f,
-   -9.4775142e-03f,
-    1.2720633e-02f,
-    2.7311626e-02f,
-   -6.0628775e-02f,
-   -1.0364901e-01f,
-    1.4234056e-01f,
-    4.8207495e-01f,
-    4.5428627e-01f,
-    1.0211086e-01f,
-   -9.1134425e-02f,
-   -2.0366108e-03f,
-    6.8026195e-02f,
-    3.2136567e-03f,
-   -4.0286154e-02f,
-   -7.6853688e-03f,
-    1.4956250e-02f,
-    2.3816242e-03f,
-   -5.6694689e-03f,
-   -5.6948603e-04f,
-    1.9548294e-03f,
-    1.4921446e-04f,
-   -5.3015100e-04f,
-   -1.7145361e-05f,
-    1.1913070e-04f,
-   -2.2427692e-06f,
-   -2.2293735e-05f,
-    7.6016087e-07f,
-    3.0722624e-06f,
-   -6.0939426e-08f,
-   -2.6153887e-07f,
-    9.2104245e-10f,
-    1.0152724e-08f },
-
-  // 26 (52)
-  {-3.8436291e-09f,
-    1.4073102e-09f,
-    1.0203552e-07f,
-   -3.7306786e-08f,
-   -1.2990064e-06f,
-    5.2105496e-07f,
-    1.0723401e-05f,
-   -4.6258570e-06f,
-   -6.5101717e-05f,
-    2.6569928e-05f,
-    3.0595757e-04f,
-   -1.0192326e-04f,
-   -1.1347829e-03f,
-    2.7202774e-04f,
-    3.3796833e-03f,
-   -4.1503996e-04f,
-   -7.8843217e-03f,
-    1.9819699e-04f,
-    1.3090102e-02f,
-   -3.2108466e-03f,
-   -1.7095606e-02f,
-    1.9718336e-02f,
-    2.3743717e-02f,
-   -6.3450537e-02f,
-   -2.8755275e-02f,
-    2.8040318e-01f,
-    5.2703986e-01f,
-    3.4407587e-01f,
-   -2.1600822e-02f,
-   -1.1499697e-01f,
-    1.6840625e-02f,
-    5.8944230e-02f,
-   -1.1111027e-02f,
-   -3.2118371e-02f,
-    3.7460498e-03f,
-    1.4571356e-02f,
-   -6.9000230e-04f,
-   -5.1547987e-03f,
-    2.8714048e-04f,
-    1.5996067e-03f,
-   -1.4070249e-04f,
-   -4.4238033e-04f,
-    4.1825670e-05f,
-    1.0134642e-04f,
-   -7.6619515e-06f,
-   -1.7733342e-05f,
-    8.7843142e-07f,
-    2.1897209e-06f,
-   -6.2608671e-08f,
-   -1.7123850e-07f,
-    2.3748210e-09f,
-    6.4860829e-09f },
-
-  // 27 (54)
-  { 1.4176473e-09f,
-   -1.5956201e-09f,
-   -4.0873145e-08f,
-    4.1127413e-08f,
-    5.7306333e-07f,
-   -4.7477039e-07f,
-   -5.1207853e-06f,
-    3.2151894e-06f,
-    3.2180534e-05f,
-   -1.4051731e-05f,
-   -1.4801825e-04f,
-    4.4318490e-05f,
-    5.0537928e-04f,
-   -1.4746934e-04f,
-   -1.3010452e-03f,
-    7.3424373e-04f,
-    2.8011420e-03f,
-   -3.4265366e-03f,
-   -6.6898328e-03f,
-    1.0120683e-02f,
-    1.8339494e-02f,
-   -1.2652095e-02f,
-   -2.9639044e-02f,
-    6.5016858e-04f,
-   -1.2406870e-02f,
-   -5.5766292e-02f,
-    9.2375239e-02f,
-    4.1681233e-01f,
-    4.9815252e-01f,
-    1.7585229e-01f,
-   -1.2257877e-01f,
-   -7.4601154e-02f,
-    8.1855902e-02f,
-    6.6288692e-02f,
-   -2.7217798e-02f,
-   -3.3827807e-02f,
-    7.7160936e-03f,
-    1.3616308e-02f,
-   -2.2235502e-03f,
-   -4.8017166e-03f,
-    5.3872424e-04f,
-    1.3979469e-03f,
-   -1.3330678e-04f,
-   -3.4168980e-04f,
-    3.1593679e-05f,
-    6.8776083e-05f,
-   -6.3638023e-06f,
-   -1.0932629e-05f,
-    1.0225509e-06f,
-    1.3177625e-06f,
-   -1.0639775e-07f,
-   -1.0770939e-07f,
-    4.8531525e-09f,
-    4.3118398e-09f },
-
-  // 28 (56)
-  {-1.5827980e-09f,
-   -5.7144161e-10f,
-    4.4894166e-08f,
-    1.5843812e-08f,
-   -6.1881894e-07f,
-   -2.3154175e-07f,
-    5.4596027e-06f,
-    2.2189239e-06f,
-   -3.4280761e-05f,
-   -1.4297533e-05f,
-    1.6344701e-04f,
-    6.1329243e-05f,
-   -6.2876960e-04f,
-   -1.7033801e-04f,
-    2.0862140e-03f,
-    3.2226312e-04f,
-   -6.2623870e-03f,
-   -9.3380952e-04f,
-    1.6337893e-02f,
-    4.4528213e-03f,
-   -3.3736749e-02f,
-   -1.1465433e-02f,
-    6.0360258e-02f,
-    1.6671669e-02f,
-   -1.1622743e-01f,
-   -2.2304416e-02f,
-    3.4241228e-01f,
-    5.2606999e-01f,
-    2.8294590e-01f,
-   -2.6478535e-02f,
-   -6.4489514e-02f,
-    2.3233376e-02f,
-    2.1114597e-02f,
-   -1.7003889e-02f,
-   -4.1434607e-03f,
-    1.3191154e-02f,
-    2.7230056e-04f,
-   -8.5028886e-03f,
-   -3.8187137e-04f,
-    3.9861379e-03f,
-    3.0644962e-04f,
-   -1.4710452e-03f,
-   -1.3284087e-04f,
-    4.4449078e-04f,
-    4.0759885e-05f,
-   -1.0909636e-04f,
-   -8.8925054e-06f,
-    2.1463784e-05f,
-    1.3417129e-06f,
-   -3.2996641e-06f,
-   -1.3912468e-07f,
-    3.7200527e-07f,
-    9.5599498e-09f,
-   -2.7083814e-08f,
-   -3.4211631e-10f,
-    9.4760521e-10f },
-
-  // 29 (58)
-  { 6.1457550e-10f,
-    5.4323889e-11f,
-   -1.7508867e-08f,
-    2.1526747e-09f,
-    2.5416650e-07f,
-   -4.9479660e-08f,
-   -2.4289947e-06f,
-    4.7499219e-07f,
-    1.7082363e-05f,
-   -2.1965025e-06f,
-   -9.2919614e-05f,
-    1.1325202e-06f,
-    4.0176930e-04f,
-    6.0337189e-05f,
-   -1.3801716e-03f,
-   -4.6308081e-04f,
-    3.7277537e-03f,
-    2.0092114e-03f,
-   -7.4126789e-03f,
-   -4.9472474e-03f,
-    1.0456703e-02f,
-    5.3553344e-03f,
-   -8.5762639e-03f,
-    2.0480430e-02f,
-    3.4645255e-02f,
-   -5.9293471e-02f,
-   -1.0200802e-01f,
-    1.4545915e-01f,
-    4.8117425e-01f,
-    4.5309474e-01f,
-    1.0390213e-01f,
-   -9.3292426e-02f,
-   -8.6859216e-03f,
-    6.3504819e-02f,
-   -6.6168881e-04f,
-   -4.5340139e-02f,
-   -8.2156418e-03f,
-    1.8784526e-02f,
-    3.4436264e-03f,
-   -7.6597966e-03f,
-   -9.6307196e-04f,
-    3.0330697e-03f,
-    2.8795408e-04f,
-   -1.0129427e-03f,
-   -6.4196951e-05f,
-    2.8524563e-04f,
-    5.2733763e-06f,
-   -6.9250769e-05f,
-    1.3898873e-06f,
-    1.4155000e-05f,
-   -4.7167339e-07f,
-   -2.2707590e-06f,
-    5.4772447e-08f,
-    2.5911439e-07f,
-   -1.9884188e-09f,
-   -1.8321734e-08f,
-   -5.2967314e-11f,
-    5.9922833e-10f },
-
-  // 30 (60)
-  { 3.9201232e-10f,
-    1.7934620e-10f,
-   -1.1670711e-08f,
-   -4.3329983e-09f,
-    1.7262571e-07f,
-    6.3604381e-08f,
-   -1.6429978e-06f,
-   -6.3518325e-07f,
-    1.1240880e-05f,
-    4.5776880e-06f,
-   -5.8496756e-05f,
-   -2.3286275e-05f,
-    2.4314023e-04f,
-    8.2985136e-05f,
-   -8.4635120e-04f,
-   -1.9536242e-04f,
-    2.6260581e-03f,
-    3.8452367e-04f,
-   -7.3459675e-03f,
-   -1.1521048e-03f,
-    1.8079692e-02f,
-    5.3806562e-03f,
-   -3.4575185e-02f,
-   -1.0774142e-02f,
-    6.3004351e-02f,
-    1.8525158e-02f,
-   -1.1458440e-01f,
-   -2.0108573e-02f,
-    3.4273326e-01f,
-    5.2516380e-01f,
-    2.8335363e-01f,
-   -2.7217616e-02f,
-   -6.8095990e-02f,
-    2.0697722e-02f,
-    2.0971789e-02f,
-   -1.7831779e-02f,
-   -5.6229170e-03f,
-    1.2938109e-02f,
-    2.6313158e-04f,
-   -9.0800914e-03f,
-   -3.6712532e-04f,
-    4.5637852e-03f,
-    3.2981299e-04f,
-   -1.8311581e-03f,
-   -1.6374255e-04f,
-    6.0913942e-04f,
-    5.8049521e-05f,
-   -1.6775670e-04f,
-   -1.4992108e-05f,
-    3.8075613e-05f,
-    2.8467184e-06f,
-   -6.9980068e-06f,
-   -3.9196911e-07f,
-    1.0062167e-06f,
-    3.8648387e-08f,
-   -1.0596767e-07f,
-   -2.6904007e-09f,
-    7.1757881e-09f,
-    1.0559594e-10f,
-   -2.3081007e-10f },
-
-  // 31 (62)
-  { 8.6927313e-11f,
-   -8.0476523e-11f,
-   -2.7449329e-09f,
-    2.7956610e-09f,
-    4.3439626e-08f,
-   -4.2283718e-08f,
-   -4.4884342e-07f,
-    3.8634032e-07f,
-    3.3712299e-06f,
-   -2.3500916e-06f,
-   -1.9267870e-05f,
-    9.9715317e-06f,
-    8.5521365e-05f,
-   -3.0252960e-05f,
-   -2.9440175e-04f,
-    7.9647207e-05f,
-    7.8643245e-04f,
-   -2.8800846e-04f,
-   -1.6765183e-03f,
-    1.4007983e-03f,
-    3.5102912e-03f,
-   -5.0613038e-03f,
-   -8.7538061e-03f,
-    1.1252096e-02f,
-    2.1855245e-02f,
-   -7.3550376e-03f,
-   -2.1721367e-02f,
-    5.0779713e-03f,
-   -1.6901796e-02f,
-   -6.1406253e-02f,
-    9.2273760e-02f,
-    4.1683911e-01f,
-    4.9718057e-01f,
-    1.7927037e-01f,
-   -1.1800556e-01f,
-   -7.4113653e-02f,
-    8.0376655e-02f,
-    6.2209729e-02f,
-   -3.5873049e-02f,
-   -3.9799557e-02f,
-    9.8589238e-03f,
-    1.6961986e-02f,
-   -3.5138148e-03f,
-   -6.8978374e-03f,
-    1.0368613e-03f,
-    2.4090084e-03f,
-   -2.7065497e-04f,
-   -7.0502259e-04f,
-    7.9750245e-05f,
-    1.8166298e-04f,
-   -2.0408016e-05f,
-   -3.9518560e-05f,
-    4.3784383e-06f,
-    6.9971415e-06f,
-   -8.1284583e-07f,
-   -1.0071917e-06f,
-    1.0786835e-07f,
-    1.1070401e-07f,
-   -8.0057639e-09f,
-   -7.8385145e-09f,
-    2.3689282e-10f,
-    2.5588154e-10f },
-
-  // 32 (64)
-  { 5.6914429e-11f,
-   -1.9413125e-11f,
-   -1.8096894e-09f,
-    9.2883338e-10f,
-    2.9067423e-08f,
-   -1.5908217e-08f,
-   -3.0589720e-07f,
-    1.5853677e-07f,
-    2.3532524e-06f,
-   -1.0399177e-06f,
-   -1.3937246e-05f,
-    4.8106953e-06f,
-    6.5564353e-05f,
-   -1.6081622e-05f,
-   -2.4891785e-04f,
-    4.3004450e-05f,
-    7.7808440e-04f,
-   -1.1152450e-04f,
-   -2.0454026e-03f,
-    3.6473727e-04f,
-    4.7701634e-03f,
-   -9.3664709e-04f,
-   -9.7324133e-03f,
-    1.7674369e-03f,
-    1.6948837e-02f,
-   -3.9778812e-04f,
-   -1.3029975e-02f,
-    2.1143408e-02f,
-    1.3532377e-02f,
-   -7.5970192e-02f,
-   -2.7784980e-02f,
-    2.8642960e-01f,
-    5.2441127e-01f,
-    3.4009342e-01f,
-   -1.8719855e-02f,
-   -1.0846269e-01f,
-    2.5668318e-02f,
-    6.5557544e-02f,
-   -1.5800638e-02f,
-   -4.2187830e-02f,
-    2.1170640e-03f,
-    1.8475774e-02f,
-   -1.4104962e-03f,
-   -8.2736912e-03f,
-    6.2641430e-04f,
-    3.3489169e-03f,
-   -1.8543427e-04f,
-   -1.1417212e-03f,
-    7.0152035e-05f,
-    3.4302115e-04f,
-   -2.3106896e-05f,
-   -8.8715177e-05f,
-    5.9814207e-06f,
-    1.9021447e-05f,
-   -1.3630079e-06f,
-   -3.3553279e-06f,
-    2.4329634e-07f,
-    4.7345167e-07f,
-   -2.7534279e-08f,
-   -4.8953635e-08f,
-    1.6132537e-09f,
-    3.1868974e-09f,
-   -3.2788693e-11f,
-   -9.6128250e-11f },
-
-  // 33 (66)
-  { 3.7528856e-11f,
-    9.1838608e-12f,
-   -1.1863515e-09f,
-    4.0659106e-11f,
-    1.9283654e-08f,
-   -3.2073591e-09f,
-   -2.0777777e-07f,
-    4.6388188e-08f,
-    1.6575413e-06f,
-   -3.6080907e-07f,
-   -1.0351784e-05f,
-    1.6980539e-06f,
-    5.2370161e-05f,
-   -3.4591652e-06f,
-   -2.1806215e-04f,
-   -1.4474716e-05f,
-    7.5212074e-04f,
-    1.7415018e-04f,
-   -2.1193572e-03f,
-   -8.6687542e-04f,
-    4.7908855e-03f,
-    2.8480579e-03f,
-   -8.0027735e-03f,
-   -5.2446363e-03f,
-    1.0042759e-02f,
-    3.2982450e-03f,
-   -7.3706998e-03f,
-    2.9018146e-02f,
-    4.3111216e-02f,
-   -5.7994573e-02f,
-   -1.0435244e-01f,
-    1.4251639e-01f,
-    4.7791298e-01f,
-    4.5466689e-01f,
-    1.1036007e-01f,
-   -9.1798937e-02f,
-   -1.4490275e-02f,
-    5.7613098e-02f,
-   -5.1469433e-03f,
-   -4.9660736e-02f,
-   -8.6651725e-03f,
-    2.1971490e-02f,
-    4.3273197e-03f,
-   -9.5372788e-03f,
-   -1.3369080e-03f,
-    4.2044639e-03f,
-    4.7263067e-04f,
-   -1.5984691e-03f,
-   -1.3147832e-04f,
-    5.3057305e-04f,
-    2.1803148e-05f,
-   -1.5595362e-04f,
-   -4.0166880e-07f,
-    3.9820513e-05f,
-   -1.0709477e-06f,
-   -8.6652503e-06f,
-    3.5012726e-07f,
-    1.5523618e-06f,
-   -5.3486099e-08f,
-   -2.1462360e-07f,
-    3.6456263e-09f,
-    2.0954093e-08f,
-   -5.6808329e-12f,
-   -1.2697334e-09f,
-   -8.7794787e-12f,
-    3.5876392e-11f },
-
-  // 34 (68)
-  {-1.4025944e-11f,
-    4.7615016e-12f,
-    4.7448832e-10f,
-   -2.3079146e-10f,
-   -8.0391329e-09f,
-    4.3424016e-09f,
-    8.9616344e-08f,
-   -4.7676013e-08f,
-   -7.3287908e-07f,
-    3.5161862e-07f,
-    4.6505877e-06f,
-   -1.8538621e-06f,
-   -2.3631531e-05f,
-    7.2089743e-06f,
-    9.7951079e-05f,
-   -2.1367879e-05f,
-   -3.3549562e-04f,
-    5.3477679e-05f,
-    9.6438690e-04f,
-   -1.4214151e-04f,
-   -2.3879554e-03f,
-    4.3465622e-04f,
-    5.2959035e-03f,
-   -1.0444598e-03f,
-   -1.0394057e-02f,
-    1.6317469e-03f,
-    1.6832344e-02f,
-   -8.0709685e-04f,
-   -1.1982948e-02f,
-    2.3091549e-02f,
-    1.3203023e-02f,
-   -7.7752096e-02f,
-   -2.7835201e-02f,
-    2.8690294e-01f,
-    5.2364034e-01f,
-    3.4016093e-01f,
-   -1.7413189e-02f,
-   -1.0817988e-01f,
-    2.5374255e-02f,
-    6.5649361e-02f,
-   -1.6836822e-02f,
-   -4.3749967e-02f,
-    2.6877458e-03f,
-    2.0132428e-02f,
-   -1.4538645e-03f,
-   -9.2271783e-03f,
-    7.3627475e-04f,
-    3.9430736e-03f,
-   -2.3644054e-04f,
-   -1.4408089e-03f,
-    8.7870749e-05f,
-    4.6458395e-04f,
-   -3.1836378e-05f,
-   -1.3167314e-04f,
-    9.2483760e-06f,
-    3.1726922e-05f,
-   -2.3230748e-06f,
-   -6.4125443e-06f,
-    4.9328171e-07f,
-    1.0741726e-06f,
-   -7.6470685e-08f,
-   -1.4239054e-07f,
-    7.5146791e-09f,
-    1.3682517e-08f,
-   -3.9923088e-10f,
-   -8.2997993e-10f,
-    8.0234500e-12f,
-    2.3634730e-11f },
-
-  // 35 (70)
-  { 5.3520914e-12f,
-   -4.4562274e-12f,
-   -1.8831242e-10f,
-    1.7993822e-10f,
-    3.3145262e-09f,
-   -3.2264777e-09f,
-   -3.8346002e-08f,
-    3.5623178e-08f,
-    3.2603521e-07f,
-   -2.7124799e-07f,
-   -2.1524272e-06f,
-    1.5044113e-06f,
-    1.1363680e-05f,
-   -6.2006500e-06f,
-   -4.8533649e-05f,
-    1.9326377e-05f,
-    1.6791085e-04f,
-   -4.8807212e-05f,
-   -4.6731317e-04f,
-    1.3608080e-04f,
-    1.0549028e-03f,
-   -5.3735293e-04f,
-   -2.0631653e-03f,
-    2.1980573e-03f,
-    4.3895241e-03f,
-   -6.3362123e-03f,
-   -1.0678190e-02f,
-    1.1260363e-02f,
-    2.3106554e-02f,
-   -4.6646581e-03f,
-   -1.6793066e-02f,
-    7.2533755e-03f,
-   -2.0374697e-02f,
-   -6.2711704e-02f,
-    9.7070690e-02f,
-    4.1937226e-01f,
-    4.9401066e-01f,
-    1.7687255e-01f,
-   -1.1767667e-01f,
-   -7.3599650e-02f,
-    8.0862913e-02f,
-    6.0266910e-02f,
-   -4.2031186e-02f,
-   -4.3666693e-02f,
-    1.2954923e-02f,
-    2.0613160e-02f,
-   -4.7586519e-03f,
-   -9.0907910e-03f,
-    1.6308693e-03f,
-    3.6060687e-03f,
-   -4.7982668e-04f,
-   -1.2278361e-03f,
-    1.4800529e-04f,
-    3.7021529e-04f,
-   -4.4766077e-05f,
-   -9.8522916e-05f,
-    1.1930876e-05f,
-    2.2525593e-05f,
-   -2.7863711e-06f,
-   -4.3585376e-06f,
-    5.5258510e-07f,
-    7.0533006e-07f,
-   -8.4193613e-08f,
-   -9.1796053e-08f,
-    8.6629653e-09f,
-    8.8067480e-09f,
-   -5.1289827e-10f,
-   -5.3676191e-10f,
-    1.2703097e-11f,
-    1.5256882e-11f },
-
-  // 36 (72)
-  { 3.4948589e-12f,
-   -9.2780340e-13f,
-   -1.2418867e-10f,
-    5.3611453e-11f,
-    2.2139105e-09f,
-   -1.1223484e-09f,
-   -2.6013938e-08f,
-    1.3637110e-08f,
-    2.2508255e-07f,
-   -1.1179090e-07f,
-   -1.5189824e-06f,
-    6.6322949e-07f,
-    8.2673360e-06f,
-   -2.9452719e-06f,
-   -3.7013897e-05f,
-    1.0003884e-05f,
-    1.3803869e-04f,
-   -2.6957331e-05f,
-   -4.3310217e-04f,
-    6.5550145e-05f,
-    1.1615768e-03f,
-   -1.7459492e-04f,
-   -2.7275940e-03f,
-    5.1271422e-04f,
-    5.8141502e-03f,
-   -1.0983295e-03f,
-   -1.0900010e-02f,
-    1.6128305e-03f,
-    1.6793867e-02f,
-   -9.6041125e-04f,
-   -1.0452579e-02f,
-    2.5848104e-02f,
-    1.4444868e-02f,
-   -7.7129995e-02f,
-   -2.5360290e-02f,
-    2.8909887e-01f,
-    5.2300968e-01f,
-    3.3855773e-01f,
-   -1.8691882e-02f,
-   -1.1017394e-01f,
-    2.3448658e-02f,
-    6.4619080e-02f,
-   -1.8447584e-02f,
-   -4.5495267e-02f,
-    3.1343940e-03f,
-    2.1678427e-02f,
-   -1.5282929e-03f,
-   -1.0191795e-02f,
-    8.3975131e-04f,
-    4.5560983e-03f,
-   -2.9085922e-04f,
-   -1.7674549e-03f,
-    1.0836168e-04f,
-    6.0754403e-04f,
-   -4.1467353e-05f,
-   -1.8582779e-04f,
-    1.3311187e-05f,
-    4.9336970e-05f,
-   -3.6639034e-06f,
-   -1.1187969e-05f,
-    8.7582162e-07f,
-    2.1480716e-06f,
-   -1.6688873e-07f,
-   -3.4085697e-07f,
-    2.2644451e-08f,
-    4.2403059e-08f,
-   -1.9559372e-09f,
-   -3.8042875e-09f,
-    9.1255921e-11f,
-    2.1564287e-10f,
-   -1.5285403e-12f,
-   -5.7577204e-12f },
-
-  // 37 (74)
-  { 2.1871236e-12f,
-   -4.6723027e-13f,
-   -8.5416050e-11f,
-    4.2186030e-12f,
-    1.5942223e-09f,
-    1.4740584e-10f,
-   -1.8833469e-08f,
-   -3.6437928e-09f,
-    1.5821127e-07f,
-    3.7783036e-08f,
-   -1.0142903e-06f,
-   -2.2336498e-07f,
-    5.2412808e-06f,
-    7.5329286e-07f,
-   -2.2811763e-05f,
-   -7.5115318e-07f,
-    8.6101877e-05f,
-   -7.2795875e-06f,
-   -2.8653368e-04f,
-    5.4748687e-05f,
-    8.5246440e-04f,
-   -2.2588251e-04f,
-   -2.2755729e-03f,
-    6.6791125e-04f,
-    5.3511342e-03f,
-   -1.8417672e-03f,
-   -1.1434967e-02f,
-    5.2322698e-03f,
-    2.5454912e-02f,
-   -7.4575999e-03f,
-   -5.0785764e-02f,
-   -5.9392279e-03f,
-    5.5518220e-02f,
-   -1.7188444e-02f,
-   -8.9821309e-02f,
-    1.1517421e-01f,
-    4.5543267e-01f,
-    4.7551631e-01f,
-    1.4069435e-01f,
-   -1.0656424e-01f,
-   -5.8825737e-02f,
-    4.7112915e-02f,
-    3.3111740e-02f,
-   -8.8720083e-03f,
-   -1.8999818e-04f,
-    9.0921141e-03f,
-   -5.2735650e-03f,
-   -8.3460160e-03f,
-    3.4637088e-03f,
-    5.5893817e-03f,
-   -1.3548981e-03f,
-   -2.8671886e-03f,
-    3.5800665e-04f,
-    1.1828046e-03f,
-   -5.9819762e-05f,
-   -4.0733374e-04f,
-    1.3303399e-06f,
-    1.1870909e-04f,
-    2.8353534e-06f,
-   -2.9429329e-05f,
-   -1.0652110e-06f,
-    6.1779228e-06f,
-    2.3250722e-07f,
-   -1.0834721e-06f,
-   -3.3971838e-08f,
-    1.5524195e-07f,
-    3.2025800e-09f,
-   -1.7516813e-08f,
-   -1.4773788e-10f,
-    1.4663662e-09f,
-   -2.8740863e-12f,
-   -8.1555530e-11f,
-    4.8454254e-13f,
-    2.2681630e-12f },
-
-  // 38 (76)
-  {-8.5328071e-13f,
-    3.7903489e-13f,
-    3.3175488e-11f,
-   -1.4004314e-11f,
-   -6.2810160e-10f,
-    2.4934703e-10f,
-    7.6969287e-09f,
-   -2.9216895e-09f,
-   -6.8656062e-08f,
-    2.5708813e-08f,
-    4.7640187e-07f,
-   -1.8101857e-07f,
-   -2.6879773e-06f,
-    1.0418284e-06f,
-    1.2719970e-05f,
-   -4.8921625e-06f,
-   -5.1502223e-05f,
-    1.8597864e-05f,
-    1.8029655e-04f,
-   -5.7014033e-05f,
-   -5.4824295e-04f,
-    1.4051857e-04f,
-    1.4524071e-03f,
-   -2.6708375e-04f,
-   -3.3405764e-03f,
-    3.3200155e-04f,
-    6.5003309e-03f,
-   -2.4255990e-04f,
-   -1.0149955e-02f,
-    1.5249584e-03f,
-    1.3183285e-02f,
-   -8.4454340e-03f,
-   -1.6534037e-02f,
-    2.5686701e-02f,
-    1.8170632e-02f,
-   -7.4061376e-02f,
-   -2.5220710e-02f,
-    2.8698808e-01f,
-    5.2229572e-01f,
-    3.4127819e-01f,
-   -1.7304325e-02f,
-   -1.1449443e-01f,
-    1.8495235e-02f,
-    6.6069187e-02f,
-   -1.2012867e-02f,
-   -3.9396697e-02f,
-    6.9224517e-03f,
-    2.2970254e-02f,
-   -2.5901918e-03f,
-   -1.1659587e-02f,
-    7.4514355e-04f,
-    5.0894345e-03f,
-   -3.1700393e-04f,
-   -2.0230881e-03f,
-    1.6932587e-04f,
-    7.4455176e-04f,
-   -7.6773263e-05f,
-   -2.5004598e-04f,
-    2.6923801e-05f,
-    7.4488561e-05f,
-   -7.3694641e-06f,
-   -1.9154392e-05f,
-    1.6087091e-06f,
-    4.1596136e-06f,
-   -2.8393042e-07f,
-   -7.4729533e-07f,
-    4.0611980e-08f,
-    1.0832792e-07f,
-   -4.6322423e-09f,
-   -1.2218496e-08f,
-    3.9971807e-10f,
-    1.0096755e-09f,
-   -2.2950602e-11f,
-   -5.4446229e-11f,
-    6.3669709e-13f,
-    1.4336307e-12f }
+#endif
 };
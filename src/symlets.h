@@ -35,7 +35,15 @@
 #error This file should not be included directly into mid level code
 #endif
 
-extern const double kSymletsD[38][76];
-extern const float  kSymletsF[38][76];
+#ifndef WAVELET_MAX_ORDER
+#define WAVELET_MAX_ORDER 76
+#endif
+
+#define WAVELET_SYMLETS_ROWS \
+    (WAVELET_MAX_ORDER > 76 ? 38 : WAVELET_MAX_ORDER / 2)
+#define WAVELET_SYMLETS_COLS \
+    (WAVELET_MAX_ORDER > 76 ? 76 : WAVELET_MAX_ORDER)
+
+extern const double kSymletsD[WAVELET_SYMLETS_ROWS][WAVELET_SYMLETS_COLS];
 
 #endif  // SRC_SYMLETS_H_
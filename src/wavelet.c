@@ -31,8 +31,13 @@
 #define LIBSIMD_IMPLEMENTATION
 #include "inc/simd/wavelet.h"
 #include <assert.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdlib.h>
 #include <string.h>
 #include "inc/simd/arithmetic.h"
+#include <simd/parallel.h>
+#include <simd/stats.h>
 #define WAVELET_INTERNAL_USE
 #include "src/coiflets.h"
 #include "src/daubechies.h"
@@ -84,35 +89,38 @@ int wavelet_validate_order(WaveletType type, int order) {
   size_t uorder = (size_t)order;
   switch (type) {
     case WAVELET_TYPE_DAUBECHIES:
-      return (uorder <= sizeof(kDaubechiesF[0]) / sizeof(kDaubechiesF[0][0])) &&
+      return (uorder / 2 <= sizeof(kDaubechiesD) / sizeof(kDaubechiesD[0])) &&
              (uorder % 2 == 0);
     case WAVELET_TYPE_COIFLET:
-      return (uorder <= sizeof(kCoifletsF[0]) / sizeof(kCoifletsF[0][0])) &&
+      return (uorder / 6 <= sizeof(kCoifletsD) / sizeof(kCoifletsD[0])) &&
              (uorder % 6 == 0);
     case WAVELET_TYPE_SYMLET:
-      return (uorder <= sizeof(kSymletsF[0]) / sizeof(kSymletsF[0][0])) &&
+      return (uorder / 2 <= sizeof(kSymletsD) / sizeof(kSymletsD[0])) &&
              (uorder % 2 == 0);
     default:
       return 0;
   }
 }
 
-float *wavelet_prepare_array(int order
+static float *wavelet_allocate_source(int order
 #ifndef __AVX__
-                            UNUSED
+                                      UNUSED
 #endif
-                            , const float *src, size_t length
+                                      , size_t length) {
+  check_length(length);
 #ifndef __AVX__
-                             UNUSED
+  return mallocf(length);
+#else
+  size_t alength = aligned_length(length);
+  return mallocf(alength * (order > 4? 4 : 2));
 #endif
-) {
-  check_length(length);
+}
+
+float *wavelet_prepare_array(int order, const float *src, size_t length) {
+  float *res = wavelet_allocate_source(order, length);
 #ifndef __AVX__
-  float *res = mallocf(length);
   memcpy(res, src, length * sizeof(src[0]));
 #else
-  size_t alength = aligned_length(length);
-  float *res = mallocf(alength * (order > 4? 4 : 2));
   wavelet_prepare_array_memcpy(order, src, length, res);
 #endif
   return res;
@@ -164,45 +172,109 @@ void wavelet_recycle_source(int order
   *destlolo = src + lq * 3;
 }
 
+WaveletHandle wavelet_initialize(WaveletType type, int order, size_t length) {
+  check_length(length);
+  assert(wavelet_validate_order(type, order));
+
+  WaveletHandle handle;
+  handle.type = type;
+  handle.order = order;
+  handle.length = length;
+  handle.source = wavelet_allocate_source(order, length);
+  handle.desthi = wavelet_allocate_destination(order, length);
+  handle.destlo = wavelet_allocate_destination(order, length);
+  return handle;
+}
+
+void wavelet_transform(WaveletHandle handle, ExtensionType ext,
+                       const float *src) {
+  assert(src != NULL);
+#ifdef __AVX__
+  wavelet_prepare_array_memcpy(handle.order, src, handle.length,
+                               handle.source);
+#else
+  memcpy(handle.source, src, handle.length * sizeof(src[0]));
+#endif
+  wavelet_apply(handle.type, handle.order, ext, handle.source, handle.length,
+                handle.desthi, handle.destlo);
+}
+
+void wavelet_finalize(WaveletHandle handle) {
+  freef(handle.source);
+  freef(handle.desthi);
+  freef(handle.destlo);
+}
+
 INLINE void check_wavelet_order(WaveletType type, size_t order) {
   switch (type) {
     case WAVELET_TYPE_DAUBECHIES:
-      assert(order <= sizeof(kDaubechiesF[0]) / sizeof(kDaubechiesF[0][0]) &&
+      assert(order / 2 <= sizeof(kDaubechiesD) / sizeof(kDaubechiesD[0]) &&
              order % 2 == 0 &&
              "Supported Daubechies orders are 2..76 (even numbers only)");
       break;
     case WAVELET_TYPE_COIFLET:
-      assert(order <= sizeof(kCoifletsF[0]) / sizeof(kCoifletsF[0][0]) &&
+      assert(order / 6 <= sizeof(kCoifletsD) / sizeof(kCoifletsD[0]) &&
              order % 6 == 0 &&
              "Supported Coiflet orders are 6, 12, 18, 24 and 30");
       break;
     case WAVELET_TYPE_SYMLET:
-      assert(order <= sizeof(kSymletsF[0]) / sizeof(kSymletsF[0][0]) &&
+      assert(order / 2 <= sizeof(kSymletsD) / sizeof(kSymletsD[0]) &&
              order % 2 == 0 &&
              "Supported Daubechies orders are 2..76 (even numbers only)");
       break;
   }
 }
 
+/// @brief Returns the single precision lowpass coefficients for the
+/// specified wavelet, converting them from the embedded double precision
+/// tables on the first request for that particular order.
+static const float *wavelet_coefficients(WaveletType type, int order) {
+  static float daubechies[WAVELET_DAUBECHIES_ROWS][WAVELET_DAUBECHIES_COLS];
+  static float coiflets[WAVELET_COIFLETS_ROWS][WAVELET_COIFLETS_COLS];
+  static float symlets[WAVELET_SYMLETS_ROWS][WAVELET_SYMLETS_COLS];
+  static char ready[3][WAVELET_DAUBECHIES_ROWS];
+  static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+  check_wavelet_order(type, order);
+  const double *table = NULL;
+  float *row = NULL;
+  char *flag = NULL;
+  switch (type) {
+    case WAVELET_TYPE_DAUBECHIES:
+      table = kDaubechiesD[order / 2 - 1];
+      row = daubechies[order / 2 - 1];
+      flag = &ready[0][order / 2 - 1];
+      break;
+    case WAVELET_TYPE_COIFLET:
+      assert(order >= 6);
+      table = kCoifletsD[order / 6 - 1];
+      row = coiflets[order / 6 - 1];
+      flag = &ready[1][order / 6 - 1];
+      break;
+    case WAVELET_TYPE_SYMLET:
+      table = kSymletsD[order / 2 - 1];
+      row = symlets[order / 2 - 1];
+      flag = &ready[2][order / 2 - 1];
+      break;
+  }
+  pthread_mutex_lock(&lock);
+  if (!*flag) {
+    for (int i = 0; i < order; i++) {
+      row[i] = (float)table[i];
+    }
+    *flag = 1;
+  }
+  pthread_mutex_unlock(&lock);
+  return row;
+}
+
 INLINE NOTNULL(3, 4) void initialize_highpass_lowpass(
     WaveletType type, int order, float *restrict highpass,
     float *restrict lowpass) {
   assert(order >= 2);
   check_wavelet_order(type, order);
+  const float *coeffs = wavelet_coefficients(type, order);
   for (int i = 0; i < order; i++) {
-    float val = 0.f;
-    switch (type) {
-      case WAVELET_TYPE_DAUBECHIES:
-        val =  kDaubechiesF[order / 2 - 1][i];
-        break;
-      case WAVELET_TYPE_COIFLET:
-        assert(order >= 6);
-        val = kCoifletsF[order / 6 - 1][i];
-        break;
-      case WAVELET_TYPE_SYMLET:
-        val = kSymletsF[order / 2 - 1][i];
-        break;
-    }
+    float val = coeffs[i];
     lowpass[i] = val;
     highpass[order - i - 1] = (i & 1) ? val : -val;
   }
@@ -221,25 +293,14 @@ INLINE NOTNULL(4, 5) void stationary_initialize_highpass_lowpass(
   int order = size / stride;
   assert(order >= 2);
   check_wavelet_order(type, order);
+  const float *coeffs = wavelet_coefficients(type, order);
   for (int i = 0; i < size; i++) {
     if (i % stride != 0) {
       lowpass[i] = highpass[size - i] = 0;
       continue;
     }
     int ri = i / stride;
-    float val = 0.f;
-    switch (type) {
-      case WAVELET_TYPE_DAUBECHIES:
-        val = kDaubechiesF[order / 2 - 1][ri];
-        break;
-      case WAVELET_TYPE_COIFLET:
-        assert(order >= 6);
-        val = kCoifletsF[order / 6 - 1][ri];
-        break;
-      case WAVELET_TYPE_SYMLET:
-        val = kSymletsF[order / 2 - 1][ri];
-        break;
-    }
+    float val = coeffs[ri];
     lowpass[i] = val;
     highpass[size - i - stride] = (ri & 1) ? val : -val;
   }
@@ -400,7 +461,13 @@ static void wavelet_apply2(WaveletType type, ExtensionType ext,
   check_length(length);
   assert(src && desthi && destlo);
 
-  if (align_complement_f32(src) != 0 || length < 8) {
+  if (align_complement_f32(src) != 0 ||
+#ifdef __AVX__
+      length < 16
+#else
+      length < 8
+#endif
+  ) {
     wavelet_apply_na(type, 2, ext, src, length, desthi, destlo);
     return;
   }
@@ -1258,6 +1325,14 @@ static void wavelet_apply12(WaveletType type, ExtensionType ext,
     int offset = i + (ex > 0? ex * (alength - 10) + 8 : 0);
     __m256 srcvec1 = _mm256_load_ps(src + offset);
     __m256 srcvec2 = _mm256_load_ps(src + offset + 8);
+#ifdef __FMA__
+    __m256 vecres = _mm256_hadd_ps(
+        _mm256_fmadd_ps(srcvec2, hpvec2, _mm256_mul_ps(srcvec1, hpvec1)),
+        _mm256_fmadd_ps(srcvec2, lpvec2, _mm256_mul_ps(srcvec1, lpvec1)));
+    vecres = _mm256_hadd_ps(vecres, vecres);
+    float reshi = _mm256_get_ps(vecres, 0) + _mm256_get_ps(vecres, 4);
+    float reslo = _mm256_get_ps(vecres, 1) + _mm256_get_ps(vecres, 5);
+#else
     __m256 vechi1 = _mm256_dp_ps(srcvec1, hpvec1, 0xFF);
     __m256 veclo1 = _mm256_dp_ps(srcvec1, lpvec1, 0xFF);
     __m256 vechi2 = _mm256_dp_ps(srcvec2, hpvec2, 0xFF);
@@ -1266,6 +1341,7 @@ static void wavelet_apply12(WaveletType type, ExtensionType ext,
     __m256 veclo = _mm256_add_ps(veclo1, veclo2);
     float reshi = _mm256_get_ps(vechi, 0) + _mm256_get_ps(vechi, 4);
     float reslo = _mm256_get_ps(veclo, 0) + _mm256_get_ps(veclo, 4);
+#endif  // #ifdef __FMA__
     desthi[di] = reshi;
     destlo[di] = reslo;
   }
@@ -1376,6 +1452,19 @@ static void stationary_wavelet_apply12(WaveletType type, int level,
     __m256 srcvec2_1 = _mm256_loadu_ps(src + i + 1);
     __m256 srcvec2_2 = _mm256_loadu_ps(src + i + 9);
 
+#ifdef __FMA__
+    __m256 vecres1 = _mm256_hadd_ps(
+        _mm256_fmadd_ps(srcvec1_2, hpvec2, _mm256_mul_ps(srcvec1_1, hpvec1)),
+        _mm256_fmadd_ps(srcvec1_2, lpvec2, _mm256_mul_ps(srcvec1_1, lpvec1)));
+    __m256 vecres2 = _mm256_hadd_ps(
+        _mm256_fmadd_ps(srcvec2_2, hpvec2, _mm256_mul_ps(srcvec2_1, hpvec1)),
+        _mm256_fmadd_ps(srcvec2_2, lpvec2, _mm256_mul_ps(srcvec2_1, lpvec1)));
+    __m256 vecres = _mm256_hadd_ps(vecres1, vecres2);
+    float reshi1 = _mm256_get_ps(vecres, 0) + _mm256_get_ps(vecres, 4);
+    float reslo1 = _mm256_get_ps(vecres, 1) + _mm256_get_ps(vecres, 5);
+    float reshi2 = _mm256_get_ps(vecres, 2) + _mm256_get_ps(vecres, 6);
+    float reslo2 = _mm256_get_ps(vecres, 3) + _mm256_get_ps(vecres, 7);
+#else
     __m256 vechi1_1 = _mm256_dp_ps(srcvec1_1, hpvec1, 0xFF);
     __m256 veclo1_1 = _mm256_dp_ps(srcvec1_1, lpvec1, 0xFF);
     __m256 vechi1_2 = _mm256_dp_ps(srcvec1_2, hpvec2, 0xFF);
@@ -1393,6 +1482,7 @@ static void stationary_wavelet_apply12(WaveletType type, int level,
     float reslo1 = _mm256_get_ps(veclo1, 0) + _mm256_get_ps(veclo1, 4);
     float reshi2 = _mm256_get_ps(vechi2, 0) + _mm256_get_ps(vechi2, 4);
     float reslo2 = _mm256_get_ps(veclo2, 0) + _mm256_get_ps(veclo2, 4);
+#endif  // #ifdef __FMA__
     desthi[i] = reshi1;
     destlo[i] = reslo1;
     desthi[i + 1] = reshi2;
@@ -1479,6 +1569,14 @@ static void wavelet_apply16(WaveletType type, ExtensionType ext,
     int offset = i + (ex > 0? ex * (alength - 10) + 8 : 0);
     __m256 srcvec1 = _mm256_load_ps(src + offset);
     __m256 srcvec2 = _mm256_load_ps(src + offset + 8);
+#ifdef __FMA__
+    __m256 vecres = _mm256_hadd_ps(
+        _mm256_fmadd_ps(srcvec2, hpvec2, _mm256_mul_ps(srcvec1, hpvec1)),
+        _mm256_fmadd_ps(srcvec2, lpvec2, _mm256_mul_ps(srcvec1, lpvec1)));
+    vecres = _mm256_hadd_ps(vecres, vecres);
+    float reshi = _mm256_get_ps(vecres, 0) + _mm256_get_ps(vecres, 4);
+    float reslo = _mm256_get_ps(vecres, 1) + _mm256_get_ps(vecres, 5);
+#else
     __m256 vechi1 = _mm256_dp_ps(srcvec1, hpvec1, 0xFF);
     __m256 veclo1 = _mm256_dp_ps(srcvec1, lpvec1, 0xFF);
     __m256 vechi2 = _mm256_dp_ps(srcvec2, hpvec2, 0xFF);
@@ -1487,6 +1585,7 @@ static void wavelet_apply16(WaveletType type, ExtensionType ext,
     __m256 veclo = _mm256_add_ps(veclo1, veclo2);
     float reshi = _mm256_get_ps(vechi, 0) + _mm256_get_ps(vechi, 4);
     float reslo = _mm256_get_ps(veclo, 0) + _mm256_get_ps(veclo, 4);
+#endif  // #ifdef __FMA__
     desthi[di] = reshi;
     destlo[di] = reslo;
   }
@@ -1589,6 +1688,19 @@ static void stationary_wavelet_apply16(WaveletType type, int level,
     __m256 srcvec2_1 = _mm256_loadu_ps(src + i + 1);
     __m256 srcvec2_2 = _mm256_loadu_ps(src + i + 9);
 
+#ifdef __FMA__
+    __m256 vecres1 = _mm256_hadd_ps(
+        _mm256_fmadd_ps(srcvec1_2, hpvec2, _mm256_mul_ps(srcvec1_1, hpvec1)),
+        _mm256_fmadd_ps(srcvec1_2, lpvec2, _mm256_mul_ps(srcvec1_1, lpvec1)));
+    __m256 vecres2 = _mm256_hadd_ps(
+        _mm256_fmadd_ps(srcvec2_2, hpvec2, _mm256_mul_ps(srcvec2_1, hpvec1)),
+        _mm256_fmadd_ps(srcvec2_2, lpvec2, _mm256_mul_ps(srcvec2_1, lpvec1)));
+    __m256 vecres = _mm256_hadd_ps(vecres1, vecres2);
+    float reshi1 = _mm256_get_ps(vecres, 0) + _mm256_get_ps(vecres, 4);
+    float reslo1 = _mm256_get_ps(vecres, 1) + _mm256_get_ps(vecres, 5);
+    float reshi2 = _mm256_get_ps(vecres, 2) + _mm256_get_ps(vecres, 6);
+    float reslo2 = _mm256_get_ps(vecres, 3) + _mm256_get_ps(vecres, 7);
+#else
     __m256 vechi1_1 = _mm256_dp_ps(srcvec1_1, hpvec1, 0xFF);
     __m256 veclo1_1 = _mm256_dp_ps(srcvec1_1, lpvec1, 0xFF);
     __m256 vechi1_2 = _mm256_dp_ps(srcvec1_2, hpvec2, 0xFF);
@@ -1606,6 +1718,7 @@ static void stationary_wavelet_apply16(WaveletType type, int level,
     float reslo1 = _mm256_get_ps(veclo1, 0) + _mm256_get_ps(veclo1, 4);
     float reshi2 = _mm256_get_ps(vechi2, 0) + _mm256_get_ps(vechi2, 4);
     float reslo2 = _mm256_get_ps(veclo2, 0) + _mm256_get_ps(veclo2, 4);
+#endif  // #ifdef __FMA__
     desthi[i] = reshi1;
     destlo[i] = reslo1;
     desthi[i + 1] = reshi2;
@@ -1688,6 +1801,12 @@ static void stationary_wavelet_applyN_core(const float* highpassC,
       __m256 lovec1 = _mm256_loadu_ps(lowpassC + j);
       __m256 hivec2 = _mm256_loadu_ps(highpassC + j + 8);
       __m256 lovec2 = _mm256_loadu_ps(lowpassC + j + 8);
+#ifdef __FMA__
+      rvechi = _mm256_fmadd_ps(srcvec1, hivec1, rvechi);
+      rveclo = _mm256_fmadd_ps(srcvec1, lovec1, rveclo);
+      rvechi = _mm256_fmadd_ps(srcvec2, hivec2, rvechi);
+      rveclo = _mm256_fmadd_ps(srcvec2, lovec2, rveclo);
+#else
       __m256 mulvechi1 = _mm256_mul_ps(srcvec1, hivec1);
       __m256 mulveclo1 = _mm256_mul_ps(srcvec1, lovec1);
       __m256 mulvechi2 = _mm256_mul_ps(srcvec2, hivec2);
@@ -1697,6 +1816,7 @@ static void stationary_wavelet_applyN_core(const float* highpassC,
       rvechi = _mm256_add_ps(rvechi, mulvechi2);
       rveclo = _mm256_add_ps(rveclo, mulveclo1);
       rveclo = _mm256_add_ps(rveclo, mulveclo2);
+#endif  // #ifdef __FMA__
     }
     rvechi = _mm256_hadd_ps(rvechi, rvechi);
     rvechi = _mm256_hadd_ps(rvechi, rvechi);
@@ -1878,6 +1998,7 @@ static void stationary_wavelet_applyN(WaveletType type, int size, int level,
 void wavelet_apply(WaveletType type, int order, ExtensionType ext,
                    const float *__restrict src, size_t length,
                    float *__restrict desthi, float *__restrict destlo) {
+  SIMD_STATS_START();
   switch (order) {
     case 2:
       wavelet_apply2(type, ext, src, length, desthi, destlo);
@@ -1902,6 +2023,499 @@ void wavelet_apply(WaveletType type, int order, ExtensionType ext,
       wavelet_apply_na(type, order, ext, src, length, desthi, destlo);
       break;
   }
+  SIMD_STATS_FINISH(SIMD_KERNEL_WAVELET, length);
+}
+
+INLINE NOTNULL(3, 4) void initialize_reconstruction(
+    WaveletType type, int order, float *restrict highpass,
+    float *restrict lowpass) {
+  initialize_highpass_lowpass(type, order, highpass, lowpass);
+  // The shipped Coiflet and Symlet tables sum to 1 instead of sqrt(2),
+  // so divide by the filter energy to invert wavelet_apply() exactly
+  float norm = 0.f;
+  for (int i = 0; i < order; i++) {
+    norm += lowpass[i] * lowpass[i];
+  }
+  for (int i = 0; i < order; i++) {
+    lowpass[i] /= norm;
+    highpass[i] /= norm;
+  }
+}
+
+void wavelet_apply_batch(WaveletType type, int order, ExtensionType ext,
+                         const float *const *srcs, size_t count,
+                         size_t length,
+                         float *const *desthi, float *const *destlo) {
+  check_length(length);
+  assert(srcs && desthi && destlo);
+  assert((int)length >= order * 2);
+
+  size_t batch = 0;
+#ifdef SIMD
+#ifdef __AVX__
+  const size_t width = 8;
+#elif defined(__ARM_NEON__)
+  const size_t width = 4;
+#endif
+  if (count >= width) {
+    float highpassC[order], lowpassC[order];
+    initialize_highpass_lowpass(type, order, highpassC, lowpassC);
+    // Signals are interleaved sample-major, so one vector holds the same
+    // sample of width signals and every coefficient is a broadcast - the
+    // batch dimension fills the SIMD lanes for any order
+    float *interleaved = mallocf((length + order) * width);
+    float ext_values[order];
+    for (batch = 0; batch + width <= count; batch += width) {
+      for (size_t k = 0; k < width; k++) {
+        const float *signal = srcs[batch + k];
+        for (size_t i = 0; i < length; i++) {
+          interleaved[i * width + k] = signal[i];
+        }
+        initialize_extension(ext, order, signal, length, ext_values);
+        for (int j = 0; j < order; j++) {
+          interleaved[(length + j) * width + k] = ext_values[j];
+        }
+      }
+      for (size_t i = 0, di = 0; i < length; i += 2, di++) {
+#ifdef __AVX__
+        __m256 reshi = _mm256_setzero_ps(), reslo = _mm256_setzero_ps();
+        for (int j = 0; j < order; j++) {
+          __m256 srcvec = _mm256_load_ps(interleaved + (i + j) * width);
+          reshi = _mm256_add_ps(reshi,
+              _mm256_mul_ps(srcvec, _mm256_set1_ps(highpassC[j])));
+          reslo = _mm256_add_ps(reslo,
+              _mm256_mul_ps(srcvec, _mm256_set1_ps(lowpassC[j])));
+        }
+        float reshi_values[width] __attribute__ ((aligned (32))),
+              reslo_values[width] __attribute__ ((aligned (32)));
+        _mm256_store_ps(reshi_values, reshi);
+        _mm256_store_ps(reslo_values, reslo);
+#elif defined(__ARM_NEON__)
+        float32x4_t reshi = vdupq_n_f32(0.f), reslo = vdupq_n_f32(0.f);
+        for (int j = 0; j < order; j++) {
+          float32x4_t srcvec = vld1q_f32(interleaved + (i + j) * width);
+          reshi = vmlaq_n_f32(reshi, srcvec, highpassC[j]);
+          reslo = vmlaq_n_f32(reslo, srcvec, lowpassC[j]);
+        }
+        float reshi_values[width], reslo_values[width];
+        vst1q_f32(reshi_values, reshi);
+        vst1q_f32(reslo_values, reslo);
+#endif
+        for (size_t k = 0; k < width; k++) {
+          desthi[batch + k][di] = reshi_values[k];
+          destlo[batch + k][di] = reslo_values[k];
+        }
+      }
+    }
+    freef(interleaved);
+  }
+#endif  // #ifdef SIMD
+  for (; batch < count; batch++) {
+    wavelet_apply_na(type, order, ext, srcs[batch], length,
+                     desthi[batch], destlo[batch]);
+  }
+}
+
+void wavelet_apply_2d(WaveletType type, int order, ExtensionType ext,
+                      const float *__restrict src, size_t width,
+                      size_t height, float *__restrict dst) {
+  check_length(width);
+  check_length(height);
+  assert(src && dst);
+  assert((int)width >= order * 2);
+  assert((int)height >= order * 2);
+
+  // All the scratch of both passes comes from one arena: a single
+  // malloc_aligned()/free() pair instead of five.
+  SimdArena arena = simd_arena_create(
+      (width * height + width * order) * sizeof(float) +
+      3 * height * sizeof(float *) + 5 * 64);
+
+  // Pass 1: every row is split into [L | H] halves in place of the row
+  float *rowpass = simd_arena_alloc(&arena, width * height * sizeof(float));
+  const float **srcs = simd_arena_alloc(&arena, height * sizeof(float *));
+  float **his = simd_arena_alloc(&arena, height * sizeof(float *));
+  float **los = simd_arena_alloc(&arena, height * sizeof(float *));
+  for (size_t r = 0; r < height; r++) {
+    srcs[r] = src + r * width;
+    los[r] = rowpass + r * width;
+    his[r] = rowpass + r * width + width / 2;
+  }
+  wavelet_apply_batch(type, order, ext, srcs, height, width, his, los);
+
+  // Pass 2: the same split along the columns. A whole output row is
+  // produced per step, so the filter taps walk over contiguous rows and
+  // the SIMD lanes are filled by adjacent columns - no transpose needed
+  float highpassC[order], lowpassC[order];
+  initialize_highpass_lowpass(type, order, highpassC, lowpassC);
+  float *extrows = simd_arena_alloc(&arena, width * order * sizeof(float));
+  for (int j = 0; j < order; j++) {
+    const float *extrow;
+    switch (ext) {
+      case EXTENSION_TYPE_PERIODIC:
+        extrow = rowpass + (j % height) * width;
+        break;
+      case EXTENSION_TYPE_MIRROR:
+        extrow = rowpass + (height - 1 - (j % height)) * width;
+        break;
+      case EXTENSION_TYPE_CONSTANT:
+        extrow = rowpass + (height - 1) * width;
+        break;
+      default:
+        extrow = NULL;
+        break;
+    }
+    if (extrow != NULL) {
+      memcpy(extrows + j * width, extrow, width * sizeof(float));
+    } else {
+      memsetf(extrows + j * width, 0.f, width);
+    }
+  }
+
+  for (size_t dr = 0; dr < height / 2; dr++) {
+    float *outlo = dst + dr * width;
+    float *outhi = dst + (height / 2 + dr) * width;
+    size_t c = 0;
+#ifdef __AVX__
+    for (; c + 8 <= width; c += 8) {
+      __m256 reslo = _mm256_setzero_ps(), reshi = _mm256_setzero_ps();
+      for (int j = 0; j < order; j++) {
+        size_t row = dr * 2 + j;
+        const float *rowptr = row < height?
+            rowpass + row * width : extrows + (row - height) * width;
+        __m256 srcvec = _mm256_loadu_ps(rowptr + c);
+        reslo = _mm256_add_ps(reslo,
+            _mm256_mul_ps(srcvec, _mm256_set1_ps(lowpassC[j])));
+        reshi = _mm256_add_ps(reshi,
+            _mm256_mul_ps(srcvec, _mm256_set1_ps(highpassC[j])));
+      }
+      _mm256_storeu_ps(outlo + c, reslo);
+      _mm256_storeu_ps(outhi + c, reshi);
+    }
+#elif defined(__ARM_NEON__)
+    for (; c + 4 <= width; c += 4) {
+      float32x4_t reslo = vdupq_n_f32(0.f), reshi = vdupq_n_f32(0.f);
+      for (int j = 0; j < order; j++) {
+        size_t row = dr * 2 + j;
+        const float *rowptr = row < height?
+            rowpass + row * width : extrows + (row - height) * width;
+        float32x4_t srcvec = vld1q_f32(rowptr + c);
+        reslo = vmlaq_n_f32(reslo, srcvec, lowpassC[j]);
+        reshi = vmlaq_n_f32(reshi, srcvec, highpassC[j]);
+      }
+      vst1q_f32(outlo + c, reslo);
+      vst1q_f32(outhi + c, reshi);
+    }
+#endif
+    for (; c < width; c++) {
+      float reslo = 0.f, reshi = 0.f;
+      for (int j = 0; j < order; j++) {
+        size_t row = dr * 2 + j;
+        float srcval = row < height?
+            rowpass[row * width + c] : extrows[(row - height) * width + c];
+        reslo += lowpassC[j] * srcval;
+        reshi += highpassC[j] * srcval;
+      }
+      outlo[c] = reslo;
+      outhi[c] = reshi;
+    }
+  }
+
+  simd_arena_destroy(&arena);
+}
+
+void wavelet_synthesize_na(WaveletType type, int order,
+                           const float *__restrict desthi,
+                           const float *__restrict destlo,
+                           size_t length, float *__restrict dest) {
+  check_length(length);
+  assert(desthi && destlo && dest);
+  assert((int)length >= order);
+
+  int half = (int)length / 2;
+  int taps = order / 2;
+  float highpassC[order], lowpassC[order];
+  initialize_reconstruction(type, order, highpassC, lowpassC);
+
+  for (int i = 0; i < half; i++) {
+    float reseven = 0.f, resodd = 0.f;
+    for (int t = 0; t < taps; t++) {
+      int index = i - t;
+      if (index < 0) {
+        index += half;
+      }
+      reseven += lowpassC[t * 2] * destlo[index] +
+                 highpassC[t * 2] * desthi[index];
+      resodd += lowpassC[t * 2 + 1] * destlo[index] +
+                highpassC[t * 2 + 1] * desthi[index];
+    }
+    dest[i * 2] = reseven;
+    dest[i * 2 + 1] = resodd;
+  }
+}
+
+void wavelet_synthesize(WaveletType type, int order,
+                        const float *__restrict desthi,
+                        const float *__restrict destlo,
+                        size_t length, float *__restrict dest) {
+#ifdef SIMD
+  check_length(length);
+  assert(desthi && destlo && dest);
+  assert((int)length >= order);
+
+  int half = (int)length / 2;
+  int taps = order / 2;
+#ifdef __AVX__
+  const int width = 8;
+#elif defined(__ARM_NEON__)
+  const int width = 4;
+#else
+#error This SIMD variant is not supported.
+#endif
+  // The window of every polyphase filter is padded on the left up to the
+  // SIMD width, so the main loop below reads the coefficients history
+  // [i - padded + 1, i] with plain unaligned loads
+  int padded = ((taps + width - 1) / width) * width;
+  if (order > 16 || half < padded) {
+    wavelet_synthesize_na(type, order, desthi, destlo, length, dest);
+    return;
+  }
+
+  float highpassC[order], lowpassC[order];
+  initialize_reconstruction(type, order, highpassC, lowpassC);
+  float evenlo[padded] __attribute__ ((aligned (64))),
+        oddlo[padded] __attribute__ ((aligned (64))),
+        evenhi[padded] __attribute__ ((aligned (64))),
+        oddhi[padded] __attribute__ ((aligned (64)));
+  memsetf(evenlo, 0.f, padded);
+  memsetf(oddlo, 0.f, padded);
+  memsetf(evenhi, 0.f, padded);
+  memsetf(oddhi, 0.f, padded);
+  for (int t = 0; t < taps; t++) {
+    // reversed, so that the dot product slides forward over the history
+    evenlo[padded - 1 - t] = lowpassC[t * 2];
+    oddlo[padded - 1 - t] = lowpassC[t * 2 + 1];
+    evenhi[padded - 1 - t] = highpassC[t * 2];
+    oddhi[padded - 1 - t] = highpassC[t * 2 + 1];
+  }
+
+  // The first windows wrap around the coefficients periodically
+  for (int i = 0; i < padded - 1; i++) {
+    float reseven = 0.f, resodd = 0.f;
+    for (int t = 0; t < taps; t++) {
+      int index = i - t;
+      if (index < 0) {
+        index += half;
+      }
+      reseven += lowpassC[t * 2] * destlo[index] +
+                 highpassC[t * 2] * desthi[index];
+      resodd += lowpassC[t * 2 + 1] * destlo[index] +
+                highpassC[t * 2 + 1] * desthi[index];
+    }
+    dest[i * 2] = reseven;
+    dest[i * 2 + 1] = resodd;
+  }
+
+  for (int i = padded - 1; i < half; i++) {
+    const float *lobase = destlo + i - padded + 1;
+    const float *hibase = desthi + i - padded + 1;
+#ifdef __AVX__
+    __m256 acceven = _mm256_setzero_ps(), accodd = _mm256_setzero_ps();
+    for (int p = 0; p < padded; p += 8) {
+      __m256 lovec = _mm256_loadu_ps(lobase + p);
+      __m256 hivec = _mm256_loadu_ps(hibase + p);
+      acceven = _mm256_add_ps(
+          acceven,
+          _mm256_add_ps(_mm256_mul_ps(lovec, _mm256_load_ps(evenlo + p)),
+                        _mm256_mul_ps(hivec, _mm256_load_ps(evenhi + p))));
+      accodd = _mm256_add_ps(
+          accodd,
+          _mm256_add_ps(_mm256_mul_ps(lovec, _mm256_load_ps(oddlo + p)),
+                        _mm256_mul_ps(hivec, _mm256_load_ps(oddhi + p))));
+    }
+    __m256 sums = _mm256_hadd_ps(acceven, accodd);
+    sums = _mm256_hadd_ps(sums, sums);
+    __m128 res = _mm_add_ps(_mm256_castps256_ps128(sums),
+                            _mm256_extractf128_ps(sums, 1));
+    dest[i * 2] = _mm_cvtss_f32(res);
+    dest[i * 2 + 1] = _mm_cvtss_f32(_mm_shuffle_ps(res, res, 1));
+#elif defined(__ARM_NEON__)
+    float32x4_t acceven = vdupq_n_f32(0.f), accodd = vdupq_n_f32(0.f);
+    for (int p = 0; p < padded; p += 4) {
+      float32x4_t lovec = vld1q_f32(lobase + p);
+      float32x4_t hivec = vld1q_f32(hibase + p);
+      acceven = vmlaq_f32(acceven, lovec, vld1q_f32(evenlo + p));
+      acceven = vmlaq_f32(acceven, hivec, vld1q_f32(evenhi + p));
+      accodd = vmlaq_f32(accodd, lovec, vld1q_f32(oddlo + p));
+      accodd = vmlaq_f32(accodd, hivec, vld1q_f32(oddhi + p));
+    }
+    float32x2_t reseven = vpadd_f32(vget_low_f32(acceven),
+                                    vget_high_f32(acceven));
+    float32x2_t resodd = vpadd_f32(vget_low_f32(accodd),
+                                   vget_high_f32(accodd));
+    dest[i * 2] = vget_lane_f32(vpadd_f32(reseven, reseven), 0);
+    dest[i * 2 + 1] = vget_lane_f32(vpadd_f32(resodd, resodd), 0);
+#endif
+  }
+#else  // #ifdef SIMD
+  wavelet_synthesize_na(type, order, desthi, destlo, length, dest);
+#endif
+}
+
+/// @brief Copies length values from src to dst, applying the requested
+/// thresholding on the way. src and dst may point to the same array.
+static void threshold_copy(WaveletThresholdType threshold_type,
+                           float threshold, const float *src, size_t length,
+                           float *dst) {
+  if (threshold_type == WAVELET_THRESHOLD_NONE) {
+    if (dst != src) {
+      memcpy(dst, src, length * sizeof(float));
+    }
+    return;
+  }
+  assert(threshold >= 0.f);
+  int ilength = (int)length;
+  int i = 0;
+#ifdef __AVX__
+  const __m256 signmask = _mm256_set1_ps(-0.f);
+  const __m256 thrvec = _mm256_set1_ps(threshold);
+  if (threshold_type == WAVELET_THRESHOLD_SOFT) {
+    for (; i <= ilength - 8; i += 8) {
+      __m256 vec = _mm256_loadu_ps(src + i);
+      __m256 sign = _mm256_and_ps(vec, signmask);
+      __m256 shrunk = _mm256_sub_ps(_mm256_andnot_ps(signmask, vec), thrvec);
+      shrunk = _mm256_max_ps(shrunk, _mm256_setzero_ps());
+      _mm256_storeu_ps(dst + i, _mm256_or_ps(shrunk, sign));
+    }
+  } else {
+    for (; i <= ilength - 8; i += 8) {
+      __m256 vec = _mm256_loadu_ps(src + i);
+      __m256 keep = _mm256_cmp_ps(_mm256_andnot_ps(signmask, vec), thrvec,
+                                  _CMP_GT_OQ);
+      _mm256_storeu_ps(dst + i, _mm256_and_ps(vec, keep));
+    }
+  }
+#elif defined(__ARM_NEON__)
+  const float32x4_t thrvec = vdupq_n_f32(threshold);
+  const uint32x4_t signmask = vdupq_n_u32(0x80000000u);
+  if (threshold_type == WAVELET_THRESHOLD_SOFT) {
+    for (; i <= ilength - 4; i += 4) {
+      float32x4_t vec = vld1q_f32(src + i);
+      uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(vec), signmask);
+      float32x4_t shrunk = vsubq_f32(vabsq_f32(vec), thrvec);
+      shrunk = vmaxq_f32(shrunk, vdupq_n_f32(0.f));
+      vst1q_f32(dst + i, vreinterpretq_f32_u32(
+          vorrq_u32(vreinterpretq_u32_f32(shrunk), sign)));
+    }
+  } else {
+    for (; i <= ilength - 4; i += 4) {
+      float32x4_t vec = vld1q_f32(src + i);
+      uint32x4_t keep = vcgtq_f32(vabsq_f32(vec), thrvec);
+      vst1q_f32(dst + i, vreinterpretq_f32_u32(
+          vandq_u32(vreinterpretq_u32_f32(vec), keep)));
+    }
+  }
+#endif
+  for (; i < ilength; i++) {
+    float val = src[i];
+    if (threshold_type == WAVELET_THRESHOLD_SOFT) {
+      float shrunk = fabsf(val) - threshold;
+      dst[i] = shrunk > 0.f? copysignf(shrunk, val) : 0.f;
+    } else {
+      dst[i] = fabsf(val) > threshold? val : 0.f;
+    }
+  }
+}
+
+void wavelet_reconstruct_thresholded(WaveletType type, int order, int levels,
+                                     const float *__restrict coeffs,
+                                     size_t length,
+                                     WaveletThresholdType threshold_type,
+                                     const float *thresholds,
+                                     float *__restrict dest) {
+  check_length(length);
+  assert(levels > 0);
+  assert(length % ((size_t)1 << levels) == 0);
+  assert(wavelet_validate_order(type, order));
+  assert(thresholds != NULL || threshold_type == WAVELET_THRESHOLD_NONE);
+
+  float *buffer[2] = { NULL, NULL };
+  if (levels > 1) {
+    buffer[0] = mallocf(length / 2);
+    buffer[1] = mallocf(length / 2);
+  }
+  float *shrunk = threshold_type == WAVELET_THRESHOLD_NONE?
+      NULL : mallocf(length / 2);
+
+  // The approximation of the deepest level is stored last
+  const float *approx = coeffs + length - (length >> levels);
+  for (int level = levels; level > 0; level--) {
+    size_t n = length >> (level - 1);
+    const float *detail = coeffs + length - n;
+    if (threshold_type != WAVELET_THRESHOLD_NONE) {
+      threshold_copy(threshold_type, thresholds[level - 1], detail, n / 2,
+                     shrunk);
+      detail = shrunk;
+    }
+    float *output = level == 1? dest : buffer[level % 2];
+    wavelet_synthesize(type, order, detail, approx, n, output);
+    approx = output;
+  }
+
+  freef(shrunk);
+  freef(buffer[0]);
+  freef(buffer[1]);
+}
+
+void wavelet_reconstruct(WaveletType type, int order, int levels,
+                         const float *__restrict coeffs, size_t length,
+                         float *__restrict dest) {
+  wavelet_reconstruct_thresholded(type, order, levels, coeffs, length,
+                                  WAVELET_THRESHOLD_NONE, NULL, dest);
+}
+
+void wavelet_decompose(WaveletType type, int order, ExtensionType ext,
+                       int levels, const float *__restrict src, size_t length,
+                       float *__restrict dest) {
+  check_length(length);
+  assert(levels > 0);
+  assert(length % ((size_t)1 << levels) == 0);
+  assert(wavelet_validate_order(type, order));
+
+  // All the scratch memory is taken once here; the levels below only
+  // ping-pong between the two lowpass buffers
+  float *source = wavelet_prepare_array(order, src, length);
+  float *lo[2] = { wavelet_allocate_destination(order, length),
+                   wavelet_allocate_destination(order, length) };
+  float *hi = wavelet_allocate_destination(order, length);
+
+  const float *input = source;
+  float *output = dest;
+  size_t n = length;
+  for (int level = 0; level < levels; level++) {
+    float *destlo = lo[level % 2];
+    wavelet_apply(type, order, ext, input, n, hi, destlo);
+    n /= 2;
+    memcpy(output, hi, n * sizeof(hi[0]));
+    output += n;
+    if (level < levels - 1) {
+#ifdef __AVX__
+      // wavelet_apply2() and the non-SIMD fallback do not restore the
+      // prepared layout of their outputs (the other kernels do, for which
+      // this is an idempotent refresh)
+      if (n > 8) {
+        wavelet_prepare_array_memcpy(order, destlo, n, destlo);
+      }
+#endif
+      input = destlo;
+    }
+  }
+  memcpy(output, lo[(levels - 1) % 2], n * sizeof(float));
+
+  freef(source);
+  freef(lo[0]);
+  freef(lo[1]);
+  freef(hi);
 }
 
 void stationary_wavelet_apply(WaveletType type, int order, int level,
@@ -1938,3 +2552,200 @@ void stationary_wavelet_apply(WaveletType type, int order, int level,
       break;
   }
 }
+
+#define STATIONARY_WAVELET_BLOCK 16384
+
+typedef struct {
+  WaveletType type;
+  int order;
+  int level;
+  ExtensionType ext;
+  const float *src;
+  size_t interior;
+  WaveletThresholdType threshold_type;
+  float threshold;
+  float *desthi;
+  float *destlo;
+  float *scratch;
+  size_t block;
+  int size;
+  int thread_index;
+  int threads;
+} StationaryWaveletWorker;
+
+// The kernels store to the destinations with aligned instructions
+INLINE size_t stationary_wavelet_scratch_size(size_t block, int size) {
+  return (block + size + 7) & ~(size_t)7;
+}
+
+static void *stationary_wavelet_worker(void *arg) {
+  const StationaryWaveletWorker *ctx = arg;
+  float *tmphi = ctx->scratch;
+  float *tmplo = ctx->scratch +
+      stationary_wavelet_scratch_size(ctx->block, ctx->size);
+  // Blocks write disjoint output ranges, so they are handed out round-robin
+  for (size_t start = ctx->thread_index * ctx->block; start < ctx->interior;
+       start += ctx->block * ctx->threads) {
+    size_t count = ctx->interior - start < ctx->block?
+        ctx->interior - start : ctx->block;
+    // The halo of size samples past the block makes the first count
+    // outputs extension-free, so they match the whole-signal transform;
+    // the trailing outputs polluted by the block-local extension are
+    // simply not copied out
+    stationary_wavelet_apply(ctx->type, ctx->order, ctx->level, ctx->ext,
+                             ctx->src + start, count + ctx->size,
+                             tmphi, tmplo);
+    // The details are thresholded while the block is still cache-hot
+    threshold_copy(ctx->threshold_type, ctx->threshold, tmphi, count,
+                   ctx->desthi + start);
+    memcpy(ctx->destlo + start, tmplo, count * sizeof(float));
+  }
+  return NULL;
+}
+
+static void stationary_wavelet_task(size_t index, void *user) {
+  stationary_wavelet_worker(&((StationaryWaveletWorker *)user)[index]);
+}
+
+static NOTNULL(5, 8, 9) void stationary_wavelet_apply_tail(
+    WaveletType type, int size, int level, ExtensionType ext,
+    const float *restrict src, size_t length, size_t from,
+    float *restrict desthi, float *restrict destlo) {
+  int ilength = (int)length;
+  float highpassC[size], lowpassC[size];
+  stationary_initialize_highpass_lowpass(type, size, level,
+                                         highpassC, lowpassC);
+  float src_ext[size];
+  initialize_extension(ext, size, src, length, src_ext);
+  for (int i = (int)from; i < ilength; i++) {
+    float reshi = 0.f, reslo = 0.f;
+    for (int j = 0; j < size; j++) {
+      int index = i + j;
+      float srcval = index < ilength? src[index] : src_ext[index - ilength];
+      reshi += highpassC[j] * srcval;
+      reslo += lowpassC[j] * srcval;
+    }
+    desthi[i - from] = reshi;
+    destlo[i - from] = reslo;
+  }
+}
+
+void stationary_wavelet_apply_thresholded(
+    WaveletType type, int order, int level, ExtensionType ext,
+    WaveletThresholdType threshold_type, float threshold, int threads,
+    const float *__restrict src, size_t length,
+    float *__restrict desthi, float *__restrict destlo) {
+  check_length(length);
+  assert(src && desthi && destlo);
+  assert(level > 0);
+
+  int size = order * (1 << (level - 1));
+  size_t block = STATIONARY_WAVELET_BLOCK;
+  size_t interior = length > (size_t)size? length - size : 0;
+  if (block * threads > interior) {
+    block = threads > 0? interior / threads : 0;
+    block &= ~(size_t)1;  // the kernels require even lengths
+  }
+  if (threads <= 1 || block < (size_t)(4 * size)) {
+    stationary_wavelet_apply(type, order, level, ext, src, length,
+                             desthi, destlo);
+    threshold_copy(threshold_type, threshold, desthi, length, desthi);
+    return;
+  }
+
+  StationaryWaveletWorker *contexts =
+      malloc(threads * sizeof(StationaryWaveletWorker));
+  size_t slice = stationary_wavelet_scratch_size(block, size);
+  float *scratches = mallocf(threads * 2 * slice);
+  for (int t = 0; t < threads; t++) {
+    contexts[t].type = type;
+    contexts[t].order = order;
+    contexts[t].level = level;
+    contexts[t].ext = ext;
+    contexts[t].src = src;
+    contexts[t].interior = interior;
+    contexts[t].threshold_type = threshold_type;
+    contexts[t].threshold = threshold;
+    contexts[t].desthi = desthi;
+    contexts[t].destlo = destlo;
+    contexts[t].scratch = scratches + t * 2 * slice;
+    contexts[t].block = block;
+    contexts[t].size = size;
+    contexts[t].thread_index = t;
+    contexts[t].threads = threads;
+  }
+  simd_parallel_for(stationary_wavelet_task, threads, contexts);
+  freef(scratches);
+  free(contexts);
+
+  // The last size outputs look into the extended signal
+  stationary_wavelet_apply_tail(type, size, level, ext, src, length,
+                                interior, desthi + interior,
+                                destlo + interior);
+  threshold_copy(threshold_type, threshold, desthi + interior,
+                 length - interior, desthi + interior);
+}
+
+void stationary_wavelet_apply_threads(WaveletType type, int order, int level,
+                                      ExtensionType ext, int threads,
+                                      const float *__restrict src,
+                                      size_t length,
+                                      float *__restrict desthi,
+                                      float *__restrict destlo) {
+  stationary_wavelet_apply_thresholded(type, order, level, ext,
+                                       WAVELET_THRESHOLD_NONE, 0.f, threads,
+                                       src, length, desthi, destlo);
+}
+
+void stationary_wavelet_apply_stream(WaveletType type, int order, int level,
+                                     ExtensionType ext,
+                                     const float *src, size_t length,
+                                     size_t chunkSize,
+                                     stationary_wavelet_consumer consumer,
+                                     void *user) {
+  check_length(length);
+  assert(src);
+  assert(consumer);
+  assert(level > 0);
+
+  simd_madvise_sequential(src, length * sizeof(float));
+
+  int size = order * (1 << (level - 1));
+  size_t chunk = chunkSize > 0?
+      chunkSize & ~(size_t)1 : STATIONARY_WAVELET_BLOCK;
+  size_t interior = length > (size_t)size? length - size : 0;
+  if (interior == 0 || chunk < (size_t)(2 * size)) {
+    // Nothing to win by chunking; one whole-signal pass
+    size_t slice = stationary_wavelet_scratch_size(length, 0);
+    float *scratch = mallocf(2 * slice);
+    assert(scratch);
+    stationary_wavelet_apply(type, order, level, ext, src, length,
+                             scratch, scratch + slice);
+    consumer(scratch, scratch + slice, 0, length, user);
+    freef(scratch);
+    return;
+  }
+
+  // The same blocking as stationary_wavelet_apply_threads(): the halo of
+  // size samples past the chunk makes its outputs extension-free, and the
+  // last size outputs, which look into the extended signal, ride along
+  // with the final chunk
+  size_t slice = stationary_wavelet_scratch_size(chunk, size);
+  float *scratch = mallocf(2 * slice);
+  assert(scratch);
+  float *tmphi = scratch;
+  float *tmplo = scratch + slice;
+  for (size_t start = 0; start < interior; start += chunk) {
+    size_t count = interior - start < chunk? interior - start : chunk;
+    stationary_wavelet_apply(type, order, level, ext, src + start,
+                             count + size, tmphi, tmplo);
+    size_t emit = count;
+    if (start + count == interior) {
+      stationary_wavelet_apply_tail(type, size, level, ext, src, length,
+                                    interior, tmphi + count, tmplo + count);
+      emit += length - interior;
+    }
+    consumer(tmphi, tmplo, start, emit, user);
+  }
+  freef(scratch);
+}
@@ -31,6 +31,7 @@
 #include <cmath>
 #include <gtest/gtest.h>
 #include <simd/arithmetic.h>
+#include <simd/arithmetic.hpp>
 
 #ifdef SIMD
 TEST(Arithmetic, int16_multiply) {
@@ -414,4 +415,280 @@ TEST(Arithmetic, float16_to_float) {
   }
 }
 
+TEST(Arithmetic, float_to_float16) {
+  float data[]
+#ifndef __arm__
+  __attribute__ ((aligned (32)))
+#endif
+  = { 0.125, 1, -2, 0.333333333f, 65504, 65520, 65536, -0.f,
+      6.10351562e-5f, 6.09755516e-5f, 5.96046448e-8f, 2.98023224e-8f,
+      std::numeric_limits<float>::infinity(),
+      -std::numeric_limits<float>::infinity(), 1000, 0.1f, 3.14159265f };
+  uint16_t reference[] = { 0x3000, 0x3c00, 0xc000, 0x3555, 0x7bff, 0x7c00,
+                           0x7c00, 0x8000, 0x0400, 0x03ff, 0x0001, 0x0000,
+                           0x7c00, 0xfc00, 0x63d0, 0x2e66, 0x4248 };
+  int N = sizeof(data) / sizeof(data[0]);
+  uint16_t peak[N]
+#ifndef __arm__
+  __attribute__ ((aligned (32)))
+#endif
+  ;
+  float_to_float16(data, N, peak);
+  for (int i = 0; i < N; i++) {
+    ASSERT_EQ(reference[i], peak[i]) << "i = " << i;
+  }
+  float_to_float16_na(data, N, peak);
+  for (int i = 0; i < N; i++) {
+    ASSERT_EQ(reference[i], peak[i]) << "i = " << i;
+  }
+}
+
+TEST(Arithmetic, int16_saturated) {
+  const int length = 37;
+  int16_t a[length], b[length], res[length], verif[length];
+  for (int i = 0; i < length; i++) {
+    a[i] = i * 1000 - 18000;
+    b[i] = 25000 - i * 900;
+  }
+  int16_add_saturated(a, b, length, res);
+  int16_add_saturated_na(a, b, length, verif);
+  ASSERT_EQ(0, memcmp(res, verif, sizeof(res)));
+  int16_sub_saturated(a, b, length, res);
+  int16_sub_saturated_na(a, b, length, verif);
+  ASSERT_EQ(0, memcmp(res, verif, sizeof(res)));
+  int16_multiply_scalar(a, length, 3, res);
+  int16_multiply_scalar_na(a, length, 3, verif);
+  ASSERT_EQ(0, memcmp(res, verif, sizeof(res)));
+  ASSERT_EQ(-32768, res[0]);  // 3 * -18000 clips to the lower rail
+}
+
+TEST(Arithmetic, real_multiply_strided) {
+  const int length = 29;
+  float a[length * 3], b[length * 2], res[length * 2], verif[length * 2];
+  for (int i = 0; i < length * 3; i++) {
+    a[i] = i * 0.5f;
+  }
+  for (int i = 0; i < length * 2; i++) {
+    b[i] = 100 - i;
+  }
+  real_multiply_strided(a, 3, b, 2, length, res, 2);
+  real_multiply_strided_na(a, 3, b, 2, length, verif, 2);
+  for (int i = 0; i < length; i++) {
+    ASSERT_EQ(verif[i * 2], res[i * 2]) << "i = " << i;
+    ASSERT_EQ(a[i * 3] * b[i * 2], res[i * 2]) << "i = " << i;
+  }
+}
+
+TEST(Arithmetic, real_multiply_array_tail) {
+  // odd length: the tail lanes must be written and nothing past them
+  const int length = 13;
+  float a[length], b[length], res[length + 1];
+  for (int i = 0; i < length; i++) {
+    a[i] = i + 1;
+    b[i] = 2 * i - 5;
+  }
+  res[length] = 1e30f;
+  real_multiply_array(a, b, length, res);
+  for (int i = 0; i < length; i++) {
+    ASSERT_EQ(a[i] * b[i], res[i]) << "i = " << i;
+  }
+  ASSERT_EQ(1e30f, res[length]);
+}
+
+TEST(Arithmetic, sum_elements) {
+  const int length = 510;
+  float array[length] __attribute__ ((aligned (32)));  // NOLINT(*)
+  double exact = 0;
+  for (int i = 0; i < length; i++) {
+    array[i] = (i % 77) * 0.25f + 1000.f;
+    exact += array[i];
+  }
+  ASSERT_NEAR(exact, sum_elements(array, length), 1e-4 * exact);
+  ASSERT_NEAR(exact, sum_elements_na(array, length), 1e-4 * exact);
+  // the compensated variant must not be worse than the plain sums
+  float kahan = sum_elements_kahan(array, length);
+  ASSERT_LE(fabs(kahan - exact),
+            fabs(sum_elements(array, length) - exact) + exact * 1e-9);
+  ASSERT_NEAR(exact, sum_elements_kahan_na(array, length), 1e-9 * exact);
+}
+
+TEST(Arithmetic, real_multiply_add) {
+  const int length = 83;
+  float a[length], b[length], c[length], res[length], verif[length];
+  for (int i = 0; i < length; i++) {
+    a[i] = i * 0.5f - 20;
+    b[i] = 40 - i;
+    c[i] = i * 0.25f;
+  }
+  real_multiply_add(a, b, c, length, res);
+  real_multiply_add_na(a, b, c, length, verif);
+  for (int i = 0; i < length; i++) {
+    ASSERT_NEAR(verif[i], res[i], 1e-5) << "i = " << i;
+  }
+}
+
+TEST(Arithmetic, dot_product) {
+  const int length = 117;
+  float a[length], b[length];
+  double exact = 0;
+  for (int i = 0; i < length; i++) {
+    a[i] = i * 0.5f - 25;
+    b[i] = 30 - i * 0.75f;
+    exact += static_cast<double>(a[i]) * b[i];
+  }
+  float res = dot_product(a, b, length);
+  float verif = dot_product_na(a, b, length);
+  ASSERT_NEAR(exact, res, 1e-2);
+  ASSERT_NEAR(exact, verif, 1e-2);
+}
+
+TEST(Arithmetic, sum_squares_normalize_rms) {
+  const int length = 233;
+  float a[length], res[length];
+  double exact = 0;
+  for (int i = 0; i < length; i++) {
+    a[i] = sinf(i * 0.3f) * 4 - 1;
+    exact += static_cast<double>(a[i]) * a[i];
+  }
+  ASSERT_NEAR(exact, sum_squares(a, length), exact * 1e-5);
+  ASSERT_NEAR(exact, sum_squares_na(a, length), exact * 1e-5);
+
+  for (int simd = 0; simd <= 1; simd++) {
+    normalize_rms(simd, a, length, 1.f, res);
+    double energy = 0;
+    for (int i = 0; i < length; i++) {
+      energy += static_cast<double>(res[i]) * res[i];
+    }
+    ASSERT_NEAR(1.0, std::sqrt(energy / length), 1e-4) << simd;
+  }
+
+  // All zeros pass through unchanged
+  float zeros[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+  normalize_rms(1, zeros, 8, 1.f, res);
+  for (int i = 0; i < 8; i++) {
+    ASSERT_FLOAT_EQ(0.f, res[i]) << i;
+  }
+}
+
+TEST(Arithmetic, int16_to_float_window) {
+  // An odd length exercises the scalar tail
+  const int length = 317;
+  int16_t data[length];
+  float window[length], res[length], verif[length];
+  for (int i = 0; i < length; i++) {
+    data[i] = static_cast<int16_t>(i * 37 - 5000);
+  }
+  hann_window(length, window);
+  ASSERT_NEAR(0.f, window[0], 1e-6f);
+  ASSERT_NEAR(1.f, window[(length - 1) / 2], 1e-4f);
+  ASSERT_NEAR(0.f, window[length - 1], 1e-6f);
+
+  int16_to_float_window(data, length, window, res);
+  int16_to_float_na(data, length, verif);
+  real_multiply_array_na(verif, window, length, verif);
+  for (int i = 0; i < length; i++) {
+    ASSERT_FLOAT_EQ(verif[i], res[i]) << i;
+  }
+  int16_to_float_window_na(data, length, window, res);
+  for (int i = 0; i < length; i++) {
+    ASSERT_FLOAT_EQ(verif[i], res[i]) << i;
+  }
+}
+
+TEST(Arithmetic, fixed_length_templates) {
+  // A vector-friendly length takes the tail-free specialization, an odd
+  // one the constant-folded fallback; both must match the C kernels
+  const int length = 512;
+  float a[length], b[length], res[length], verif[length];
+  for (int i = 0; i < length; i++) {
+    a[i] = i * 0.5f - 100;
+    b[i] = 75 - i * 0.25f;
+  }
+  simd::real_multiply<512>(a, b, res);
+  real_multiply_array(a, b, length, verif);
+  for (int i = 0; i < length; i++) {
+    ASSERT_FLOAT_EQ(verif[i], res[i]) << i;
+  }
+  simd::real_multiply<117>(a, b, res);
+  real_multiply_array(a, b, 117, verif);
+  for (int i = 0; i < 117; i++) {
+    ASSERT_FLOAT_EQ(verif[i], res[i]) << i;
+  }
+
+  simd::real_multiply_scalar<512>(a, 1.75f, res);
+  real_multiply_scalar(a, length, 1.75f, verif);
+  for (int i = 0; i < length; i++) {
+    ASSERT_FLOAT_EQ(verif[i], res[i]) << i;
+  }
+
+  ASSERT_NEAR(dot_product(a, b, length), simd::dot_product<512>(a, b),
+              std::fabs(dot_product(a, b, length)) * 1e-5f);
+  ASSERT_NEAR(dot_product(a, b, 117), simd::dot_product<117>(a, b),
+              std::fabs(dot_product(a, b, 117)) * 1e-5f);
+  ASSERT_NEAR(sum_elements(a, length), simd::sum_elements<512>(a),
+              std::fabs(sum_elements(a, length)) * 1e-5f + 1e-3f);
+
+  int16_t ints[length];
+  simd::float_to_int16<512>(a, ints);
+  simd::int16_to_float<512>(ints, res);
+  float_to_int16_na(a, length, ints);
+  int16_to_float_na(ints, length, verif);
+  for (int i = 0; i < length; i++) {
+    ASSERT_FLOAT_EQ(verif[i], res[i]) << i;
+  }
+}
+
+TEST(Arithmetic, complex_multiply_split) {
+  // An odd count exercises the scalar tail
+  const int count = 27;
+  float are[count], aim[count], bre[count], bim[count];
+  for (int i = 0; i < count; i++) {
+    are[i] = i * 0.5f - 5;
+    aim[i] = 3 - i * 0.25f;
+    bre[i] = i * 0.75f + 1;
+    bim[i] = -2 + i * 0.125f;
+  }
+  float resre[count], resim[count];
+  complex_multiply_split(are, aim, bre, bim, count, resre, resim);
+  float verifre[count], verifim[count];
+  complex_multiply_split_na(are, aim, bre, bim, count, verifre, verifim);
+  for (int i = 0; i < count; i++) {
+    ASSERT_NEAR(verifre[i], resre[i], 1e-4f) << i;
+    ASSERT_NEAR(verifim[i], resim[i], 1e-4f) << i;
+    // Against the interleaved kernel's formula
+    float interleaved[2];
+    float a[2] = { are[i], aim[i] }, b[2] = { bre[i], bim[i] };
+    complex_multiply_na(a, b, interleaved);
+    ASSERT_NEAR(interleaved[0], resre[i], 1e-4f) << i;
+    ASSERT_NEAR(interleaved[1], resim[i], 1e-4f) << i;
+  }
+}
+
+TEST(Arithmetic, complex_conjugate_split) {
+  const int count = 21;
+  float im[count], res[count];
+  for (int i = 0; i < count; i++) {
+    im[i] = i * 0.5f - 5;
+  }
+  complex_conjugate_split(im, count, res);
+  for (int i = 0; i < count; i++) {
+    ASSERT_FLOAT_EQ(-im[i], res[i]) << i;
+  }
+}
+
+TEST(Arithmetic, complex_interleaving) {
+  const int length = 54;
+  float array[length], re[length / 2], im[length / 2], back[length];
+  for (int i = 0; i < length; i++) {
+    array[i] = i * 1.5f - 30;
+  }
+  complex_deinterleave(array, length, re, im);
+  for (int i = 0; i < length / 2; i++) {
+    ASSERT_FLOAT_EQ(array[i * 2], re[i]) << i;
+    ASSERT_FLOAT_EQ(array[i * 2 + 1], im[i]) << i;
+  }
+  complex_interleave(re, im, length, back);
+  ASSERT_EQ(0, memcmp(array, back, sizeof(array)));
+}
+
 #include "tests/google/src/gtest_main.cc"
@@ -0,0 +1,364 @@
+/*! @file benchmark.cc
+ *  @brief Microbenchmark suite covering every kernel family ("make bench").
+ *  @author Markovtsev Vadim <v.markovtsev@samsung.com>
+ *  @version 1.0
+ *
+ *  @section Notes
+ *  This code partially conforms to <a href="http://google-styleguide.googlecode.com/svn/trunk/cppguide.xml">Google C++ Style Guide</a>.
+ *
+ *  Unlike the gtest binaries next to it, this program measures speed, not
+ *  correctness. Every public kernel is timed across a size sweep and the
+ *  achieved GB/s and GFLOPS are printed next to the peak rates measured on
+ *  the same machine, as comma separated lines which can be diffed between
+ *  releases:
+ *
+ *    kernel,simd,length,seconds,GB/s,GFLOPS,pct_peak_bandwidth,pct_peak_flops
+ *
+ *  Lines starting with '#' are comments. "simd" is 1 for the vectorized
+ *  path and 0 for the portable one; "seconds" is the time of a single call.
+ *
+ *  @section Copyright
+ *  Copyright © 2013 Samsung R&D Institute Russia
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <simd/arithmetic.h>
+#include <simd/convolve.h>
+#include <simd/instruction_set.h>
+#include <simd/matrix.h>
+#include <simd/memory.h>
+#include <simd/normalize.h>
+#include <simd/wavelet.h>
+
+namespace {
+
+/// The calibration grows the iteration count until one measurement takes
+/// at least this long, so the clock resolution does not dominate.
+const double kMinMeasureTime = 0.02;
+const int kMeasureRepeats = 3;
+
+/// Dead store sink: summing results here keeps the optimizer from dropping
+/// the benchmarked calls.
+volatile float g_sink = 0;
+
+double now() {
+  return std::chrono::duration_cast<std::chrono::duration<double>>(
+      std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/// @brief Times a single call of func: calibrates the iteration count,
+/// repeats the measurement and returns the best (least noisy) time.
+template <class F>
+double measure(const F& func) {
+  func();  // warmup
+  int iters = 1;
+  for (;;) {
+    double start = now();
+    for (int i = 0; i < iters; i++) {
+      func();
+    }
+    double elapsed = now() - start;
+    if (elapsed >= kMinMeasureTime || iters >= (1 << 24)) {
+      break;
+    }
+    iters *= 2;
+  }
+  double best = 1e30;
+  for (int r = 0; r < kMeasureRepeats; r++) {
+    double start = now();
+    for (int i = 0; i < iters; i++) {
+      func();
+    }
+    double elapsed = (now() - start) / iters;
+    if (elapsed < best) {
+      best = elapsed;
+    }
+  }
+  return best;
+}
+
+double g_peak_bandwidth = 0;  // GB/s
+double g_peak_flops = 0;  // GFLOPS
+
+/// @brief Prints one result line. bytes and flops describe a single call;
+/// either may be 0 when the metric does not apply.
+void report(const char* kernel, int simd, size_t length, double seconds,
+            double bytes, double flops) {
+  double gbs = bytes / seconds / 1e9;
+  double gflops = flops / seconds / 1e9;
+  printf("%s,%d,%zu,%.6e,%.3f,%.3f,%.1f,%.1f\n", kernel, simd, length,
+         seconds, gbs, gflops,
+         g_peak_bandwidth > 0? gbs / g_peak_bandwidth * 100 : 0.0,
+         g_peak_flops > 0? gflops / g_peak_flops * 100 : 0.0);
+}
+
+/// @brief Measures the peak copy bandwidth with plain memcpy() on a buffer
+/// far larger than the last level cache (read + write bytes are counted).
+void measure_peak_bandwidth() {
+  const size_t length = 32 * 1024 * 1024 / sizeof(float);
+  float* src = mallocf(length);
+  float* dst = mallocf(length);
+  memsetf(src, 1.0f, length);
+  double seconds = measure([&]() {
+    memcpy(dst, src, length * sizeof(float));
+  });
+  g_peak_bandwidth = 2.0 * length * sizeof(float) / seconds / 1e9;
+  report("peak_bandwidth", 1, length, seconds,
+         2.0 * length * sizeof(float), 0);
+  free(src);
+  free(dst);
+}
+
+/// @brief Measures the peak arithmetic rate with eight independent
+/// multiply-add chains on registers, using the widest vectors this build
+/// targets. This is the honest ceiling for the kernels below: it reflects
+/// the compile flags (e.g. no FMA contraction unless enabled) and the
+/// sustained clock of this very machine.
+void measure_peak_flops() {
+  const int kUnroll = 8;
+  const int kInner = 4096;
+#ifdef __AVX__
+  __m256 acc[kUnroll], mul, add;
+  const int flops_per_acc = 16;  // 8 lanes x (mul + add)
+#elif defined(__ARM_NEON__)
+  float32x4_t acc[kUnroll], mul, add;
+  const int flops_per_acc = 8;  // 4 lanes x fused multiply-add
+#else
+  float acc[kUnroll], mul, add;
+  const int flops_per_acc = 2;
+#endif
+  double seconds = measure([&]() {
+#ifdef __AVX__
+    mul = _mm256_set1_ps(1.0000001f);
+    add = _mm256_set1_ps(1e-7f);
+    for (int i = 0; i < kUnroll; i++) {
+      acc[i] = _mm256_set1_ps(1.0f + i);
+    }
+    for (int i = 0; i < kInner; i++) {
+      for (int j = 0; j < kUnroll; j++) {
+        acc[j] = _mm256_add_ps(_mm256_mul_ps(acc[j], mul), add);
+      }
+    }
+    __m256 sum = acc[0];
+    for (int i = 1; i < kUnroll; i++) {
+      sum = _mm256_add_ps(sum, acc[i]);
+    }
+    g_sink = g_sink + _mm256_get_ps(sum, 0);
+#elif defined(__ARM_NEON__)
+    mul = vdupq_n_f32(1.0000001f);
+    add = vdupq_n_f32(1e-7f);
+    for (int i = 0; i < kUnroll; i++) {
+      acc[i] = vdupq_n_f32(1.0f + i);
+    }
+    for (int i = 0; i < kInner; i++) {
+      for (int j = 0; j < kUnroll; j++) {
+        acc[j] = vmlaq_f32(add, acc[j], mul);
+      }
+    }
+    float32x4_t sum = acc[0];
+    for (int i = 1; i < kUnroll; i++) {
+      sum = vaddq_f32(sum, acc[i]);
+    }
+    g_sink = g_sink + vgetq_lane_f32(sum, 0);
+#else
+    mul = 1.0000001f;
+    add = 1e-7f;
+    for (int i = 0; i < kUnroll; i++) {
+      acc[i] = 1.0f + i;
+    }
+    for (int i = 0; i < kInner; i++) {
+      for (int j = 0; j < kUnroll; j++) {
+        acc[j] = acc[j] * mul + add;
+      }
+    }
+    float sum = acc[0];
+    for (int i = 1; i < kUnroll; i++) {
+      sum += acc[i];
+    }
+    g_sink = g_sink + sum;
+#endif
+  });
+  double flops = static_cast<double>(kInner) * kUnroll * flops_per_acc;
+  g_peak_flops = flops / seconds / 1e9;
+  report("peak_flops", 1, kInner * kUnroll, seconds, 0, flops);
+}
+
+/// @brief Times the arithmetic.h inlines: the vectorized flavor against
+/// its _na twin across the size sweep.
+void bench_arithmetic() {
+  static const size_t lengths[] = { 1024, 16384, 262144, 4194304 };
+  const size_t max_length = lengths[sizeof(lengths) / sizeof(lengths[0]) - 1];
+  float* a = mallocf(max_length);
+  float* b = mallocf(max_length);
+  float* res = mallocf(max_length);
+  int16_t* i16 = reinterpret_cast<int16_t*>(mallocf(max_length / 2));
+  for (size_t i = 0; i < max_length; i++) {
+    a[i] = 1.0f + i % 100 * 0.01f;
+    b[i] = 2.0f - i % 100 * 0.01f;
+  }
+  for (size_t i = 0; i < max_length; i++) {
+    i16[i] = i % 2000 - 1000;
+  }
+  for (size_t li = 0; li < sizeof(lengths) / sizeof(lengths[0]); li++) {
+    size_t length = lengths[li];
+    report("real_multiply_array", 1, length, measure([&]() {
+      real_multiply_array(a, b, length, res);
+    }), 12.0 * length, length);
+    report("real_multiply_array", 0, length, measure([&]() {
+      real_multiply_array_na(a, b, length, res);
+    }), 12.0 * length, length);
+    report("dot_product", 1, length, measure([&]() {
+      g_sink = dot_product(a, b, length);
+    }), 8.0 * length, 2.0 * length);
+    report("dot_product", 0, length, measure([&]() {
+      g_sink = dot_product_na(a, b, length);
+    }), 8.0 * length, 2.0 * length);
+    report("sum_elements", 1, length, measure([&]() {
+      g_sink = sum_elements(a, length);
+    }), 4.0 * length, length);
+    report("sum_elements", 0, length, measure([&]() {
+      g_sink = sum_elements_na(a, length);
+    }), 4.0 * length, length);
+    report("int16_to_float", 1, length, measure([&]() {
+      int16_to_float(i16, length, res);
+    }), 6.0 * length, 0);
+    report("int16_to_float", 0, length, measure([&]() {
+      int16_to_float_na(i16, length, res);
+    }), 6.0 * length, 0);
+    report("float_to_int16", 1, length, measure([&]() {
+      float_to_int16(a, length, i16);
+    }), 6.0 * length, 0);
+    report("float_to_int16", 0, length, measure([&]() {
+      float_to_int16_na(a, length, i16);
+    }), 6.0 * length, 0);
+  }
+  free(a);
+  free(b);
+  free(res);
+  free(i16);
+}
+
+#ifndef NO_FFTF
+/// @brief Times the brute force convolution for short and moderate filters
+/// (the FFT flavors are covered by the tests/convolve.cc speedup blocks).
+void bench_convolve() {
+  static const size_t filter_lengths[] = { 32, 256 };
+  const size_t length = 16384;
+  float* x = mallocf(length);
+  float* h = mallocf(filter_lengths[1]);
+  float* result = mallocf(length);
+  memsetf(x, 1.0f, length);
+  memsetf(h, 0.5f, filter_lengths[1]);
+  for (size_t fi = 0; fi < sizeof(filter_lengths) / sizeof(size_t); fi++) {
+    size_t hLength = filter_lengths[fi];
+    for (int simd = 1; simd >= 0; simd--) {
+      char name[64];
+      snprintf(name, sizeof(name), "convolve_simd_h%zu", hLength);
+      report(name, simd, length, measure([&]() {
+        convolve_simd(simd, x, length, h, hLength, result);
+      }), 8.0 * length, 2.0 * length * hLength);
+    }
+  }
+  free(x);
+  free(h);
+  free(result);
+}
+#endif
+
+/// @brief Times the square matrix multiplication for cache-resident and
+/// cache-busting sizes.
+void bench_matrix() {
+  static const size_t sizes[] = { 64, 128, 256 };
+  const size_t max_size = sizes[sizeof(sizes) / sizeof(sizes[0]) - 1];
+  float* m1 = mallocf(max_size * max_size);
+  float* m2 = mallocf(max_size * max_size);
+  float* res = mallocf(max_size * max_size);
+  memsetf(m1, 0.5f, max_size * max_size);
+  memsetf(m2, 2.0f, max_size * max_size);
+  for (size_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]); si++) {
+    size_t n = sizes[si];
+    for (int simd = 1; simd >= 0; simd--) {
+      report("matrix_multiply", simd, n * n, measure([&]() {
+        matrix_multiply(simd, m1, m2, n, n, n, n, res);
+      }), 12.0 * n * n, 2.0 * n * n * n);
+    }
+  }
+  free(m1);
+  free(m2);
+  free(res);
+}
+
+/// @brief Times the byte plane normalization on a small and a video frame
+/// sized plane.
+void bench_normalize() {
+  static const int sizes[][2] = { { 256, 256 }, { 1280, 720 } };
+  const int max_pixels = sizes[1][0] * sizes[1][1];
+  uint8_t* src = reinterpret_cast<uint8_t*>(
+      malloc_aligned(max_pixels));
+  float* dst = mallocf(max_pixels);
+  for (int i = 0; i < max_pixels; i++) {
+    src[i] = i % 256;
+  }
+  for (size_t si = 0; si < sizeof(sizes) / sizeof(sizes[0]); si++) {
+    int width = sizes[si][0], height = sizes[si][1];
+    for (int simd = 1; simd >= 0; simd--) {
+      char name[64];
+      snprintf(name, sizeof(name), "normalize2D_%dx%d", width, height);
+      report(name, simd, static_cast<size_t>(width) * height, measure([&]() {
+        normalize2D(simd, src, width, width, height, dst, width);
+      }), 5.0 * width * height, 2.0 * width * height);
+    }
+  }
+  free(src);
+  free(dst);
+}
+
+/// @brief Times the single level wavelet transform. wavelet_apply() has no
+/// simd argument: the vectorized path is chosen at compile time, so only
+/// that flavor is reported.
+void bench_wavelet() {
+  static const size_t lengths[] = { 4096, 65536 };
+  const size_t max_length = lengths[sizeof(lengths) / sizeof(lengths[0]) - 1];
+  const int order = 8;
+  float* signal = mallocf(max_length);
+  for (size_t i = 0; i < max_length; i++) {
+    signal[i] = i % 512 * 0.25f;
+  }
+  for (size_t li = 0; li < sizeof(lengths) / sizeof(lengths[0]); li++) {
+    size_t length = lengths[li];
+    // The vectorized kernels touch a few float-s beyond the logical ends,
+    // so the buffers come from the dedicated allocators, as everywhere else
+    float* src = wavelet_prepare_array(order, signal, length);
+    float* desthi = wavelet_allocate_destination(order, length);
+    float* destlo = wavelet_allocate_destination(order, length);
+    report("wavelet_apply", 1, length, measure([&]() {
+      wavelet_apply(WAVELET_TYPE_DAUBECHIES, order, EXTENSION_TYPE_PERIODIC,
+                    src, length, desthi, destlo);
+    }), 8.0 * length, 2.0 * order * length);
+    free(src);
+    free(desthi);
+    free(destlo);
+  }
+  free(signal);
+}
+
+}  // namespace
+
+int main() {
+  printf("# veles.simd microbenchmarks, seconds are per call, "
+         "percentages are of the measured peaks below\n");
+  printf("kernel,simd,length,seconds,GB/s,GFLOPS,"
+         "pct_peak_bandwidth,pct_peak_flops\n");
+  measure_peak_bandwidth();
+  measure_peak_flops();
+  bench_arithmetic();
+#ifndef NO_FFTF
+  bench_convolve();
+#endif
+  bench_matrix();
+  bench_normalize();
+  bench_wavelet();
+  return 0;
+}
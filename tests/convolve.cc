@@ -136,6 +136,115 @@ TEST(convolve, convolve_overlap_save) {
   ASSERT_EQ(-1, firstDifferenceIndex);
 }
 
+TEST(convolve, convolve_fft_inplace) {
+  const int xlen = 1020;
+  const int hlen = 50;
+
+  float xs[xlen];
+  for (int i = 0; i < xlen; i++) {
+    xs[i] = sinf(i) * 100;
+  }
+  float hs[hlen];
+  for (int i = 0; i < hlen; i++) {
+    hs[i] = i / (hlen - 1.0f);
+  }
+
+  float verif[xlen + hlen - 1];
+  convolve_reference(xs, xlen, hs, hlen, verif);
+
+  size_t paddedLength;
+  float *x = zeropaddingex(xs, xlen, &paddedLength, 2);
+  float *h = mallocf(paddedLength + 2);
+  memsetf(h, 0.f, paddedLength + 2);
+  memcpy(h, hs, sizeof(hs));
+
+  float res[xlen + hlen - 1];
+  auto handle = convolve_fft_inplace_initialize(xlen, hlen, x, h);
+  convolve_fft_inplace(handle, res);
+  convolve_fft_inplace_finalize(handle);
+  free(x);
+  free(h);
+
+  int firstDifferenceIndex = -1;
+  for (int i = 0; i < xlen + hlen - 1; i++) {
+    float delta = res[i] - verif[i];
+    if (delta * delta > 1E-6 && firstDifferenceIndex == -1) {
+      firstDifferenceIndex = i;
+    }
+  }
+  ASSERT_EQ(-1, firstDifferenceIndex);
+}
+
+TEST(convolve, convolve_stream) {
+  const int block = 128;
+  const int nblocks = 8;
+  const int xlen = block * nblocks;
+  const int hlen = 50;
+
+  float x[xlen + block];
+  memset(x, 0, sizeof(x));
+  for (int i = 0; i < xlen; i++) {
+    x[i] = sinf(i) * 100;
+  }
+  float h[hlen];
+  for (int i = 0; i < hlen; i++) {
+    h[i] = i / (hlen - 1.0f);
+  }
+
+  float verif[xlen + hlen - 1];
+  convolve_reference(x, xlen, h, hlen, verif);
+
+  float res[xlen + block];
+  auto handle = convolve_stream_initialize(h, hlen, block);
+  // The extra zero block drains the convolution tail
+  for (int b = 0; b < nblocks + 1; b++) {
+    convolve_stream_feed(handle, x + b * block, res + b * block);
+  }
+  convolve_stream_finalize(handle);
+
+  int firstDifferenceIndex = -1;
+  for (int i = 0; i < xlen + hlen - 1; i++) {
+    float delta = res[i] - verif[i];
+    if (delta * delta > 1E-6 && firstDifferenceIndex == -1) {
+      firstDifferenceIndex = i;
+    }
+  }
+  ASSERT_EQ(-1, firstDifferenceIndex);
+}
+
+TEST(convolve, convolve_batch) {
+  const int xlen = 508;
+  const int hlen = 50;
+  const int batch = 4;
+
+  float x[batch * xlen];
+  for (int i = 0; i < batch * xlen; i++) {
+    x[i] = sinf(i) * 100;
+  }
+  float h[hlen];
+  for (int i = 0; i < hlen; i++) {
+    h[i] = i / (hlen - 1.0f);
+  }
+
+  float res[batch * (xlen + hlen - 1)];
+  auto handle = convolve_batch_initialize(xlen, hlen, batch);
+  convolve_batch(handle, x, h, res);
+  convolve_batch_finalize(handle);
+
+  int firstDifferenceIndex = -1;
+  for (int b = 0; b < batch; b++) {
+    float verif[xlen + hlen - 1];
+    convolve_reference(x + b * xlen, xlen, h, hlen, verif);
+    for (int i = 0; i < xlen + hlen - 1; i++) {
+      float delta = res[b * (xlen + hlen - 1) + i] - verif[i];
+      if (delta * delta > 1E-6 && firstDifferenceIndex == -1) {
+        firstDifferenceIndex = b * (xlen + hlen - 1) + i;
+      }
+    }
+  }
+  ASSERT_EQ(-1, firstDifferenceIndex);
+}
+
 TEST(convolve, convolve_simd) {
   const int xlen = 1024;
   const int hlen = 50;
@@ -165,6 +274,122 @@ TEST(convolve, convolve_simd) {
   ASSERT_EQ(-1, firstDifferenceIndex);
 }
 
+TEST(convolve, convolve_simd_symmetric) {
+  const int xlen = 1024;
+  // Both parities hit the different center handling
+  for (int hlen = 50; hlen <= 51; hlen++) {
+    float x[xlen];
+    for (int i = 0; i < xlen; i++) {
+      x[i] = sinf(i) * 100;
+    }
+    float h[51];
+    for (int i = 0; i < hlen; i++) {
+      // A symmetric (linear phase) window
+      h[i] = 1.0f - fabsf(i - (hlen - 1) / 2.0f) / hlen;
+    }
+
+    float verif[xlen + 51 - 1];
+    convolve_reference(x, xlen, h, hlen, verif);
+
+    float res[xlen + 51 - 1];
+    convolve_simd_symmetric(true, x, xlen, h, hlen, res);
+
+    for (int i = 0; i < xlen + hlen - 1; i++) {
+      ASSERT_NEAR(verif[i], res[i], 1e-2f) << "hlen " << hlen << " i " << i;
+    }
+  }
+}
+
+TEST(convolve, convolve_sparse) {
+  const int xlen = 1024;
+  const int hlen = 400;
+
+  float x[xlen];
+  for (int i = 0; i < xlen; i++) {
+    x[i] = sinf(i) * 100;
+  }
+  // A comb-like filter: a handful of live taps over a long span
+  float h[hlen] = { 0.f };
+  h[0] = 1.0f;
+  h[37] = -0.5f;
+  h[150] = 0.25f;
+  h[399] = 0.125f;
+
+  size_t indices[hlen];
+  float values[hlen];
+  size_t taps = convolve_sparse_extract(h, hlen, indices, values);
+  ASSERT_EQ(static_cast<size_t>(4), taps);
+  ASSERT_EQ(static_cast<size_t>(37), indices[1]);
+  ASSERT_EQ(0.25f, values[2]);
+
+  float verif[xlen + hlen - 1];
+  convolve_reference(x, xlen, h, hlen, verif);
+
+  float res[xlen + hlen - 1];
+  convolve_sparse(true, x, xlen, indices, values, taps, hlen, res);
+
+  for (int i = 0; i < xlen + hlen - 1; i++) {
+    ASSERT_NEAR(verif[i], res[i], 1e-4f) << "i " << i;
+  }
+}
+
+TEST(convolve, convolve_simd_i16) {
+  const int xlen = 1024;
+  const int hlen = 50;
+
+  int16_t x[xlen];
+  for (int i = 0; i < xlen; i++) {
+    x[i] = (int16_t)((i * 37) % 2000 - 1000);
+  }
+  int16_t h[hlen];
+  for (int i = 0; i < hlen; i++) {
+    h[i] = (int16_t)(i - hlen / 2);
+  }
+
+  int32_t verif[xlen + hlen - 1];
+  convolve_simd_i16(false, x, xlen, h, hlen, verif);
+
+  int32_t res[xlen + hlen - 1];
+  convolve_simd_i16(true, x, xlen, h, hlen, res);
+
+  int firstDifferenceIndex = -1;
+  for (int i = 0; i < xlen + hlen - 1; i++) {
+    if (res[i] != verif[i] && firstDifferenceIndex == -1) {
+      firstDifferenceIndex = i;
+    }
+  }
+  ASSERT_EQ(-1, firstDifferenceIndex);
+}
+
+TEST(convolve, convolve_simd_f64) {
+  const int xlen = 1024;
+  const int hlen = 50;
+
+  double x[xlen];
+  for (int i = 0; i < xlen; i++) {
+    x[i] = sin(i) * i;
+  }
+  double h[hlen];
+  for (int i = 0; i < hlen; i++) {
+    h[i] = i / (hlen - 1.0);
+  }
+
+  double verif[xlen + hlen - 1];
+  convolve_simd_f64(false, x, xlen, h, hlen, verif);
+
+  double res[xlen + hlen - 1];
+  convolve_simd_f64(true, x, xlen, h, hlen, res);
+
+  int firstDifferenceIndex = -1;
+  for (int i = 0; i < xlen + hlen - 1; i++) {
+    double delta = res[i] - verif[i];
+    if (delta * delta > 1E-12 && firstDifferenceIndex == -1) {
+      firstDifferenceIndex = i;
+    }
+  }
+  ASSERT_EQ(-1, firstDifferenceIndex);
+}
+
 float BenchmarkH[512] = { 1.f };
 float BenchmarkResult[10000];
 
@@ -31,7 +31,9 @@
 #include <gtest/gtest.h>
 #ifndef NO_FFTF
 #include <cmath>
+#include <cstring>
 #include <simd/correlate.h>
+#include <simd/detect_peaks.h>
 #include <simd/memory.h>
 #include <simd/arithmetic.h>
 #include <fftf/api.h>
@@ -127,6 +129,55 @@ TEST(correlate, cross_correlate_overlap_save) {
   }
 }
 
+TEST(correlate, cross_correlate_argmax_peaks) {
+  const int xlen = 1020;
+  const int hlen = 50;
+
+  float x[xlen];
+  for (int i = 0; i < xlen; i++) {
+    x[i] = sinf(i * 0.1f) * 100;
+  }
+  float h[hlen];
+  const int shift = 300;
+  for (int i = 0; i < hlen; i++) {
+    h[i] = x[shift + i];
+  }
+
+  float full[xlen + hlen - 1];
+  auto handle = cross_correlate_overlap_save_initialize(xlen, hlen);
+  cross_correlate_overlap_save(handle, x, h, full);
+
+  int refpos = 0;
+  float refval = full[0];
+  for (int i = 1; i < xlen + hlen - 1; i++) {
+    if (full[i] > refval) {
+      refval = full[i];
+      refpos = i;
+    }
+  }
+
+  int pos;
+  float val;
+  cross_correlate_argmax(handle, x, h, &pos, &val);
+  ASSERT_EQ(refpos, pos);
+  ASSERT_NEAR(refval, val, 1E-3);
+
+  ExtremumPoint *refpeaks, *peaks;
+  size_t refcount, count;
+  detect_peaks(false, full, xlen + hlen - 1, kExtremumTypeBoth,
+               &refpeaks, &refcount);
+  cross_correlate_peaks(handle, x, h, kExtremumTypeBoth, &peaks, &count);
+  cross_correlate_overlap_save_finalize(handle);
+
+  ASSERT_EQ(refcount, count);
+  for (size_t i = 0; i < count; i++) {
+    ASSERT_EQ(refpeaks[i].position, peaks[i].position) << i;
+    ASSERT_NEAR(refpeaks[i].value, peaks[i].value, 1E-3) << i;
+  }
+  free(refpeaks);
+  free(peaks);
+}
+
 TEST(correlate, cross_correlate_simd) {
   const int xlen = 1024;
   const int hlen = 50;
@@ -151,6 +202,167 @@ TEST(correlate, cross_correlate_simd) {
   }
 }
 
+namespace {
+
+struct CorrelateStreamSink {
+  float *result;
+  size_t written;
+};
+
+}  // namespace
+
+TEST(correlate, cross_correlate_stream) {
+  const int xlen = 10000;
+  const int hlen = 50;
+
+  float x[xlen];
+  for (int i = 0; i < xlen; i++) {
+    x[i] = sinf(i) * 100;
+  }
+  float h[hlen];
+  for (int i = 0; i < hlen; i++) {
+    h[i] = i / (hlen - 1.0f);
+  }
+
+  float verif[xlen + hlen - 1];
+  cross_correlate_reference(x, xlen, h, hlen, verif);
+
+  float res[xlen + hlen - 1];
+  CorrelateStreamSink sink { res, 0 };
+  cross_correlate_stream(
+      x, xlen, h, hlen, 1024,
+      [](const float *chunk, size_t offset, size_t count, void *user) {
+        auto me = static_cast<CorrelateStreamSink *>(user);
+        memcpy(me->result + offset, chunk, count * sizeof(float));
+        me->written += count;
+      },
+      &sink);
+  ASSERT_EQ(static_cast<size_t>(xlen + hlen - 1), sink.written);
+
+  for (int i = 0; i < xlen + hlen - 1; i++) {
+    ASSERT_NEAR(res[i], verif[i], 1E-3) << i;
+  }
+}
+
+TEST(correlate, cross_correlate_2d) {
+  const int width = 64;
+  const int height = 32;
+  const int kwidth = 9;
+  const int kheight = 5;
+
+  float src[width * height];
+  for (int i = 0; i < width * height; i++) {
+    src[i] = sinf(i) + (i % 7) * 0.1f;
+  }
+  float kernel[kwidth * kheight];
+  for (int i = 0; i < kwidth * kheight; i++) {
+    kernel[i] = cosf(i);
+  }
+
+  const int dwidth = width - kwidth + 1;
+  const int dheight = height - kheight + 1;
+  float verif[dwidth * dheight];
+  cross_correlate_2d(false, src, width, width, height,
+                     kernel, kwidth, kheight, verif);
+
+  float res[dwidth * dheight];
+  cross_correlate_2d(true, src, width, width, height,
+                     kernel, kwidth, kheight, res);
+
+  for (int i = 0; i < dwidth * dheight; i++) {
+    ASSERT_NEAR(res[i], verif[i], 1E-3) << i;
+  }
+}
+
+TEST(correlate, cross_correlate_fft_multi) {
+  const int xlen = 1020;
+  const int hlen = 50;
+  const int tcount = 4;
+
+  float x[xlen];
+  for (int i = 0; i < xlen; i++) {
+    x[i] = sinf(i) * 100;
+  }
+  float templates[tcount * hlen];
+  for (int i = 0; i < tcount * hlen; i++) {
+    templates[i] = cosf(i) * 10;
+  }
+
+  float res[tcount * (xlen + hlen - 1)];
+  auto handle = cross_correlate_fft_multi_initialize(xlen, hlen,
+                                                     templates, tcount);
+  cross_correlate_fft_multi(handle, x, res);
+  // The handle must stay reusable for the next frame
+  cross_correlate_fft_multi(handle, x, res);
+  cross_correlate_fft_multi_finalize(handle);
+
+  float verif[xlen + hlen - 1];
+  for (int t = 0; t < tcount; t++) {
+    cross_correlate_reference(x, xlen, templates + t * hlen, hlen, verif);
+    for (int i = 0; i < xlen + hlen - 1; i++) {
+      // The amplitudes drive the results to ~1e4, so the tolerance must
+      // scale with the magnitude or float rounding alone fails it
+      ASSERT_NEAR(res[t * (xlen + hlen - 1) + i], verif[i],
+                  1E-3f * (1.f + fabsf(verif[i])))
+          << t << " " << i;
+    }
+  }
+}
+
+TEST(correlate, cross_correlate_ncc) {
+  const int xlen = 1024;
+  const int hlen = 50;
+
+  float x[xlen];
+  for (int i = 0; i < xlen; i++) {
+    x[i] = sinf(i) + 0.01f * (i % 13);
+  }
+  float h[hlen];
+  // The template is a shifted copy of the signal, so a perfect match
+  // (score 1) must appear exactly at the shift
+  const int shift = 100;
+  for (int i = 0; i < hlen; i++) {
+    h[i] = x[shift + i];
+  }
+
+  float verif[xlen - hlen + 1];
+  cross_correlate_ncc(false, x, xlen, h, hlen, verif);
+
+  float res[xlen - hlen + 1];
+  cross_correlate_ncc(true, x, xlen, h, hlen, res);
+
+  for (int i = 0; i < xlen - hlen + 1; i++) {
+    ASSERT_NEAR(res[i], verif[i], 1E-3) << i;
+    ASSERT_LE(res[i], 1.001f) << i;
+    ASSERT_GE(res[i], -1.001f) << i;
+  }
+  ASSERT_NEAR(res[shift], 1.f, 1E-3);
+}
+
+TEST(correlate, cross_correlate_simd_f64) {
+  const int xlen = 1024;
+  const int hlen = 50;
+
+  double x[xlen];
+  for (int i = 0; i < xlen; i++) {
+    x[i] = sin(i) * 100;
+  }
+  double h[hlen];
+  for (int i = 0; i < hlen; i++) {
+    h[i] = i / (hlen - 1.0);
+  }
+
+  double verif[xlen + hlen - 1];
+  cross_correlate_simd_f64(false, x, xlen, h, hlen, verif);
+
+  double res[xlen + hlen - 1];
+  cross_correlate_simd_f64(true, x, xlen, h, hlen, res);
+
+  for (int i = 0; i < xlen + hlen - 1; i++) {
+    ASSERT_NEAR(res[i], verif[i], 1E-9) << i;
+  }
+}
+
 #endif
 
 #include "tests/google/src/gtest_main.cc"
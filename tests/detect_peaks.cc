@@ -30,6 +30,7 @@
 
 
 #include <simd/detect_peaks.h>
+#include <cfloat>
 #include <cmath>
 #include <gtest/gtest.h>
 
@@ -99,6 +100,112 @@ TEST_P(DetectPeaksTest, nasty_peaks) {
   free(points);
 }
 
+TEST_P(DetectPeaksTest, filtered) {
+  size_t length = 4000;
+  float array[length];
+  // Small ripple on top of a large wave: the amplitude filter must keep
+  // exactly the maximums an unfiltered scan finds at or above the bar
+  for (size_t i = 0; i < length; i++) {
+    array[i] = sinf(i * M_PI / 100) + 0.1f * sinf(i * M_PI / 7);
+  }
+  ExtremumPoint *raw;
+  size_t raw_count;
+  detect_peaks(is_simd(), array, length, kExtremumTypeMaximum,
+               &raw, &raw_count);
+  size_t expected_count = 0;
+  for (size_t i = 0; i < raw_count; i++) {
+    if (raw[i].value >= 0.9f) {
+      expected_count++;
+    }
+  }
+  free(raw);
+  ASSERT_GT(expected_count, 0U);
+  ASSERT_LT(expected_count, raw_count);
+  ExtremumPoint *points;
+  size_t points_count;
+  detect_peaks_filtered(is_simd(), array, length, kExtremumTypeMaximum,
+                        0.9f, 0, &points, &points_count);
+  ASSERT_EQ(expected_count, points_count);
+  for (size_t i = 0; i < points_count; i++) {
+    ASSERT_GE(points[i].value, 0.9f) << i;
+  }
+  free(points);
+  // On the clean wave every crest rises 2 above the preceding trough,
+  // so it passes a prominence bar of 1.5 but not one of 2.5. The first
+  // crest is the exception: it is measured against data[0] == 0.
+  for (size_t i = 0; i < length; i++) {
+    array[i] = sinf(i * M_PI / 100);
+  }
+  detect_peaks_filtered(is_simd(), array, length, kExtremumTypeMaximum,
+                        -FLT_MAX, 1.5f, &points, &points_count);
+  ASSERT_EQ(19U, points_count);
+  free(points);
+  detect_peaks_filtered(is_simd(), array, length, kExtremumTypeMaximum,
+                        -FLT_MAX, 2.5f, &points, &points_count);
+  ASSERT_EQ(0U, points_count);
+  ASSERT_EQ(nullptr, points);
+}
+
+TEST_P(DetectPeaksTest, prealloc) {
+  size_t length = 4000;
+  float array[length];
+  for (size_t i = 0; i < length; i++) {
+    array[i] = sinf(i * M_PI / 100);
+  }
+  ExtremumPoint points[20];
+  size_t points_count;
+  int fit = detect_peaks_prealloc(is_simd(), array, length,
+                                  kExtremumTypeMaximum, points, 20,
+                                  &points_count);
+  ASSERT_TRUE(fit);
+  ASSERT_EQ(20U, points_count);
+  for (int i = 0; i < 20; i++) {
+    ASSERT_EQ(i * 200 + 50, points[i].position) << i;
+    ASSERT_FLOAT_EQ(1.f, points[i].value) << i;
+  }
+  // Both types no longer fit into 20 points
+  fit = detect_peaks_prealloc(is_simd(), array, length, kExtremumTypeBoth,
+                              points, 20, &points_count);
+  ASSERT_FALSE(fit);
+  ASSERT_EQ(20U, points_count);
+  for (int i = 0; i < 20; i++) {
+    ASSERT_EQ((i / 2) * 200 + 50 + 100 * (i % 2), points[i].position) << i;
+  }
+}
+
+TEST_P(DetectPeaksTest, stream) {
+  size_t length = 4000;
+  float array[length];
+  for (size_t i = 0; i < length; i++) {
+    array[i] = sinf(i * M_PI / 100);
+  }
+  ExtremumPoint *ref_points;
+  size_t ref_count;
+  detect_peaks(is_simd(), array, length, kExtremumTypeBoth,
+               &ref_points, &ref_count);
+
+  // 333 does not divide the peak period, so extrema land on chunk edges
+  const size_t chunk = 333;
+  PeakDetectionStream stream;
+  detect_peaks_stream_initialize(&stream, kExtremumTypeBoth);
+  size_t total = 0;
+  for (size_t pos = 0; pos < length; pos += chunk) {
+    size_t size = pos + chunk <= length? chunk : length - pos;
+    ExtremumPoint *points;
+    size_t points_count;
+    detect_peaks_stream_feed(is_simd(), &stream, array + pos, size,
+                             &points, &points_count);
+    for (size_t i = 0; i < points_count; i++, total++) {
+      ASSERT_LT(total, ref_count);
+      ASSERT_EQ(ref_points[total].position, points[i].position) << total;
+      ASSERT_FLOAT_EQ(ref_points[total].value, points[i].value) << total;
+    }
+    free(points);
+  }
+  ASSERT_EQ(ref_count, total);
+  free(ref_points);
+}
+
 INSTANTIATE_TEST_CASE_P(DetectPeaksTests, DetectPeaksTest, ::testing::Bool());
 
 #include "tests/google/src/gtest_main.cc"
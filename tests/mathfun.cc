@@ -78,10 +78,69 @@ INSTANTIATE_TEST_CASE_P(
         ::testing::Bool(),
         ::testing::Values(1, 3, 64, 199),
         ::testing::Values(
-            std::make_tuple(sin_psv, sin),
-            std::make_tuple(cos_psv, cos),
-            std::make_tuple(log_psv, log),
-            std::make_tuple(exp_psv, exp))));
+            std::make_tuple(sin_psv, sinf),
+            std::make_tuple(cos_psv, cosf),
+            std::make_tuple(log_psv, logf),
+            std::make_tuple(exp_psv, expf),
+            std::make_tuple(tanh_psv, tanhf),
+            std::make_tuple(sigmoid_psv,
+                            [](float x) { return sigmoidf(x); }))));
+
+class BinaryMathTest : public ::testing::TestWithParam<bool> {};
+
+TEST_P(BinaryMathTest, Atan2Hypot) {
+  const size_t length = 199;
+  std::unique_ptr<float[], void(*)(void*)> xs(mallocf(length), std::free);
+  std::unique_ptr<float[], void(*)(void*)> ys(mallocf(length), std::free);
+  std::unique_ptr<float[], void(*)(void*)> res(mallocf(length), std::free);
+  for (size_t i = 0; i < length; ++i) {
+    xs[i] = (float(i % 19) - float(i % 6)) * 1.1f;
+    ys[i] = (float(i % 13) - float(i % 8)) * 0.9f;
+  }
+  atan2_psv(GetParam(), ys.get(), xs.get(), length, res.get());
+  for (size_t i = 0; i < length; ++i) {
+    ASSERT_NEAR(atan2f(ys[i], xs[i]), res[i], 4e-6) << "i = " << i;
+  }
+  hypot_psv(GetParam(), xs.get(), ys.get(), length, res.get());
+  for (size_t i = 0; i < length; ++i) {
+    ASSERT_NEAR(hypotf(xs[i], ys[i]), res[i], 1e-4) << "i = " << i;
+  }
+}
+
+TEST_P(BinaryMathTest, Pow) {
+  const size_t length = 199;
+  std::unique_ptr<float[], void(*)(void*)> xs(mallocf(length), std::free);
+  std::unique_ptr<float[], void(*)(void*)> res(mallocf(length), std::free);
+  for (size_t i = 0; i < length; ++i) {
+    xs[i] = float(i % 19) * 1.1f + 0.1f;
+  }
+  pow_psv(GetParam(), xs.get(), length, 0.33f, res.get());
+  for (size_t i = 0; i < length; ++i) {
+    float ref = powf(xs[i], 0.33f);
+    ASSERT_NEAR(ref, res[i], 1e-4 * (1 + ref)) << "i = " << i;
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(Math, BinaryMathTest, ::testing::Bool());
+
+class SinCosTest : public ::testing::TestWithParam<bool> {};
+
+TEST_P(SinCosTest, SinCosTestCase) {
+  const size_t length = 199;
+  std::unique_ptr<float[], void(*)(void*)> data(mallocf(length), std::free);
+  for (size_t i = 0; i < length; ++i) {
+    data[i] = (float(i % 19) - float(i % 6)) * 1.1f;
+  }
+  std::unique_ptr<float[], void(*)(void*)> sins(mallocf(length), std::free);
+  std::unique_ptr<float[], void(*)(void*)> coss(mallocf(length), std::free);
+  sincos_psv(GetParam(), data.get(), length, sins.get(), coss.get());
+  for (size_t i = 0; i < length; ++i) {
+    ASSERT_FLOAT_EQ(sinf(data[i]), sins[i]) << "i = " << i;
+    ASSERT_FLOAT_EQ(cosf(data[i]), coss[i]) << "i = " << i;
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(Math, SinCosTest, ::testing::Bool());
 
 #include "tests/google/src/gtest_main.cc"
 
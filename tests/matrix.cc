@@ -30,6 +30,7 @@
 
 #include <simd/memory.h>
 #include <simd/matrix.h>
+#include <simd/matrix_small.h>
 #include "tests/matrix.h"
 
 void MatrixTest::SetUp() {
@@ -140,6 +141,207 @@ TEST(Multiply, Validate) {
   }
 }
 
+TEST(MultiplyAccumulate, Validate) {
+  float m1[6] = { 1, 2, 3,
+                 -2, 0, 4 };
+  float m2[12] = { 0, 1, 3, -2,
+                   5, -1, 2, 4,
+                  -3, 0, -4, 2 };
+  float res[8] = { 1, 2, 3, 4,
+                   5, 6, 7, 8 };
+  // 0.5 * m1 * m2 + 2 * res
+  float res_valid[8] = { 2.5f, 3.5f, 3.5f, 14,
+                         4, 11, 3, 22 };
+  matrix_multiply_accumulate(false, m1, m2, 3, 2, 4, 3, 0.5f, 2.f, res);
+  for (int i = 0; i < 8; i++) {
+    ASSERT_NEAR(res[i], res_valid[i], 0.01);
+  }
+}
+
+TEST(MultiplyAccumulate, SIMD) {
+  const int w1 = 128, h1 = 300, w2 = 257;
+  auto m1 = std::shared_ptr<float>(mallocf(w1 * h1), std::free);
+  auto m2 = std::shared_ptr<float>(mallocf(w2 * w1), std::free);
+  for (int i = 0; i < w1 * h1; i++) {
+    m1.get()[i] = i % 17 - 8;
+  }
+  for (int i = 0; i < w2 * w1; i++) {
+    m2.get()[i] = i % 15 - 7;
+  }
+  auto valid = std::shared_ptr<float>(mallocf(w2 * h1), std::free);
+  auto res = std::shared_ptr<float>(mallocf(w2 * h1), std::free);
+  for (int i = 0; i < w2 * h1; i++) {
+    valid.get()[i] = res.get()[i] = i % 9;
+  }
+  matrix_multiply_accumulate(false, m1.get(), m2.get(), w1, h1, w2, w1,
+                             0.5f, 2.f, valid.get());
+  matrix_multiply_accumulate(true, m1.get(), m2.get(), w1, h1, w2, w1,
+                             0.5f, 2.f, res.get());
+  for (int i = 0; i < w2 * h1; i++) {
+    ASSERT_NEAR(valid.get()[i], res.get()[i], 0.1) << i;
+  }
+}
+
+TEST(Multiply, Threads) {
+  const int w1 = 129, h1 = 333, w2 = 257;
+  auto m1 = std::shared_ptr<float>(mallocf(w1 * h1), std::free);
+  auto m2 = std::shared_ptr<float>(mallocf(w2 * w1), std::free);
+  for (int i = 0; i < w1 * h1; i++) {
+    m1.get()[i] = i % 17 - 8;
+  }
+  for (int i = 0; i < w2 * w1; i++) {
+    m2.get()[i] = i % 15 - 7;
+  }
+  auto valid = std::shared_ptr<float>(mallocf(w2 * h1), std::free);
+  auto res = std::shared_ptr<float>(mallocf(w2 * h1), std::free);
+  matrix_multiply(true, m1.get(), m2.get(), w1, h1, w2, w1, valid.get());
+  matrix_set_threads(4);
+  matrix_multiply(true, m1.get(), m2.get(), w1, h1, w2, w1, res.get());
+  matrix_set_threads(1);
+  for (int i = 0; i < w2 * h1; i++) {
+    ASSERT_NEAR(valid.get()[i], res.get()[i], 0.1) << i;
+  }
+  matrix_multiply_transposed(true, m1.get(), m2.get(), w1, h1, w1, w2,
+                             valid.get());
+  matrix_set_threads(4);
+  matrix_multiply_transposed(true, m1.get(), m2.get(), w1, h1, w1, w2,
+                             res.get());
+  matrix_set_threads(1);
+  for (int i = 0; i < w2 * h1; i++) {
+    ASSERT_NEAR(valid.get()[i], res.get()[i], 0.1) << i;
+  }
+}
+
+TEST(AddSubStrict, SIMD) {
+  const int w = 64, h = 53;
+  float *m1 = mallocf(w * h), *m2 = mallocf(w * h);
+  float *res = mallocf(w * h), *res_valid = mallocf(w * h);
+  for (int i = 0; i < w * h; i++) {
+    m1[i] = i % 19 - 9;
+    m2[i] = i % 13 - 6;
+  }
+  matrix_add(false, m1, m2, w, h, res_valid);
+  matrix_add_strict(true, m1, m2, w, h, res);
+  for (int i = 0; i < w * h; i++) {
+    ASSERT_EQ(res_valid[i], res[i]) << i;
+  }
+  matrix_sub(false, m1, m2, w, h, res_valid);
+  matrix_sub_strict(true, m1, m2, w, h, res);
+  for (int i = 0; i < w * h; i++) {
+    ASSERT_EQ(res_valid[i], res[i]) << i;
+  }
+  free(m1);
+  free(m2);
+  free(res);
+  free(res_valid);
+}
+
+TEST(MultiplyI16, Validate) {
+  int16_t m1[6] = { 1, 2, 3,
+                   -2, 0, 4 };
+  int16_t m2[12] = { 0,  1,  3, -2,
+                     5, -1,  2,  4,
+                    -3,  0, -4,  2 };
+  int32_t res[8];
+  int32_t res_valid[8] = { 1, -1, -5, 12,
+                         -12, -2,-22, 12 };
+  matrix_multiply_i16(false, m1, m2, 3, 2, 4, 3, res);
+  for (int i = 0; i < 8; i++) {
+    ASSERT_EQ(res_valid[i], res[i]) << i;
+  }
+}
+
+TEST(MultiplyI16, SIMD) {
+  const int w1 = 99, h1 = 51, w2 = 77;
+  int16_t m1[w1 * h1], m2[w1 * w2];
+  int32_t res[h1 * w2], res_valid[h1 * w2];
+  for (int i = 0; i < w1 * h1; i++) {
+    m1[i] = i % 2001 - 1000;
+  }
+  for (int i = 0; i < w1 * w2; i++) {
+    m2[i] = i % 1999 - 999;
+  }
+  matrix_multiply_i16(false, m1, m2, w1, h1, w2, w1, res_valid);
+  matrix_multiply_i16(true, m1, m2, w1, h1, w2, w1, res);
+  for (int i = 0; i < h1 * w2; i++) {
+    ASSERT_EQ(res_valid[i], res[i]) << i;
+  }
+}
+
+TEST(VectorMultiply, Validate) {
+  float m[6] = { 1, 2, 3,
+                 4, 5, 6 };
+  float v[3] = { -1, 2, 0.5f };
+  float res[2];
+  float res_valid[2] = { 4.5f, 9 };
+  matrix_vector_multiply(false, m, v, 3, 2, 3, res);
+  for (int i = 0; i < 2; i++) {
+    ASSERT_NEAR(res[i], res_valid[i], 0.01);
+  }
+}
+
+TEST(VectorMultiply, SIMD) {
+  const int w = 77, h = 51, stride = 80;
+  float *m = mallocf(h * stride);
+  float v[w], res[h], res_valid[h];
+  for (int i = 0; i < h * stride; i++) {
+    m[i] = i % 17 - 8;
+  }
+  for (int i = 0; i < w; i++) {
+    v[i] = i % 7 - 3;
+  }
+  matrix_vector_multiply(false, m, v, w, h, stride, res_valid);
+  matrix_vector_multiply(true, m, v, w, h, stride, res);
+  for (int i = 0; i < h; i++) {
+    ASSERT_NEAR(res[i], res_valid[i], 0.1) << i;
+  }
+  free(m);
+}
+
+TEST(Transpose, SIMD) {
+  const int w = 45, h = 27, src_stride = 48, dst_stride = 32;
+  float *src = mallocf(h * src_stride);
+  float *dst = mallocf(w * dst_stride);
+  for (int i = 0; i < h * src_stride; i++) {
+    src[i] = i;
+  }
+  for (int simd = 0; simd < 2; simd++) {
+    memsetf(dst, 0, w * dst_stride);
+    matrix_transpose(simd, src, w, h, src_stride, dst_stride, dst);
+    for (int i = 0; i < w; i++) {
+      for (int j = 0; j < h; j++) {
+        ASSERT_EQ(src[j * src_stride + i], dst[i * dst_stride + j])
+            << simd << " " << i << " " << j;
+      }
+    }
+  }
+  free(src);
+  free(dst);
+}
+
+TEST(MultiplySmall, Validate) {
+  float m1_4[16], m2_4[16], res[64], res_valid[64];
+  float m1_8[64], m2_8[64];
+  for (int i = 0; i < 16; i++) {
+    m1_4[i] = i % 7 - 3;
+    m2_4[i] = i % 5 - 2;
+  }
+  for (int i = 0; i < 64; i++) {
+    m1_8[i] = i % 11 - 5;
+    m2_8[i] = i % 9 - 4;
+  }
+  matrix_multiply(false, m1_4, m2_4, 4, 4, 4, 4, res_valid);
+  matrix_multiply_4x4(m1_4, m2_4, res);
+  for (int i = 0; i < 16; i++) {
+    ASSERT_NEAR(res[i], res_valid[i], 0.01) << i;
+  }
+  matrix_multiply(false, m1_8, m2_8, 8, 8, 8, 8, res_valid);
+  matrix_multiply_8x8(m1_8, m2_8, res);
+  for (int i = 0; i < 64; i++) {
+    ASSERT_NEAR(res[i], res_valid[i], 0.01) << i;
+  }
+}
+
 TEST(MultiplyTransposed, Validate) {
   float m1[6] = { 1, 2, 3,
                  -2, 0, 4 };
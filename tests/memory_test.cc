@@ -11,7 +11,12 @@
  */
 
 #include <gtest/gtest.h>
+#include <unistd.h>
+#include <cstdlib>
+#include <memory>
+#include <simd/instruction_set.h>
 #include <simd/memory.h>
+#include <simd/parallel.h>
 
 #ifdef __AVX__
 
@@ -44,6 +49,47 @@ TEST(Memory, align_complement_i32) {
 
 #endif
 
+TEST(InstructionSet, runtime_detection) {
+  auto set = simd_cpu_instruction_set();
+  EXPECT_EQ(set, simd_cpu_instruction_set());
+#ifdef __AVX__
+  if (simd_runtime_supported()) {
+    EXPECT_TRUE(set >= SIMD_INSTRUCTION_SET_AVX &&
+                set <= SIMD_INSTRUCTION_SET_AVX512);
+  }
+  simd_avx512_enable(0);
+  EXPECT_FALSE(simd_avx512_available());
+  simd_avx512_enable(1);
+#endif
+}
+
+static void parallel_mark_task(size_t index, void *user) {
+  static_cast<int*>(user)[index] = static_cast<int>(index) + 1;
+}
+
+TEST(Parallel, simd_parallel_for) {
+  EXPECT_GE(simd_get_num_threads(), 1);
+  int marks[7] = { 0 };
+  simd_parallel_for(parallel_mark_task, 7, marks);
+  for (int i = 0; i < 7; i++) {
+    EXPECT_EQ(i + 1, marks[i]);
+  }
+  // The pool threads stay warm between the dispatches
+  memset(marks, 0, sizeof(marks));
+  simd_parallel_for(parallel_mark_task, 7, marks);
+  for (int i = 0; i < 7; i++) {
+    EXPECT_EQ(i + 1, marks[i]);
+  }
+  simd_set_num_threads(2);
+  EXPECT_EQ(2, simd_get_num_threads());
+  memset(marks, 0, sizeof(marks));
+  simd_parallel_for(parallel_mark_task, 3, marks);
+  for (int i = 0; i < 3; i++) {
+    EXPECT_EQ(i + 1, marks[i]);
+  }
+  simd_parallel_for(parallel_mark_task, 1, marks);
+}
+
 TEST(Memory, malloc_aligned) {
   auto ptr = malloc_aligned(100);
 #ifdef __AVX__
@@ -56,6 +102,60 @@ TEST(Memory, malloc_aligned) {
   free(ptr);
 }
 
+TEST(Memory, malloc_aligned_huge) {
+  const size_t size = static_cast<size_t>(4) << 20;
+  auto ptr = malloc_aligned_huge(size);
+  ASSERT_NE(nullptr, ptr);
+#ifdef __linux__
+  EXPECT_EQ(static_cast<uintptr_t>(0),
+            reinterpret_cast<uintptr_t>(ptr) %
+                (static_cast<size_t>(2) << 20));
+#endif
+  memset(ptr, 0, size);
+  free(ptr);
+  auto small = malloc_aligned_huge(100);
+  ASSERT_NE(nullptr, small);
+  free(small);
+}
+
+TEST(Memory, malloc_aligned_numa) {
+  const size_t size = 100000 * sizeof(float);
+  auto ptr = malloc_aligned_numa(size, 0);
+  ASSERT_NE(nullptr, ptr);
+  memset(ptr, 0, size);
+  free(ptr);
+  auto any = malloc_aligned_numa(100, -1);
+  ASSERT_NE(nullptr, any);
+  free(any);
+}
+
+TEST(Memory, simd_mmap_signal) {
+  const size_t length = 10000;
+  char path[] = "/tmp/simd_mmap_XXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_GE(fd, 0);
+  for (size_t i = 0; i < length; i++) {
+    float value = i * 0.5f;
+    ASSERT_EQ(static_cast<ssize_t>(sizeof(value)),
+              write(fd, &value, sizeof(value)));
+  }
+  close(fd);
+
+  size_t mapped_length = 0;
+  const float *mapped = simd_mmap_signal(path, &mapped_length);
+  ASSERT_NE(nullptr, mapped);
+  ASSERT_EQ(length, mapped_length);
+  for (size_t i = 0; i < length; i++) {
+    ASSERT_EQ(i * 0.5f, mapped[i]) << "i = " << i;
+  }
+  simd_madvise_sequential(mapped, mapped_length * sizeof(float));
+  simd_munmap_signal(mapped, mapped_length);
+  unlink(path);
+
+  EXPECT_EQ(nullptr, simd_mmap_signal("/nonexistent/simd_mmap_signal",
+                                      &mapped_length));
+}
+
 TEST(Memory, malloc_aligned_offset) {
   auto ptr = malloc_aligned_offset(100, 3);
 #ifdef __AVX__
@@ -80,6 +180,39 @@ TEST(Memory, mallocf) {
   free(ptr);
 }
 
+TEST(Memory, simd_arena) {
+  auto arena = simd_arena_create(1024);
+  ASSERT_NE(nullptr, arena.base);
+  auto first = simd_arena_alloc(&arena, 100);
+  auto second = simd_arena_alloc(&arena, 4);
+  EXPECT_EQ(static_cast<uintptr_t>(0),
+            reinterpret_cast<uintptr_t>(first) % 64);
+  EXPECT_EQ(static_cast<uintptr_t>(0),
+            reinterpret_cast<uintptr_t>(second) % 64);
+  EXPECT_EQ(reinterpret_cast<char*>(first) + 128,
+            reinterpret_cast<char*>(second));
+  memset(first, 0, 100);
+  simd_arena_reset(&arena);
+  EXPECT_EQ(first, simd_arena_alloc(&arena, 1024));
+  simd_arena_destroy(&arena);
+  EXPECT_EQ(nullptr, arena.base);
+}
+
+TEST(Memory, mallocf_pool) {
+  mallocf_pool_enable(1);
+  auto first = mallocf(1000);
+  EXPECT_EQ(static_cast<uintptr_t>(0),
+            reinterpret_cast<uintptr_t>(first) % 32);
+  freef(first);
+  EXPECT_EQ(first, mallocf(1000));
+  freef(first);
+  freef(nullptr);
+  mallocf_pool_drain();
+  mallocf_pool_enable(0);
+  auto plain = mallocf(1000);
+  freef(plain);
+}
+
 TEST(Memory, memsetf) {
   float ptr[102] __attribute__ ((aligned (32)));  // NOLINT(whitespace/parens)
   memsetf(&ptr[3], 3.0f, 99);
@@ -88,6 +221,83 @@ TEST(Memory, memsetf) {
   }
 }
 
+TEST(Memory, memsetf_parallel) {
+  const size_t length = 100000;
+  float *ptr = mallocf(length);
+  memsetf_parallel(ptr, 1.25f, length, 3);
+  for (size_t i = 0; i < length; i++) {
+    ASSERT_EQ(1.25f, ptr[i]) << "i = " << i;
+  }
+  memsetf_parallel(ptr, -2.0f, length, 0);
+  for (size_t i = 0; i < length; i++) {
+    ASSERT_EQ(-2.0f, ptr[i]) << "i = " << i;
+  }
+  memsetf_parallel(ptr, 0.5f, 100, 4);
+  for (size_t i = 0; i < 100; i++) {
+    ASSERT_EQ(0.5f, ptr[i]) << "i = " << i;
+  }
+  free(ptr);
+}
+
+TEST(Memory, frame_extract) {
+  const size_t length = 1000;
+  float src[length];
+  for (size_t i = 0; i < length; i++) {
+    src[i] = i * 0.25f;
+  }
+  // frameSize not divisible by hopSize exercises the partial segments
+  for (size_t frameSize : { size_t(64), size_t(70) }) {
+    const size_t hopSize = frameSize / 4;  // the common 75% overlap
+    size_t count = frame_extract_count(length, frameSize, hopSize);
+    ASSERT_EQ((length - frameSize) / hopSize + 1, count);
+    auto dst = std::unique_ptr<float[]>(new float[count * frameSize]);
+    frame_extract(src, length, frameSize, hopSize, dst.get());
+    for (size_t f = 0; f < count; f++) {
+      for (size_t i = 0; i < frameSize; i++) {
+        ASSERT_EQ(src[f * hopSize + i], dst.get()[f * frameSize + i])
+            << "frame " << f << " i " << i;
+      }
+    }
+  }
+  ASSERT_EQ(static_cast<size_t>(0), frame_extract_count(10, 64, 16));
+}
+
+TEST(Memory, frame_extract_views) {
+  const size_t length = 1000;
+  auto src = std::unique_ptr<float[]>(new float[length]);
+  const float *frames[64];
+  size_t count = frame_extract_count(length, 64, 16);
+  ASSERT_EQ(1, frame_extract_views(src.get(), length, 64, 16, frames));
+  for (size_t f = 0; f < count; f++) {
+    ASSERT_EQ(src.get() + f * 16, frames[f]);
+  }
+#ifdef __AVX__
+  // A hop which breaks the 32 byte alignment must be rejected
+  ASSERT_EQ(0, frame_extract_views(src.get(), length, 64, 15, frames));
+#endif
+}
+
+TEST(Memory, memcpyf_stream) {
+  float src[107], dst[110] __attribute__ ((aligned (32)));  // NOLINT(*)
+  for (int i = 0; i < 107; i++) {
+    src[i] = i * 1.5f;
+  }
+  memcpyf_stream(&dst[3], src, 107);
+  for (int i = 0; i < 107; i++) {
+    ASSERT_EQ(src[i], dst[i + 3]);
+  }
+}
+
+TEST(Memory, memsetf_stream) {
+  const size_t length = (1 << 20) + 19;
+  float *ptr = mallocf(length);
+  memsetf(ptr, 2.5f, length);
+  for (size_t i = 0; i < length; i++) {
+    ASSERT_EQ(2.5f, ptr[i]) << "i = " << i;
+  }
+  free(ptr);
+}
+
 TEST(Memory, zeropadding) {
   float orig[100];
   memsetf(orig, 1.0f, 100);
@@ -107,6 +317,20 @@ TEST(Memory, zeropadding) {
   free(ptr);
 }
 
+TEST(Memory, zeropadding_to) {
+  float orig[100];
+  memsetf(orig, 1.0f, 100);
+  float dst[171] __attribute__ ((aligned (32)));  // NOLINT(*)
+  memsetf(dst, -1.0f, 171);
+  EXPECT_EQ(dst, zeropadding_to(dst, 171, orig, 100));
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(1.0f, dst[i]);
+  }
+  for (int i = 100; i < 171; i++) {
+    EXPECT_EQ(0.0f, dst[i]);
+  }
+}
+
 TEST(Memory, rmemcpyf) {
   float src[25] __attribute__ ((aligned (32)));  // NOLINT(*)
   const int len = sizeof(src) / sizeof(float);  // NOLINT(*)
@@ -120,4 +344,18 @@ TEST(Memory, rmemcpyf) {
   }
 }
 
+TEST(Memory, crmemcpyf) {
+  float src[26] __attribute__ ((aligned (32)));  // NOLINT(*)
+  const int len = sizeof(src) / sizeof(float);  // NOLINT(*)
+  for (int i = 0; i < len; i++) {
+    src[i] = i;
+  }
+  float dest[26] __attribute__ ((aligned (32)));  // NOLINT(*)
+  crmemcpyf(dest, src, len);
+  for (int i = 0; i < len; i += 2) {
+    ASSERT_EQ(src[len - i - 2], dest[i]);
+    ASSERT_EQ(src[len - i - 1], dest[i + 1]);
+  }
+}
+
 #include "tests/google/src/gtest_main.cc"
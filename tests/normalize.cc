@@ -29,6 +29,7 @@
  */
 
 
+#include <cmath>
 #include <simd/normalize.h>
 #include <simd/memory.h>
 #include <gtest/gtest.h>
@@ -62,6 +63,110 @@ TEST_P(SimdTest, normalize2D) {
   ASSERT_FLOAT_EQ(2.f * (3 - 1) / 251 - 1, res[121]);
 }
 
+TEST_P(SimdTest, normalize2D_threads) {
+  const int width = 500, height = 400, src_stride = 512, dst_stride = 504;
+  uint8_t *array = new uint8_t[height * src_stride];
+  float *res = mallocf(height * dst_stride);
+  float *res_valid = mallocf(height * dst_stride);
+  for (int i = 0; i < height * src_stride; i++) {
+    array[i] = i % 230 + 10;
+  }
+  uint8_t min, max, min_valid, max_valid;
+  minmax2D(is_simd(), array, src_stride, width, height,
+           &min_valid, &max_valid);
+  normalize2D(is_simd(), array, src_stride, width, height,
+              res_valid, dst_stride);
+  normalize_set_threads(4);
+  minmax2D(is_simd(), array, src_stride, width, height, &min, &max);
+  normalize2D(is_simd(), array, src_stride, width, height, res, dst_stride);
+  normalize_set_threads(1);
+  EXPECT_EQ(min_valid, min);
+  EXPECT_EQ(max_valid, max);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      ASSERT_EQ(res_valid[y * dst_stride + x], res[y * dst_stride + x])
+          << x << " " << y;
+    }
+  }
+  delete[] array;
+  free(res);
+  free(res_valid);
+}
+
+TEST_P(SimdTest, normalize2D_fused) {
+  const int width = 500, height = 300, src_stride = 512, dst_stride = 504;
+  uint8_t *array = new uint8_t[height * src_stride];
+  float *res = mallocf(height * dst_stride);
+  float *res_valid = mallocf(height * dst_stride);
+  for (int i = 0; i < height * src_stride; i++) {
+    array[i] = i % 200 + 20;
+  }
+  uint8_t min_valid, max_valid;
+  minmax2D(is_simd(), array, src_stride, width, height,
+           &min_valid, &max_valid);
+  normalize2D_minmax(is_simd(), min_valid, max_valid, array, src_stride,
+                     width, height, res_valid, dst_stride);
+  // seeded with the exact range, the fused pass must match bit for bit
+  uint8_t min = min_valid, max = max_valid;
+  normalize2D_fused(is_simd(), array, src_stride, width, height,
+                    res, dst_stride, &min, &max);
+  EXPECT_EQ(min_valid, min);
+  EXPECT_EQ(max_valid, max);
+  for (int y = 0; y < height; y++) {
+    for (int x = 0; x < width; x++) {
+      ASSERT_EQ(res_valid[y * dst_stride + x], res[y * dst_stride + x])
+          << x << " " << y;
+    }
+  }
+  // a stale seed still reports the exact range back
+  min = 0;
+  max = 255;
+  normalize2D_fused(is_simd(), array, src_stride, width, height,
+                    res, dst_stride, &min, &max);
+  EXPECT_EQ(min_valid, min);
+  EXPECT_EQ(max_valid, max);
+  delete[] array;
+  free(res);
+  free(res_valid);
+}
+
+TEST_P(SimdTest, normalize_stream) {
+  const int width = 320, height = 200;
+  uint8_t *array = new uint8_t[height * width];
+  float *res = mallocf(height * width);
+  float *res_valid = mallocf(height * width);
+  for (int i = 0; i < height * width; i++) {
+    array[i] = i % 150 + 50;
+  }
+  NormalizeStreamHandle handle = normalize_stream_initialize(3, 1);
+  // the first frame rescans, so it matches normalize2D() exactly
+  normalize_stream_feed(&handle, is_simd(), array, width, width, height,
+                        res, width);
+  normalize2D(is_simd(), array, width, width, height, res_valid, width);
+  for (int i = 0; i < height * width; i++) {
+    ASSERT_EQ(res_valid[i], res[i]) << i;
+  }
+  EXPECT_EQ(50, handle.min);
+  EXPECT_EQ(199, handle.max);
+  // the following frames reuse the cached range, widened by decay
+  normalize_stream_feed(&handle, is_simd(), array, width, width, height,
+                        res, width);
+  EXPECT_EQ(49, handle.min);
+  EXPECT_EQ(200, handle.max);
+  normalize_stream_feed(&handle, is_simd(), array, width, width, height,
+                        res, width);
+  EXPECT_EQ(48, handle.min);
+  EXPECT_EQ(201, handle.max);
+  // the third feed after the rescan scans again and snaps the range
+  normalize_stream_feed(&handle, is_simd(), array, width, width, height,
+                        res, width);
+  EXPECT_EQ(50, handle.min);
+  EXPECT_EQ(199, handle.max);
+  delete[] array;
+  free(res);
+  free(res_valid);
+}
+
 TEST_P(SimdTest, minmax1D) {
   const int length = 100;
   float array[length];
@@ -80,6 +185,56 @@ TEST_P(SimdTest, minmax1D) {
   EXPECT_FLOAT_EQ(252, max);
 }
 
+TEST_P(SimdTest, normalize2D_i16) {
+  uint8_t array[128 * 100];
+  memset(array, 1, sizeof(array));
+  array[0] = 127;
+  array[10] = 252;
+  int16_t res[100 * 100];
+  normalize2D_i16(is_simd(), array, 128, 100, 100, res, 100);
+  EXPECT_EQ(-32767, res[1]);  // the minimum maps to the lower rail
+  EXPECT_EQ(32767, res[10]);  // the maximum maps to the upper rail
+  int16_t expected =
+      static_cast<int16_t>(rintf((2.f * (127 - 1) / 251 - 1) * 32767.f));
+  EXPECT_EQ(expected, res[0]);
+}
+
+TEST_P(SimdTest, rgb_roundtrip) {
+  const size_t pixels = 1000;
+  uint8_t rgb[pixels * 3], rgb2[pixels * 3];
+  uint8_t r[pixels], g[pixels], b[pixels];
+  for (size_t i = 0; i < pixels * 3; i++) {
+    rgb[i] = i % 251;
+  }
+  deinterleave_rgb(is_simd(), rgb, pixels, r, g, b);
+  for (size_t i = 0; i < pixels; i += 97) {
+    ASSERT_EQ(rgb[i * 3], r[i]) << i;
+    ASSERT_EQ(rgb[i * 3 + 1], g[i]) << i;
+    ASSERT_EQ(rgb[i * 3 + 2], b[i]) << i;
+  }
+  interleave_rgb(is_simd(), r, g, b, pixels, rgb2);
+  ASSERT_EQ(0, memcmp(rgb, rgb2, sizeof(rgb)));
+}
+
+TEST_P(SimdTest, argminmax1D) {
+  const int length = 1000;
+  float array[length];
+  memsetf(array, 1.f, length);
+  array[321] = -5;
+  array[322] = -5;  // tie: the first occurrence wins
+  array[700] = 252;
+  array[801] = 252;
+  float min, max;
+  int min_idx, max_idx;
+  argminmax1D(is_simd(), array, length, &min, &min_idx, &max, &max_idx);
+  EXPECT_FLOAT_EQ(-5, min);
+  EXPECT_EQ(321, min_idx);
+  EXPECT_FLOAT_EQ(252, max);
+  EXPECT_EQ(700, max_idx);
+  argminmax1D(is_simd(), array, length, nullptr, &min_idx, nullptr, nullptr);
+  EXPECT_EQ(321, min_idx);
+}
+
 INSTANTIATE_TEST_CASE_P(NormalizeTests, SimdTest, ::testing::Bool());
 
 #include "tests/google/src/gtest_main.cc"
@@ -0,0 +1,176 @@
+/*! @file pipeline.cc
+ *  @brief Tests for the fused kernel pipelines.
+ *  @author Markovtsev Vadim <v.markovtsev@samsung.com>
+ *  @version 1.0
+ *
+ *  @section Notes
+ *  This code partially conforms to <a href="http://google-styleguide.googlecode.com/svn/trunk/cppguide.xml">Google C++ Style Guide</a>.
+ *
+ *  @section Copyright
+ *  Copyright © 2013 Samsung R&D Institute Russia
+ *
+ *  @section License
+ *  Licensed to the Apache Software Foundation (ASF) under one
+ *  or more contributor license agreements.  See the NOTICE file
+ *  distributed with this work for additional information
+ *  regarding copyright ownership.  The ASF licenses this file
+ *  to you under the Apache License, Version 2.0 (the
+ *  "License"); you may not use this file except in compliance
+ *  with the License.  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing,
+ *  software distributed under the License is distributed on an
+ *  "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+ *  KIND, either express or implied.  See the License for the
+ *  specific language governing permissions and limitations
+ *  under the License.
+ */
+
+#include <simd/pipeline.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+class PipelineTest : public ::testing::TestWithParam<bool> {
+ protected:
+  bool is_simd() {
+    return GetParam();
+  }
+
+  // The reference: the same chain run one whole array at a time
+  static void reference_chain(const std::vector<int16_t>& input,
+                              const std::vector<float>& window,
+                              const std::vector<float>& fir,
+                              float multiplier, float offset,
+                              std::vector<float>* output) {
+    size_t length = input.size();
+    std::vector<float> windowed(length);
+    for (size_t i = 0; i < length; i++) {
+      windowed[i] = static_cast<float>(input[i]) * window[i];
+    }
+    output->assign(length, 0.f);
+    for (size_t i = 0; i < length; i++) {
+      float sum = 0.f;
+      for (size_t k = 0; k < fir.size() && k <= i; k++) {
+        sum += fir[k] * windowed[i - k];
+      }
+      (*output)[i] = sum * multiplier + offset;
+    }
+  }
+};
+
+TEST_P(PipelineTest, FullChain) {
+  const size_t length = 10000;
+  std::vector<int16_t> input(length);
+  std::vector<float> window(length);
+  for (size_t i = 0; i < length; i++) {
+    input[i] = static_cast<int16_t>(
+        1000 * sinf(i * static_cast<float>(M_PI) / 100));
+    window[i] = 0.5f - 0.5f * cosf(2 * static_cast<float>(M_PI) * i /
+                                   (length - 1));
+  }
+  std::vector<float> fir = { 0.25f, 0.5f, 0.25f, 0.125f };
+  std::vector<float> expected;
+  reference_chain(input, window, fir, 0.001f, 1.f, &expected);
+
+  // A small tile forces many boundary crossings
+  SimdPipeline *pipeline = simd_pipeline_initialize(is_simd(), 768);
+  simd_pipeline_add_int16_to_float(pipeline);
+  simd_pipeline_add_window(pipeline, window.data(), window.size());
+  simd_pipeline_add_fir(pipeline, fir.data(), fir.size());
+  simd_pipeline_add_scale(pipeline, 0.001f, 1.f);
+  simd_pipeline_add_detect_peaks(pipeline, kExtremumTypeMaximum);
+  std::vector<float> actual(length);
+  simd_pipeline_execute(pipeline, input.data(), length, actual.data());
+
+  for (size_t i = 0; i < length; i++) {
+    ASSERT_NEAR(expected[i], actual[i], 1e-4f) << i;
+  }
+
+  ExtremumPoint *expected_peaks;
+  size_t expected_peaks_count;
+  detect_peaks(is_simd(), expected.data(), length, kExtremumTypeMaximum,
+               &expected_peaks, &expected_peaks_count);
+  ExtremumPoint *peaks;
+  size_t peaks_count;
+  simd_pipeline_get_peaks(pipeline, &peaks, &peaks_count);
+  ASSERT_EQ(expected_peaks_count, peaks_count);
+  for (size_t i = 0; i < peaks_count; i++) {
+    EXPECT_EQ(expected_peaks[i].position, peaks[i].position) << i;
+    EXPECT_NEAR(expected_peaks[i].value, peaks[i].value, 1e-4f) << i;
+  }
+  free(expected_peaks);
+  simd_pipeline_finalize(pipeline);
+}
+
+TEST_P(PipelineTest, MinimalTileOddLength) {
+  // The smallest allowed tile with an odd length: every chunk must still
+  // carry at least two samples into the peak detection
+  const size_t length = 101;
+  std::vector<float> input(length);
+  for (size_t i = 0; i < length; i++) {
+    input[i] = sinf(i * 0.3f);
+  }
+  SimdPipeline *pipeline = simd_pipeline_initialize(is_simd(), 3);
+  simd_pipeline_add_detect_peaks(pipeline, kExtremumTypeMaximum);
+  simd_pipeline_execute(pipeline, input.data(), length, nullptr);
+
+  ExtremumPoint *expected_peaks;
+  size_t expected_peaks_count;
+  detect_peaks(is_simd(), input.data(), length, kExtremumTypeMaximum,
+               &expected_peaks, &expected_peaks_count);
+  ExtremumPoint *peaks;
+  size_t peaks_count;
+  simd_pipeline_get_peaks(pipeline, &peaks, &peaks_count);
+  ASSERT_EQ(expected_peaks_count, peaks_count);
+  for (size_t i = 0; i < peaks_count; i++) {
+    EXPECT_EQ(expected_peaks[i].position, peaks[i].position) << i;
+  }
+  free(expected_peaks);
+  simd_pipeline_finalize(pipeline);
+}
+
+TEST_P(PipelineTest, StreamedFramesEqualOneFrame) {
+  const size_t length = 3000;
+  std::vector<float> input(length);
+  for (size_t i = 0; i < length; i++) {
+    input[i] = sinf(i * 0.05f) + 0.3f * sinf(i * 0.41f);
+  }
+  std::vector<float> fir = { 0.3f, -0.2f, 0.6f, 0.1f, -0.4f };
+
+  SimdPipeline *whole = simd_pipeline_initialize(is_simd(), 0);
+  simd_pipeline_add_fir(whole, fir.data(), fir.size());
+  std::vector<float> expected(length);
+  simd_pipeline_execute(whole, input.data(), length, expected.data());
+  simd_pipeline_finalize(whole);
+
+  // The FIR carry must stitch execute calls exactly like tiles
+  SimdPipeline *framed = simd_pipeline_initialize(is_simd(), 0);
+  simd_pipeline_add_fir(framed, fir.data(), fir.size());
+  std::vector<float> actual(length);
+  const size_t frame = 700;
+  for (size_t offset = 0; offset < length; offset += frame) {
+    size_t size = std::min(frame, length - offset);
+    simd_pipeline_execute(framed, input.data() + offset, size,
+                          actual.data() + offset);
+  }
+  for (size_t i = 0; i < length; i++) {
+    ASSERT_NEAR(expected[i], actual[i], 1e-5f) << i;
+  }
+
+  // After a reset the history must be forgotten
+  simd_pipeline_reset(framed);
+  std::vector<float> restarted(length);
+  simd_pipeline_execute(framed, input.data(), length, restarted.data());
+  for (size_t i = 0; i < length; i++) {
+    ASSERT_NEAR(expected[i], restarted[i], 1e-5f) << i;
+  }
+  simd_pipeline_finalize(framed);
+}
+
+INSTANTIATE_TEST_CASE_P(PipelineParams, PipelineTest, ::testing::Bool());
+
+#include "tests/google/src/gtest_main.cc"
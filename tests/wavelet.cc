@@ -30,6 +30,8 @@
 
 #include <gtest/gtest.h>
 #include <chrono>
+#include <cmath>
+#include <cstring>
 #include <simd/arithmetic.h>
 #include <simd/memory.h>
 #include <simd/wavelet.h>
@@ -166,6 +168,316 @@ TEST(Wavelet, stationary_wavelet_apply_na) {
    }
 }
 
+TEST(Wavelet, wavelet_decompose) {
+  const size_t length = 512;
+  const int levels = 4;
+  float array[length];
+  for (size_t i = 0; i < length; i++) {
+    array[i] = sinf(i * 0.1f) * 10 + i % 5;
+  }
+
+  for (int order : { 2, 4, 8, 16 }) {
+    float coeffs[length];
+    wavelet_decompose(WAVELET_TYPE_DAUBECHIES, order,
+                      EXTENSION_TYPE_PERIODIC, levels, array, length, coeffs);
+
+    // The manual per-level loop the pipeline replaces
+    float source[length], desthi[length / 2], destlo[length / 2];
+    memcpy(source, array, sizeof(array));
+    size_t n = length;
+    const float *valid = coeffs;
+    for (int level = 0; level < levels; level++) {
+      wavelet_apply_na(WAVELET_TYPE_DAUBECHIES, order,
+                       EXTENSION_TYPE_PERIODIC, source, n, desthi, destlo);
+      n /= 2;
+      for (size_t i = 0; i < n; i++) {
+        ASSERT_EQF(desthi[i], valid[i]) << order << " " << level << " " << i;
+      }
+      valid += n;
+      memcpy(source, destlo, n * sizeof(float));
+    }
+    for (size_t i = 0; i < n; i++) {
+      ASSERT_EQF(destlo[i], valid[i]) << order << " " << i;
+    }
+  }
+}
+
+TEST(Wavelet, stationary_wavelet_apply_threads) {
+  const size_t length = 100000;
+  auto array = std::uniquify(mallocf(length), std::free);
+  for (size_t i = 0; i < length; i++) {
+    array.get()[i] = sinf(i * 0.11f) * 4 + i % 13;
+  }
+  auto desthi = std::uniquify(mallocf(length), std::free);
+  auto destlo = std::uniquify(mallocf(length), std::free);
+  auto validhi = std::uniquify(mallocf(length), std::free);
+  auto validlo = std::uniquify(mallocf(length), std::free);
+  for (int level : { 1, 2 }) {
+    stationary_wavelet_apply(WAVELET_TYPE_DAUBECHIES, 8, level,
+                             EXTENSION_TYPE_PERIODIC, array.get(), length,
+                             validhi.get(), validlo.get());
+    stationary_wavelet_apply_threads(WAVELET_TYPE_DAUBECHIES, 8, level,
+                                     EXTENSION_TYPE_PERIODIC, 4,
+                                     array.get(), length,
+                                     desthi.get(), destlo.get());
+    for (size_t i = 0; i < length; i++) {
+      ASSERT_EQF(validhi.get()[i], desthi.get()[i]) << level << " " << i;
+      ASSERT_EQF(validlo.get()[i], destlo.get()[i]) << level << " " << i;
+    }
+  }
+}
+
+namespace {
+
+struct WaveletStreamSink {
+  float *desthi;
+  float *destlo;
+  size_t written;
+};
+
+}  // namespace
+
+TEST(Wavelet, stationary_wavelet_apply_stream) {
+  const size_t length = 100000;
+  auto array = std::uniquify(mallocf(length), std::free);
+  for (size_t i = 0; i < length; i++) {
+    array.get()[i] = sinf(i * 0.11f) * 4 + i % 13;
+  }
+  auto desthi = std::uniquify(mallocf(length), std::free);
+  auto destlo = std::uniquify(mallocf(length), std::free);
+  auto validhi = std::uniquify(mallocf(length), std::free);
+  auto validlo = std::uniquify(mallocf(length), std::free);
+  for (int level : { 1, 2 }) {
+    stationary_wavelet_apply(WAVELET_TYPE_DAUBECHIES, 8, level,
+                             EXTENSION_TYPE_PERIODIC, array.get(), length,
+                             validhi.get(), validlo.get());
+    WaveletStreamSink sink { desthi.get(), destlo.get(), 0 };
+    stationary_wavelet_apply_stream(
+        WAVELET_TYPE_DAUBECHIES, 8, level, EXTENSION_TYPE_PERIODIC,
+        array.get(), length, 4096,
+        [](const float *hi, const float *lo, size_t offset, size_t count,
+           void *user) {
+          auto me = static_cast<WaveletStreamSink *>(user);
+          memcpy(me->desthi + offset, hi, count * sizeof(float));
+          memcpy(me->destlo + offset, lo, count * sizeof(float));
+          me->written += count;
+        },
+        &sink);
+    ASSERT_EQ(length, sink.written);
+    for (size_t i = 0; i < length; i++) {
+      ASSERT_EQF(validhi.get()[i], desthi.get()[i]) << level << " " << i;
+      ASSERT_EQF(validlo.get()[i], destlo.get()[i]) << level << " " << i;
+    }
+  }
+}
+
+TEST(Wavelet, wavelet_transform) {
+  const size_t length = 512;
+  float array[length];
+  auto handle = wavelet_initialize(WAVELET_TYPE_DAUBECHIES, 8, length);
+  auto desthi = std::uniquify(wavelet_allocate_destination(8, length),
+                              std::free);
+  auto destlo = std::uniquify(wavelet_allocate_destination(8, length),
+                              std::free);
+  // The handle must survive several frames without reallocation
+  for (int frame = 0; frame < 3; frame++) {
+    for (size_t i = 0; i < length; i++) {
+      array[i] = sinf(i * 0.07f * (frame + 1)) * 10 + i % 9;
+    }
+    wavelet_transform(handle, EXTENSION_TYPE_PERIODIC, array);
+    auto prep = std::uniquify(wavelet_prepare_array(8, array, length),
+                              std::free);
+    wavelet_apply(WAVELET_TYPE_DAUBECHIES, 8, EXTENSION_TYPE_PERIODIC,
+                  prep.get(), length, desthi.get(), destlo.get());
+    for (size_t i = 0; i < length / 2; i++) {
+      ASSERT_EQF(desthi.get()[i], handle.desthi[i]) << frame << " " << i;
+      ASSERT_EQF(destlo.get()[i], handle.destlo[i]) << frame << " " << i;
+    }
+  }
+  wavelet_finalize(handle);
+}
+
+TEST(Wavelet, wavelet_apply_batch) {
+  const size_t length = 240;
+  const size_t count = 21;  // not a multiple of the SIMD width
+  float arrays[count][length];
+  float desthi[count][length / 2], destlo[count][length / 2];
+  float *srcs[count], *his[count], *los[count];
+  for (size_t c = 0; c < count; c++) {
+    for (size_t i = 0; i < length; i++) {
+      arrays[c][i] = sinf(i * 0.07f * (c + 1)) * 10 + (i + c) % 9;
+    }
+    srcs[c] = arrays[c];
+    his[c] = desthi[c];
+    los[c] = destlo[c];
+  }
+  wavelet_apply_batch(WAVELET_TYPE_DAUBECHIES, 8, EXTENSION_TYPE_MIRROR,
+                      srcs, count, length, his, los);
+  float validhi[length / 2], validlo[length / 2];
+  for (size_t c = 0; c < count; c++) {
+    wavelet_apply_na(WAVELET_TYPE_DAUBECHIES, 8, EXTENSION_TYPE_MIRROR,
+                     arrays[c], length, validhi, validlo);
+    for (size_t i = 0; i < length / 2; i++) {
+      ASSERT_EQF(validhi[i], desthi[c][i]) << c << " " << i;
+      ASSERT_EQF(validlo[i], destlo[c][i]) << c << " " << i;
+    }
+  }
+}
+
+TEST(Wavelet, wavelet_apply_2d) {
+  const size_t width = 64;
+  const size_t height = 32;
+  float src[width * height], dst[width * height];
+  for (size_t i = 0; i < width * height; i++) {
+    src[i] = sinf(i * 0.013f) * 7 + (i % 17) * 0.2f;
+  }
+  wavelet_apply_2d(WAVELET_TYPE_DAUBECHIES, 8, EXTENSION_TYPE_MIRROR,
+                   src, width, height, dst);
+
+  // Rows with wavelet_apply_na(), then columns through an explicit
+  // transpose - the definition of the separable transform
+  float rows[width * height], hi[width / 2], lo[width / 2];
+  for (size_t r = 0; r < height; r++) {
+    wavelet_apply_na(WAVELET_TYPE_DAUBECHIES, 8, EXTENSION_TYPE_MIRROR,
+                     src + r * width, width, hi, lo);
+    memcpy(rows + r * width, lo, width / 2 * sizeof(float));
+    memcpy(rows + r * width + width / 2, hi, width / 2 * sizeof(float));
+  }
+  float column[height], chi[height / 2], clo[height / 2];
+  for (size_t c = 0; c < width; c++) {
+    for (size_t r = 0; r < height; r++) {
+      column[r] = rows[r * width + c];
+    }
+    wavelet_apply_na(WAVELET_TYPE_DAUBECHIES, 8, EXTENSION_TYPE_MIRROR,
+                     column, height, chi, clo);
+    for (size_t r = 0; r < height / 2; r++) {
+      ASSERT_EQF(clo[r], dst[r * width + c]) << c << " " << r;
+      ASSERT_EQF(chi[r], dst[(height / 2 + r) * width + c]) << c << " " << r;
+    }
+  }
+}
+
+TEST(Wavelet, wavelet_synthesize) {
+  const size_t length = 512;
+  float array[length], desthi[length / 2], destlo[length / 2];
+  float rec[length], rec_na[length];
+  for (size_t i = 0; i < length; i++) {
+    array[i] = sinf(i * 0.07f) * 10 + i % 9;
+  }
+
+  for (auto type : { WAVELET_TYPE_DAUBECHIES, WAVELET_TYPE_COIFLET,
+                     WAVELET_TYPE_SYMLET }) {
+    for (int order : { 2, 4, 6, 8, 12, 16 }) {
+      if (!wavelet_validate_order(type, order)) {
+        continue;
+      }
+      wavelet_apply_na(type, order, EXTENSION_TYPE_PERIODIC, array, length,
+                       desthi, destlo);
+      wavelet_synthesize_na(type, order, desthi, destlo, length, rec_na);
+      wavelet_synthesize(type, order, desthi, destlo, length, rec);
+      for (size_t i = 0; i < length; i++) {
+        ASSERT_EQF(array[i], rec_na[i]) << type << " " << order << " " << i;
+        ASSERT_EQF(array[i], rec[i]) << type << " " << order << " " << i;
+      }
+    }
+  }
+}
+
+TEST(Wavelet, wavelet_reconstruct) {
+  const size_t length = 512;
+  const int levels = 4;
+  float array[length], coeffs[length], rec[length];
+  for (size_t i = 0; i < length; i++) {
+    array[i] = cosf(i * 0.03f) * 5 + i % 7;
+  }
+
+  for (int order : { 2, 4, 8, 16 }) {
+    wavelet_decompose(WAVELET_TYPE_DAUBECHIES, order,
+                      EXTENSION_TYPE_PERIODIC, levels, array, length, coeffs);
+    wavelet_reconstruct(WAVELET_TYPE_DAUBECHIES, order, levels, coeffs,
+                        length, rec);
+    for (size_t i = 0; i < length; i++) {
+      ASSERT_EQF(array[i], rec[i]) << order << " " << i;
+    }
+  }
+}
+
+static float threshold_value(WaveletThresholdType type, float threshold,
+                             float value) {
+  switch (type) {
+    case WAVELET_THRESHOLD_SOFT: {
+      float shrunk = fabsf(value) - threshold;
+      return shrunk > 0.f? copysignf(shrunk, value) : 0.f;
+    }
+    case WAVELET_THRESHOLD_HARD:
+      return fabsf(value) > threshold? value : 0.f;
+    default:
+      return value;
+  }
+}
+
+TEST(Wavelet, stationary_wavelet_apply_thresholded) {
+  const size_t length = 100000;
+  const float threshold = 0.7f;
+  auto array = std::uniquify(mallocf(length), std::free);
+  for (size_t i = 0; i < length; i++) {
+    array.get()[i] = sinf(i * 0.11f) * 2 + (i % 13) * 0.05f;
+  }
+  auto desthi = std::uniquify(mallocf(length), std::free);
+  auto destlo = std::uniquify(mallocf(length), std::free);
+  auto validhi = std::uniquify(mallocf(length), std::free);
+  auto validlo = std::uniquify(mallocf(length), std::free);
+  stationary_wavelet_apply(WAVELET_TYPE_DAUBECHIES, 8, 1,
+                           EXTENSION_TYPE_PERIODIC, array.get(), length,
+                           validhi.get(), validlo.get());
+  for (auto type : { WAVELET_THRESHOLD_NONE, WAVELET_THRESHOLD_HARD,
+                     WAVELET_THRESHOLD_SOFT }) {
+    for (int threads : { 1, 4 }) {
+      stationary_wavelet_apply_thresholded(WAVELET_TYPE_DAUBECHIES, 8, 1,
+                                           EXTENSION_TYPE_PERIODIC, type,
+                                           threshold, threads, array.get(),
+                                           length, desthi.get(),
+                                           destlo.get());
+      for (size_t i = 0; i < length; i++) {
+        ASSERT_EQF(threshold_value(type, threshold, validhi.get()[i]),
+                   desthi.get()[i]) << type << " " << threads << " " << i;
+        ASSERT_EQF(validlo.get()[i], destlo.get()[i])
+            << type << " " << threads << " " << i;
+      }
+    }
+  }
+}
+
+TEST(Wavelet, wavelet_reconstruct_thresholded) {
+  const size_t length = 512;
+  const int levels = 3;
+  float array[length], coeffs[length], shrunk[length], valid[length];
+  float rec[length];
+  const float thresholds[levels] = { 0.05f, 0.1f, 0.15f };
+  for (size_t i = 0; i < length; i++) {
+    array[i] = cosf(i * 0.04f) * 4 + (i % 7) * 0.2f;
+  }
+  wavelet_decompose(WAVELET_TYPE_DAUBECHIES, 8, EXTENSION_TYPE_PERIODIC,
+                    levels, array, length, coeffs);
+  for (auto type : { WAVELET_THRESHOLD_HARD, WAVELET_THRESHOLD_SOFT }) {
+    memcpy(shrunk, coeffs, sizeof(coeffs));
+    for (int level = 1; level <= levels; level++) {
+      size_t size = length >> (level - 1);
+      float *detail = shrunk + length - size;
+      for (size_t i = 0; i < size / 2; i++) {
+        detail[i] = threshold_value(type, thresholds[level - 1], detail[i]);
+      }
+    }
+    wavelet_reconstruct(WAVELET_TYPE_DAUBECHIES, 8, levels, shrunk,
+                        length, valid);
+    wavelet_reconstruct_thresholded(WAVELET_TYPE_DAUBECHIES, 8, levels,
+                                    coeffs, length, type, thresholds, rec);
+    for (size_t i = 0; i < length; i++) {
+      ASSERT_EQF(valid[i], rec[i]) << type << " " << i;
+    }
+  }
+}
+
 typedef std::unique_ptr<float[], decltype(&std::free)> FloatPtr;
 
 class WaveletTest : public ::testing::TestWithParam<